@@ -234,41 +234,70 @@ uint32_t coap_error_handler_register(coap_error_callback_t error_callback)
     return NRF_SUCCESS;
 }
 
-uint32_t internal_coap_message_send(uint32_t * p_handle, coap_message_t * p_message)
+/**@brief Serialize a message into a transport buffer.
+ *
+ * @details Adapts \ref coap_message_encode to \ref coap_transport_encode_t.
+ */
+static uint32_t message_encode(void * p_context, uint8_t * p_buffer, uint16_t * p_length)
 {
-    if (p_message == NULL)
-    {
-        return (NRF_ERROR_NULL | IOT_COAP_ERR_BASE);
-    }
+    return coap_message_encode((coap_message_t *)p_context, p_buffer, p_length);
+}
 
-    // Compiled away if COAP_ENABLE_OBSERVE_CLIENT is not set to 1.
-    coap_observe_client_send_handle(p_message);
+/**@brief Send a message which is serialized by the given encoder.
+ *
+ * @details Messages that are not kept for retransmission are serialized directly into the
+ *          transport buffer. Other messages are serialized into a buffer kept in the message
+ *          queue until the transaction completes.
+ *
+ * @param[out] p_handle  Handle to the message if it has been added to the message queue.
+ * @param[in]  p_message Message to be sent.
+ * @param[in]  length    Length of the serialized message.
+ * @param[in]  encode    Function serializing the message.
+ * @param[in]  p_context Context passed to the encode function.
+ *
+ * @retval NRF_SUCCESS If the message was successfully encoded and scheduled for transmission.
+ */
+static uint32_t message_transmit(uint32_t *              p_handle,
+                                 coap_message_t *        p_message,
+                                 uint16_t                length,
+                                 coap_transport_encode_t encode,
+                                 void *                  p_context)
+{
+    if (!(is_con(p_message) || (is_non(p_message) &&
+                                is_request(p_message->header.code) &&
+                                (p_message->response_callback != NULL))))
+    {
+        // The message is not kept for retransmission, serialize it directly into the
+        // transport buffer.
+        uint32_t err_code = coap_transport_encode_write(&p_message->port,
+                                                        &p_message->remote,
+                                                        length,
+                                                        encode,
+                                                        p_context);
+        if (err_code == NRF_SUCCESS)
+        {
+            *p_handle = COAP_MESSAGE_QUEUE_SIZE;
+        }
 
-    COAP_ENTRY();
+        COAP_EXIT();
 
-    // Fetch the expected length of the packet serialized by passing length of 0.
-    uint16_t expected_length = 0;
-    uint32_t err_code = coap_message_encode(p_message, NULL, &expected_length);
-    if (err_code != NRF_SUCCESS)
-    {
         return err_code;
     }
 
-    // Allocate a buffer to serialize the message into.
+    // Allocate a buffer to serialize the message into. It is kept for retransmissions.
     uint8_t * p_buffer;
-    uint32_t request_length = expected_length;
-    err_code = nrf_mem_reserve(&p_buffer, &request_length);
+    uint32_t  request_length = length;
+    uint32_t  err_code       = nrf_mem_reserve(&p_buffer, &request_length);
     if (err_code != NRF_SUCCESS)
     {
         COAP_TRC("p_buffer alloc error = 0x%08lX!", err_code);
         return err_code;
     }
-    memset(p_buffer, 0, request_length);
     COAP_TRC("Alloc mem, p_buffer = %p", (uint8_t *)p_buffer);
 
     // Serialize the message.
     uint16_t buffer_length = (uint16_t)request_length;
-    err_code = coap_message_encode(p_message, p_buffer, &buffer_length);
+    err_code = encode(p_context, p_buffer, &buffer_length);
     if (err_code != NRF_SUCCESS)
     {
         COAP_TRC("Encode error!");
@@ -282,55 +311,43 @@ uint32_t internal_coap_message_send(uint32_t * p_handle, coap_message_t * p_mess
 
     if (err_code == NRF_SUCCESS)
     {
-        if (is_con(p_message) || (is_non(p_message) &&
-                                  is_request(p_message->header.code) &&
-                                  (p_message->response_callback != NULL)))
+        coap_queue_item_t item;
+        item.p_arg         = p_message->p_arg;
+        item.mid           = p_message->header.id;
+        item.callback      = p_message->response_callback;
+        item.p_buffer      = p_buffer;
+        item.buffer_len    = buffer_length;
+        item.timeout_val   = COAP_ACK_TIMEOUT * COAP_ACK_RANDOM_FACTOR;
+
+        if (p_message->header.type == COAP_TYPE_CON)
         {
-            coap_queue_item_t item;
-            item.p_arg         = p_message->p_arg;
-            item.mid           = p_message->header.id;
-            item.callback      = p_message->response_callback;
-            item.p_buffer      = p_buffer;
-            item.buffer_len    = buffer_length;
-            item.timeout_val   = COAP_ACK_TIMEOUT * COAP_ACK_RANDOM_FACTOR;
-
-            if (p_message->header.type == COAP_TYPE_CON)
-            {
-                item.timeout       = item.timeout_val;
-                item.retrans_count = 0;
-            }
-            else
-            {
-                item.timeout       = COAP_MAX_TRANSMISSION_SPAN;
-                item.retrans_count = COAP_MAX_RETRANSMIT_COUNT;
-            }
-
-            item.port      = p_message->port;
-            item.token_len = p_message->header.token_len;
-
-            memcpy(&item.remote, &p_message->remote, sizeof(coap_remote_t));
-            memcpy(item.token, p_message->token, p_message->header.token_len);
-
-            err_code = coap_queue_add(&item);
-            if (err_code != NRF_SUCCESS)
-            {
-                COAP_TRC("Message queue error = 0x%08lX!", err_code);
+            item.timeout       = item.timeout_val;
+            item.retrans_count = 0;
+        }
+        else
+        {
+            item.timeout       = COAP_MAX_TRANSMISSION_SPAN;
+            item.retrans_count = COAP_MAX_RETRANSMIT_COUNT;
+        }
 
-                COAP_TRC("Free mem, p_buffer = %p", p_buffer);
-                UNUSED_VARIABLE(nrf_free(p_buffer));
+        item.port      = p_message->port;
+        item.token_len = p_message->header.token_len;
 
-                return err_code;
-            }
+        memcpy(&item.remote, &p_message->remote, sizeof(coap_remote_t));
+        memcpy(item.token, p_message->token, p_message->header.token_len);
 
-            *p_handle = item.handle;
-        }
-        else
+        err_code = coap_queue_add(&item);
+        if (err_code != NRF_SUCCESS)
         {
-            *p_handle = COAP_MESSAGE_QUEUE_SIZE;
+            COAP_TRC("Message queue error = 0x%08lX!", err_code);
 
             COAP_TRC("Free mem, p_buffer = %p", p_buffer);
             UNUSED_VARIABLE(nrf_free(p_buffer));
+
+            return err_code;
         }
+
+        *p_handle = item.handle;
     }
     else
     {
@@ -343,6 +360,92 @@ uint32_t internal_coap_message_send(uint32_t * p_handle, coap_message_t * p_mess
     return err_code;
 }
 
+uint32_t internal_coap_message_send(uint32_t * p_handle, coap_message_t * p_message)
+{
+    if (p_message == NULL)
+    {
+        return (NRF_ERROR_NULL | IOT_COAP_ERR_BASE);
+    }
+
+    // Compiled away if COAP_ENABLE_OBSERVE_CLIENT is not set to 1.
+    coap_observe_client_send_handle(p_message);
+
+    COAP_ENTRY();
+
+    // Fetch the expected length of the packet serialized by passing length of 0.
+    uint16_t expected_length = 0;
+    uint32_t err_code = coap_message_encode(p_message, NULL, &expected_length);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    return message_transmit(p_handle, p_message, expected_length, message_encode, p_message);
+}
+
+/**@brief Context of \ref message_body_encode. */
+typedef struct
+{
+    coap_message_t * p_message;                                                          /**< Message to encode the header and token of. */
+    const uint8_t  * p_body;                                                             /**< Encoded options and payload. */
+    uint16_t         body_len;                                                           /**< Length of the encoded options and payload. */
+} message_body_t;
+
+/**@brief Serialize the header and token of a message followed by its encoded options and payload.
+ *
+ * @details Adapts \ref coap_message_header_encode to \ref coap_transport_encode_t.
+ */
+static uint32_t message_body_encode(void * p_context, uint8_t * p_buffer, uint16_t * p_length)
+{
+    message_body_t * p_body     = (message_body_t *)p_context;
+    uint16_t         header_len = *p_length;
+
+    uint32_t err_code = coap_message_header_encode(p_body->p_message, p_buffer, &header_len);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    if ((*p_length - header_len) < p_body->body_len)
+    {
+        return (NRF_ERROR_DATA_SIZE | IOT_COAP_ERR_BASE);
+    }
+
+    memcpy(&p_buffer[header_len], p_body->p_body, p_body->body_len);
+    *p_length = header_len + p_body->body_len;
+
+    return NRF_SUCCESS;
+}
+
+uint32_t internal_coap_message_body_send(uint32_t *       p_handle,
+                                         coap_message_t * p_message,
+                                         const uint8_t *  p_body,
+                                         uint16_t         body_len)
+{
+    if (p_message == NULL)
+    {
+        return (NRF_ERROR_NULL | IOT_COAP_ERR_BASE);
+    }
+
+    COAP_ENTRY();
+
+    // Fetch the expected length of the header and token by passing length of 0.
+    uint16_t header_len = 0;
+    uint32_t err_code   = coap_message_header_encode(p_message, NULL, &header_len);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    message_body_t body =
+    {
+        .p_message = p_message,
+        .p_body    = p_body,
+        .body_len  = body_len
+    };
+
+    return message_transmit(p_handle, p_message, header_len + body_len, message_body_encode, &body);
+}
 
 static uint32_t create_response(coap_message_t ** pp_response, coap_message_t * p_request, uint16_t data_size)
 {
@@ -620,20 +723,32 @@ uint32_t coap_transport_read(const coap_port_t    * p_port,
         else
         {
             uint8_t * uri_pointers[COAP_RESOURCE_MAX_DEPTH] = {0, };
+            uint16_t  uri_lengths[COAP_RESOURCE_MAX_DEPTH]  = {0, };
 
             uint8_t  uri_path_count = 0;
             uint16_t index;
+            bool     too_deep       = false;
 
             for (index = 0; index < p_message->options_count; index++)
             {
                 if (p_message->options[index].number == COAP_OPT_URI_PATH)
                 {
-                    uri_pointers[uri_path_count++] = p_message->options[index].p_data;
+                    if (uri_path_count == COAP_RESOURCE_MAX_DEPTH)
+                    {
+                        // No resource can be located this deep.
+                        too_deep = true;
+                        break;
+                    }
+                    uri_pointers[uri_path_count]  = p_message->options[index].p_data;
+                    uri_lengths[uri_path_count++] = p_message->options[index].length;
                 }
             }
 
-            coap_resource_t * found_resource;
-            err_code = coap_resource_get(&found_resource, uri_pointers, uri_path_count);
+            coap_resource_t * found_resource = NULL;
+            if (!too_deep)
+            {
+                err_code = coap_resource_get(&found_resource, uri_pointers, uri_lengths, uri_path_count);
+            }
 
             if (found_resource != NULL)
             {
@@ -691,6 +806,11 @@ uint32_t coap_message_abort(uint32_t handle)
     return NRF_ERROR_NOT_SUPPORTED;
 }
 
+uint16_t internal_coap_message_id_new(void)
+{
+    return (uint16_t)m_message_id_counter++;
+}
+
 uint32_t coap_message_new(coap_message_t ** p_request, coap_message_conf_t * p_config)
 {
     COAP_ENTRY();
@@ -738,7 +858,7 @@ uint32_t coap_message_new(coap_message_t ** p_request, coap_message_conf_t * p_c
 
     if (p_config->id == 0) // Message id is not set, generate one.
     {
-        p_config->id = m_message_id_counter++;
+        p_config->id = internal_coap_message_id_new();
     }
 
     err_code = coap_message_create(*p_request, p_config);
@@ -779,47 +899,42 @@ uint32_t coap_time_tick(void)
 
     coap_transport_process();
 
-    // Loop through the message queue to see if any packets needs retransmission, or has timed out.
+    coap_queue_tick();
+
+    // Handle the packets in the message queue that need retransmission, or have timed out.
     coap_queue_item_t * p_item = NULL;
-    while (coap_queue_item_next_get(&p_item, p_item) == NRF_SUCCESS)
+    while (coap_queue_item_expired_get(&p_item) == NRF_SUCCESS)
     {
-        if (p_item->timeout == 0)
+        // If there is still retransmission attempts left.
+        if (p_item->retrans_count < COAP_MAX_RETRANSMIT_COUNT)
         {
-            // If there is still retransmission attempts left.
-            if (p_item->retrans_count < COAP_MAX_RETRANSMIT_COUNT)
-            {
-                p_item->timeout     = p_item->timeout_val * 2;
-                p_item->timeout_val = p_item->timeout;
-                p_item->retrans_count++;
+            p_item->timeout_val = p_item->timeout_val * 2;
+            p_item->retrans_count++;
+            (void)coap_queue_item_timeout_set(p_item, p_item->timeout_val);
 
-                // Retransmit the message.
-                uint32_t err_code = coap_transport_write(&p_item->port, &p_item->remote, p_item->p_buffer, p_item->buffer_len);
-                if (err_code != NRF_SUCCESS)
-                {
-                    app_error_notify(err_code, NULL);
-                }
+            // Retransmit the message.
+            uint32_t err_code = coap_transport_write(&p_item->port, &p_item->remote, p_item->p_buffer, p_item->buffer_len);
+            if (err_code != NRF_SUCCESS)
+            {
+                app_error_notify(err_code, NULL);
             }
+        }
 
-            // No more retransmission attempts left, or max transmit span reached.
-            if ((p_item->timeout > COAP_MAX_TRANSMISSION_SPAN) ||
-                (p_item->retrans_count >= COAP_MAX_RETRANSMIT_COUNT))
-            {
+        // No more retransmission attempts left, or max transmit span reached.
+        if ((p_item->timeout > COAP_MAX_TRANSMISSION_SPAN) ||
+            (p_item->retrans_count >= COAP_MAX_RETRANSMIT_COUNT))
+        {
 
-                COAP_MUTEX_UNLOCK();
+            COAP_MUTEX_UNLOCK();
 
-                p_item->callback(COAP_TRANSMISSION_TIMEOUT, p_item->p_arg, NULL);
+            p_item->callback(COAP_TRANSMISSION_TIMEOUT, p_item->p_arg, NULL);
 
-                COAP_MUTEX_LOCK();
+            COAP_MUTEX_LOCK();
 
-                COAP_TRC("Free mem, p_item->p_buffer = %p", p_item->p_buffer);
-                UNUSED_VARIABLE(nrf_free(p_item->p_buffer));
+            COAP_TRC("Free mem, p_item->p_buffer = %p", p_item->p_buffer);
+            UNUSED_VARIABLE(nrf_free(p_item->p_buffer));
 
-                (void)coap_queue_remove(p_item);
-            }
-        }
-        else
-        {
-            p_item->timeout--;
+            (void)coap_queue_remove(p_item);
         }
     }
 
@@ -844,6 +959,35 @@ __WEAK void coap_transport_input(void)
     // By default not implemented. Transport specific.
 }
 
+__WEAK uint32_t coap_transport_encode_write(const coap_port_t       * p_port,
+                                            const coap_remote_t     * p_remote,
+                                            uint16_t                  datalen,
+                                            coap_transport_encode_t   encode,
+                                            void                    * p_context)
+{
+    // By default serialize into a temporary buffer which the transport copies from.
+    uint8_t * p_buffer;
+    uint32_t  buffer_size = datalen;
+
+    uint32_t err_code = nrf_mem_reserve(&p_buffer, &buffer_size);
+    if (err_code != NRF_SUCCESS)
+    {
+        COAP_TRC("p_buffer alloc error = 0x%08lX!", err_code);
+        return err_code;
+    }
+
+    uint16_t buffer_length = (uint16_t)buffer_size;
+    err_code = encode(p_context, p_buffer, &buffer_length);
+    if (err_code == NRF_SUCCESS)
+    {
+        err_code = coap_transport_write(p_port, p_remote, p_buffer, buffer_length);
+    }
+
+    UNUSED_VARIABLE(nrf_free(p_buffer));
+
+    return err_code;
+}
+
 void coap_input(void)
 {
     COAP_MUTEX_LOCK();
@@ -116,6 +116,31 @@ SDK_MUTEX_DEFINE(m_coap_mutex)
  */
 uint32_t internal_coap_message_send(uint32_t * p_handle, coap_message_t * p_message);
 
+/**@brief Sends a CoAP message with options and payload encoded in advance.
+ *
+ * @details Only the header and token of p_message are encoded, the options and payload are
+ *          taken from p_body as encoded by \ref coap_message_body_encode. This lets the same
+ *          options and payload be sent to several remotes while encoding them once.
+ *
+ * @param[out] p_handle  Handle to the message if CoAP CON/ACK messages has been used. Returned
+ *                       by reference.
+ * @param[in]  p_message Message to be sent.
+ * @param[in]  p_body    Encoded options and payload of the message.
+ * @param[in]  body_len  Length of the encoded options and payload.
+ *
+ * @retval NRF_SUCCESS If the message was successfully encoded and scheduled for transmission.
+ */
+uint32_t internal_coap_message_body_send(uint32_t *       p_handle,
+                                         coap_message_t * p_message,
+                                         const uint8_t *  p_body,
+                                         uint16_t         body_len);
+
+/**@brief Generates a new message ID.
+ *
+ * @return The next value of the message ID counter.
+ */
+uint16_t internal_coap_message_id_new(void);
+
 #ifdef __cplusplus
 }
 #endif
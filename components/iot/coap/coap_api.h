@@ -291,6 +291,8 @@ struct coap_resource_t
     uint32_t                 ct_support_mask;                     /**< Bitmask to tell which content types are supported by the resource. Bit values available can be seen in \ref COAP_CONTENT_TYPE_MASK. */
     uint32_t                 max_age;                             /**< Max age of resource endpoint value. */
     uint32_t                 expire_time;                         /**< Number of seconds until expire. */
+    uint16_t                 name_hash;                           /**< Internal. Hash of the resource name, used for resolving paths. */
+    uint8_t                  name_len;                            /**< Internal. Length of the resource name. */
     char                     name[COAP_RESOURCE_MAX_NAME_LEN+1];  /**< Name of the resource. Must be zero terminated. */
 };
 
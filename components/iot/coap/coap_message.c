@@ -341,49 +341,43 @@ uint32_t coap_message_decode(coap_message_t *       p_message,
 }
 
 
-uint32_t coap_message_encode(coap_message_t * p_message,
-                             uint8_t *        p_buffer,
-                             uint16_t *       p_length)
+/**@brief Calculate the size of the encoded header and token of a message.
+ *
+ * @param[in] p_message Message to calculate the size of.
+ *
+ * @return Size of the encoded header and token.
+ */
+static uint16_t header_size_get(coap_message_t * p_message)
 {
-    NULL_PARAM_CHECK(p_length);
-    NULL_PARAM_CHECK(p_message);
+    return 4 + p_message->header.token_len;
+}
 
-    // calculated size
-    uint16_t total_packet_size = 4;
+/**@brief Calculate the size of the encoded options and payload of a message.
+ *
+ * @param[in] p_message Message to calculate the size of.
+ *
+ * @return Size of the encoded options and payload, including the payload marker.
+ */
+static uint16_t body_size_get(coap_message_t * p_message)
+{
+    uint16_t size = p_message->options_len;
 
     if (p_message->payload_len > 0)
     {
-        total_packet_size += p_message->payload_len;
-        total_packet_size += COAP_PAYLOAD_MARKER_SIZE;
-    }
-
-    if (p_message->header.token_len > 8)
-    {
-        return (NRF_ERROR_INVALID_DATA | IOT_COAP_ERR_BASE);
+        size += p_message->payload_len;
+        size += COAP_PAYLOAD_MARKER_SIZE;
     }
-    total_packet_size += p_message->header.token_len;
-    total_packet_size += p_message->options_len;
 
-    // If this was a length check, return after setting the length in the output parameter.
-    if (*p_length == 0)
-    {
-        *p_length = total_packet_size;
-        return NRF_SUCCESS;
-    }
-
-    // Check that the buffer provided is sufficient.
-    if (*p_length < total_packet_size)
-    {
-        return (NRF_ERROR_DATA_SIZE | IOT_COAP_ERR_BASE);
-    }
-
-    if (((p_message->payload_len > 0 && p_message->p_payload == NULL)) ||
-        (p_buffer ==  NULL))
-    {
-        return COAP_MESSAGE_ERROR_NULL;
-    }
+    return size;
+}
 
-    // Start filling the bytes.
+/**@brief Write the header and token of a message.
+ *
+ * @param[in] p_message Message to encode.
+ * @param[in] p_buffer  Buffer large enough to hold the encoded header and token.
+ */
+static void header_write(coap_message_t * p_message, uint8_t * p_buffer)
+{
     uint16_t byte_index = 0;
 
     // TODO: Verify the values of the header fields.
@@ -402,7 +396,22 @@ uint32_t coap_message_encode(coap_message_t * p_message,
     p_buffer[byte_index++] = (p_message->header.id & 0x00FF);
 
     memcpy(&p_buffer[byte_index], p_message->token, p_message->header.token_len);
-    byte_index += p_message->header.token_len;
+}
+
+/**@brief Write the options and payload of a message.
+ *
+ * @details The buffer is not cleared before writing, so the encoded options must fill exactly
+ *          the options length of the message.
+ *
+ * @param[in] p_message Message to encode.
+ * @param[in] p_buffer  Buffer large enough to hold the encoded options and payload.
+ *
+ * @retval NRF_SUCCESS If the options and payload were written. Otherwise, an error code that
+ *                     indicates the reason for the failure is returned.
+ */
+static uint32_t body_write(coap_message_t * p_message, uint8_t * p_buffer)
+{
+    uint16_t byte_index = 0;
 
     //memcpy(&p_buffer[byte_index], &p_message->p_data[0], p_message->options_len);
     for (uint8_t i = 0; i < p_message->options_count; i++)
@@ -411,14 +420,16 @@ uint32_t coap_message_encode(coap_message_t * p_message,
 
         uint16_t byte_count = 0;
         err_code = encode_option(&p_buffer[byte_index], &p_message->options[i], &byte_count);
-        if (err_code == NRF_SUCCESS)
-        {
-            byte_index += byte_count;
-        }
-        else
+        if (err_code != NRF_SUCCESS)
         {
-            // Throw an error.
+            return err_code;
         }
+        byte_index += byte_count;
+    }
+
+    if (byte_index != p_message->options_len)
+    {
+        return (NRF_ERROR_INVALID_DATA | IOT_COAP_ERR_BASE);
     }
 
     if (p_message->payload_len > 0 && p_message->p_payload != NULL)
@@ -427,11 +438,135 @@ uint32_t coap_message_encode(coap_message_t * p_message,
         memcpy(&p_buffer[byte_index], p_message->p_payload, p_message->payload_len);
     }
 
+    return NRF_SUCCESS;
+}
+
+uint32_t coap_message_encode(coap_message_t * p_message,
+                             uint8_t *        p_buffer,
+                             uint16_t *       p_length)
+{
+    NULL_PARAM_CHECK(p_length);
+    NULL_PARAM_CHECK(p_message);
+
+    if (p_message->header.token_len > 8)
+    {
+        return (NRF_ERROR_INVALID_DATA | IOT_COAP_ERR_BASE);
+    }
+
+    // calculated size
+    uint16_t header_size       = header_size_get(p_message);
+    uint16_t total_packet_size = header_size + body_size_get(p_message);
+
+    // If this was a length check, return after setting the length in the output parameter.
+    if (*p_length == 0)
+    {
+        *p_length = total_packet_size;
+        return NRF_SUCCESS;
+    }
+
+    // Check that the buffer provided is sufficient.
+    if (*p_length < total_packet_size)
+    {
+        return (NRF_ERROR_DATA_SIZE | IOT_COAP_ERR_BASE);
+    }
+
+    if (((p_message->payload_len > 0 && p_message->p_payload == NULL)) ||
+        (p_buffer ==  NULL))
+    {
+        return COAP_MESSAGE_ERROR_NULL;
+    }
+
+    header_write(p_message, p_buffer);
+
+    uint32_t err_code = body_write(p_message, &p_buffer[header_size]);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
     *p_length = total_packet_size;
 
     return NRF_SUCCESS;
 }
 
+uint32_t coap_message_header_encode(coap_message_t * p_message,
+                                    uint8_t *        p_buffer,
+                                    uint16_t *       p_length)
+{
+    NULL_PARAM_CHECK(p_length);
+    NULL_PARAM_CHECK(p_message);
+
+    if (p_message->header.token_len > 8)
+    {
+        return (NRF_ERROR_INVALID_DATA | IOT_COAP_ERR_BASE);
+    }
+
+    uint16_t header_size = header_size_get(p_message);
+
+    // If this was a length check, return after setting the length in the output parameter.
+    if (*p_length == 0)
+    {
+        *p_length = header_size;
+        return NRF_SUCCESS;
+    }
+
+    // Check that the buffer provided is sufficient.
+    if (*p_length < header_size)
+    {
+        return (NRF_ERROR_DATA_SIZE | IOT_COAP_ERR_BASE);
+    }
+
+    if (p_buffer == NULL)
+    {
+        return COAP_MESSAGE_ERROR_NULL;
+    }
+
+    header_write(p_message, p_buffer);
+
+    *p_length = header_size;
+
+    return NRF_SUCCESS;
+}
+
+uint32_t coap_message_body_encode(coap_message_t * p_message,
+                                  uint8_t *        p_buffer,
+                                  uint16_t *       p_length)
+{
+    NULL_PARAM_CHECK(p_length);
+    NULL_PARAM_CHECK(p_message);
+
+    uint16_t body_size = body_size_get(p_message);
+
+    // If this was a length check, return after setting the length in the output parameter.
+    if (*p_length == 0)
+    {
+        *p_length = body_size;
+        return NRF_SUCCESS;
+    }
+
+    // Check that the buffer provided is sufficient.
+    if (*p_length < body_size)
+    {
+        return (NRF_ERROR_DATA_SIZE | IOT_COAP_ERR_BASE);
+    }
+
+    if (((p_message->payload_len > 0 && p_message->p_payload == NULL)) ||
+        (p_buffer ==  NULL))
+    {
+        return COAP_MESSAGE_ERROR_NULL;
+    }
+
+    uint32_t err_code = body_write(p_message, p_buffer);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    *p_length = body_size;
+
+    return NRF_SUCCESS;
+}
+
 uint32_t coap_message_opt_empty_add(coap_message_t * p_message, uint16_t option_num)
 {
     OPTION_INDEX_AVAIL_CHECK(p_message->options_count);
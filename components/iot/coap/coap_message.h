@@ -81,6 +81,10 @@ uint32_t coap_message_create(coap_message_t * p_message, coap_message_conf_t * p
  *          be decoded into a CoAP message type structure. This functions returns
  *          a decoded message if decoding was successfully, or NULL otherwise.
  *
+ *          Nothing is copied except for the token. The option values and the payload of the
+ *          decoded message point into p_raw_message, which must be kept for as long as the
+ *          message is in use.
+ *
  * @param[out] p_message     The generated coap_message_t after decoding the raw message.
  * @param[in]  p_raw_message Pointer to the encoded message memory buffer.
  * @param[in]  message_len   Length of the p_raw_message.
@@ -120,6 +124,8 @@ uint32_t coap_message_decode(coap_message_t * p_message,
  * @retval NRF_ERROR_NULL          If message or length parameter is NULL pointer.
  * @retval NRF_ERROR_NO_MEM        If the provided buffer is not sufficient for
  *                                 the encoded message.
+ * @retval NRF_ERROR_INVALID_DATA  If an option could not be encoded, or the encoded options
+ *                                 do not match the options length of the message.
  * @retval COAP_MESSAGE_ERROR_NULL If the message has indicated the length of data,
  *                                 but memory pointer is NULL.
  */
@@ -127,6 +133,50 @@ uint32_t coap_message_encode(coap_message_t * p_message,
                              uint8_t *        p_buffer,
                              uint16_t *       p_length);
 
+/**@brief Encode the header and token of a CoAP message into a byte buffer.
+ *
+ * @details Together with \ref coap_message_body_encode this splits \ref coap_message_encode
+ *          in two, so that options and payload shared by several messages can be encoded once
+ *          and only the header and token encoded per message.
+ *
+ * @param[in]    p_message Message to encode.
+ * @param[in]    p_buffer  Pointer to the byte buffer where to put the encoded header and token.
+ * @param[inout] p_length  Length of the provided byte buffer passed in by reference.
+ *                         If the value 0 is supplied, only the expected length is calculated.
+ *
+ * @retval NRF_SUCCESS             If the encoding of the header succeeds.
+ * @retval NRF_ERROR_NULL          If message or length parameter is NULL pointer.
+ * @retval NRF_ERROR_INVALID_DATA  If the token length is larger than 8.
+ * @retval NRF_ERROR_DATA_SIZE     If the provided buffer is not sufficient for the header.
+ * @retval COAP_MESSAGE_ERROR_NULL If the buffer is NULL.
+ */
+uint32_t coap_message_header_encode(coap_message_t * p_message,
+                                    uint8_t *        p_buffer,
+                                    uint16_t *       p_length);
+
+/**@brief Encode the options and payload of a CoAP message into a byte buffer.
+ *
+ * @details The encoded options and payload follow the header and token encoded by
+ *          \ref coap_message_header_encode.
+ *
+ * @param[in]    p_message Message to encode.
+ * @param[in]    p_buffer  Pointer to the byte buffer where to put the encoded options and payload.
+ * @param[inout] p_length  Length of the provided byte buffer passed in by reference.
+ *                         If the value 0 is supplied, only the expected length is calculated.
+ *
+ * @retval NRF_SUCCESS             If the encoding of the options and payload succeeds.
+ * @retval NRF_ERROR_NULL          If message or length parameter is NULL pointer.
+ * @retval NRF_ERROR_DATA_SIZE     If the provided buffer is not sufficient for the options and
+ *                                 payload.
+ * @retval NRF_ERROR_INVALID_DATA  If an option could not be encoded, or the encoded options
+ *                                 do not match the options length of the message.
+ * @retval COAP_MESSAGE_ERROR_NULL If the message has indicated the length of data,
+ *                                 but memory pointer is NULL.
+ */
+uint32_t coap_message_body_encode(coap_message_t * p_message,
+                                  uint8_t *        p_buffer,
+                                  uint16_t *       p_length);
+
 /**@brief Get the content format mask of the message.
  *
  * @param[in]  p_message Pointer to the message which to generate the content format mask from.
@@ -46,6 +46,7 @@
 #include "sdk_common.h"
 #include "sdk_config.h"
 #include "coap.h"
+#include "mem_manager.h"
 
 #if IOT_COAP_CONFIG_LOG_ENABLED
 
@@ -234,6 +235,82 @@ uint32_t internal_coap_observe_server_get(uint32_t handle, coap_observer_t ** pp
     *pp_observer = &m_observers[handle];
     return NRF_SUCCESS;
 }
+
+uint32_t internal_coap_observe_server_notify_all(coap_message_t *    p_message,
+                                                 coap_resource_t *   p_resource,
+                                                 coap_content_type_t ct)
+{
+    COAP_ENTRY();
+
+    NULL_PARAM_CHECK(p_message);
+    NULL_PARAM_CHECK(p_resource);
+
+    // Encode the options and payload once, they are the same for all observers.
+    uint16_t  body_len = 0;
+    uint8_t * p_body   = NULL;
+    uint32_t  err_code = coap_message_body_encode(p_message, NULL, &body_len);
+    if (err_code != NRF_SUCCESS)
+    {
+        return err_code;
+    }
+
+    if (body_len > 0)
+    {
+        uint32_t size = body_len;
+        err_code = nrf_mem_reserve(&p_body, &size);
+        if (err_code != NRF_SUCCESS)
+        {
+            return err_code;
+        }
+
+        err_code = coap_message_body_encode(p_message, p_body, &body_len);
+        if (err_code != NRF_SUCCESS)
+        {
+            UNUSED_VARIABLE(nrf_free(p_body));
+            return err_code;
+        }
+    }
+
+    // A failed notification does not stop the others, the first error is returned.
+    uint32_t first_err_code = NRF_SUCCESS;
+
+    for (uint32_t i = 0; i < COAP_OBSERVE_MAX_NUM_OBSERVERS; i++)
+    {
+        coap_observer_t * p_observer = &m_observers[i];
+
+        if ((p_observer->p_resource_of_interest != p_resource) || (p_observer->ct != ct))
+        {
+            continue;
+        }
+
+        // Only the header, the token and the remote differ between the notifications.
+        memcpy(p_message->token, p_observer->token, p_observer->token_len);
+        memcpy(&p_message->remote, &p_observer->remote, sizeof(coap_remote_t));
+        p_message->header.token_len = p_observer->token_len;
+        p_message->header.id        = internal_coap_message_id_new();
+        p_message->p_arg            = p_observer;
+
+        uint32_t handle;
+        err_code = internal_coap_message_body_send(&handle, p_message, p_body, body_len);
+        if (err_code != NRF_SUCCESS)
+        {
+            COAP_TRC("Notification to observer %i failed, error: 0x%08lX", i, err_code);
+            if (first_err_code == NRF_SUCCESS)
+            {
+                first_err_code = err_code;
+            }
+        }
+    }
+
+    if (p_body != NULL)
+    {
+        UNUSED_VARIABLE(nrf_free(p_body));
+    }
+
+    COAP_EXIT();
+
+    return first_err_code;
+}
 #else
 #define observe_server_init(...)
 #endif
@@ -626,6 +703,19 @@ uint32_t coap_observe_server_get(uint32_t handle, coap_observer_t ** pp_observer
     return err_code;
 }
 
+uint32_t coap_observe_server_notify_all(coap_message_t *    p_message,
+                                        coap_resource_t *   p_resource,
+                                        coap_content_type_t ct)
+{
+    COAP_MUTEX_LOCK();
+
+    uint32_t err_code = internal_coap_observe_server_notify_all(p_message, p_resource, ct);
+
+    COAP_MUTEX_UNLOCK();
+
+    return err_code;
+}
+
 #endif // COAP_ENABLE_OBSERVE_SERVER = 1
 
 #if (COAP_ENABLE_OBSERVE_CLIENT == 1)
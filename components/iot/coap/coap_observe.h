@@ -122,6 +122,17 @@ uint32_t internal_coap_observe_server_next_get(coap_observer_t ** pp_observer, c
  */
 uint32_t internal_coap_observe_server_get(uint32_t handle, coap_observer_t ** pp_observer);
 
+/**@brief Send a notification to all observers of a resource.
+ *
+ * @param[in] p_message  Notification to send. Should not be NULL.
+ * @param[in] p_resource Pointer to the resource of interest. Should not be NULL.
+ * @param[in] ct         Content type of the payload.
+ *
+ * @retval NRF_SUCCESS                   If the notification was sent to all observers.
+ * @retval NRF_ERROR_NULL                If p_message or p_resource pointer is NULL.
+ */
+uint32_t internal_coap_observe_server_notify_all(coap_message_t * p_message, coap_resource_t * p_resource, coap_content_type_t ct);
+
 /**@brief Register a new observable resource.
  *
  * @param[out]   p_handle     Handle to the observable resource instance registered. Returned by
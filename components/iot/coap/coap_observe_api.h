@@ -144,6 +144,33 @@ uint32_t coap_observe_server_next_get(coap_observer_t ** pp_observer, coap_obser
  */
 uint32_t coap_observe_server_get(uint32_t handle, coap_observer_t ** pp_observer);
 
+/**@brief Send a notification to all observers of a resource.
+ *
+ * @details The options and payload of p_message are encoded once and shared by the
+ *          notifications. For each observer of p_resource with a matching content type,
+ *          the token and remote of the observer and a new message ID are set in p_message
+ *          before only the header and token are encoded. The p_arg of each notification is
+ *          set to the observer it is sent to, so that the response callback of a confirmable
+ *          notification can unregister the observer.
+ *
+ *          The Observe option of p_message is sent with the same value to all observers.
+ *          The application should increment it for each notification of the resource.
+ *
+ *          If sending to an observer fails, the remaining observers are still notified and the
+ *          error of the first failed notification is returned.
+ *
+ * @param[inout] p_message  Notification to send, created with \ref coap_message_new including
+ *                          its options and payload. Token, remote, message ID and p_arg are
+ *                          overwritten. Should not be NULL.
+ * @param[in]    p_resource Pointer to the resource of interest. Should not be NULL.
+ * @param[in]    ct         Content type of the payload. Only observers which requested this
+ *                          content type are notified.
+ *
+ * @retval NRF_SUCCESS                   If the notification was sent to all observers.
+ * @retval NRF_ERROR_NULL                If p_message or p_resource pointer is NULL.
+ */
+uint32_t coap_observe_server_notify_all(coap_message_t * p_message, coap_resource_t * p_resource, coap_content_type_t ct);
+
 /**@brief Register a new observable resource.
  *
  * @param[out]   p_handle     Handle to the observable resource instance registered. Returned by
@@ -57,17 +57,233 @@
 
 #endif // COAP_DISABLE_API_PARAM_CHECK
 
+#define INDEX_SIZE      (2 * COAP_MESSAGE_QUEUE_SIZE)  /**< Number of entries in a lookup table. Keeps the load factor at most 0.5. */
+#define INVALID_SLOT    0xFFFF                         /**< Marks an empty lookup table entry or an item not in the timeout heap. */
+
+#if (COAP_MESSAGE_QUEUE_SIZE >= INVALID_SLOT)
+#error "COAP_MESSAGE_QUEUE_SIZE must be less than 65535."
+#endif
+
+/**@brief Function for getting the home position of an item in a lookup table. */
+typedef uint32_t (* index_home_t)(uint16_t slot);
+
 static coap_queue_item_t m_queue[COAP_MESSAGE_QUEUE_SIZE];
-static uint8_t           m_message_queue_count = 0;
+static uint16_t          m_message_queue_count = 0;
+
+/* Open addressing (linear probing) lookup tables with indexes of queued items. Items without
+ * a token are not added to the token table. */
+static uint16_t          m_mid_index[INDEX_SIZE];
+static uint16_t          m_token_index[INDEX_SIZE];
+
+/* Binary min-heap of queued items ordered by the time of their next timeout. */
+static uint16_t          m_heap[COAP_MESSAGE_QUEUE_SIZE];
+static uint16_t          m_heap_pos[COAP_MESSAGE_QUEUE_SIZE];   /**< Position of each item in the heap, INVALID_SLOT if the slot is free. */
+static uint32_t          m_deadline[COAP_MESSAGE_QUEUE_SIZE];   /**< Queue time of the next timeout of each item. */
+static uint32_t          m_time;                                /**< Queue time, in ticks. */
+
+/* Stack of free slots. */
+static uint16_t          m_free[COAP_MESSAGE_QUEUE_SIZE];
+
+
+/**@brief Function for mapping a 32-bit hash to a lookup table position. */
+static __INLINE uint32_t index_pos(uint32_t hash)
+{
+    return (uint32_t)(((uint64_t)hash * INDEX_SIZE) >> 32);
+}
+
+
+static __INLINE uint32_t index_next(uint32_t pos)
+{
+    return (pos + 1 == INDEX_SIZE) ? 0 : pos + 1;
+}
+
+
+static __INLINE uint32_t mid_hash(uint16_t mid)
+{
+    return (uint32_t)mid * 0x9E3779B1UL;
+}
+
+
+static uint32_t token_hash(uint8_t const * p_token, uint8_t token_len)
+{
+    uint32_t hash = 0x811C9DC5UL;
+
+    for (uint8_t i = 0; i < token_len; i++)
+    {
+        hash = (hash ^ p_token[i]) * 0x01000193UL;
+    }
+
+    return (hash ^ token_len) * 0x9E3779B1UL;
+}
+
+
+static uint32_t mid_home(uint16_t slot)
+{
+    return index_pos(mid_hash(m_queue[slot].mid));
+}
+
+
+static uint32_t token_home(uint16_t slot)
+{
+    return index_pos(token_hash(m_queue[slot].token, m_queue[slot].token_len));
+}
+
+
+static void index_insert(uint16_t * p_index, uint32_t pos, uint16_t slot)
+{
+    while (p_index[pos] != INVALID_SLOT)
+    {
+        pos = index_next(pos);
+    }
+    p_index[pos] = slot;
+}
+
+
+/**@brief Function for removing an item from a lookup table.
+ *
+ * @details Entries following the removed one are shifted back to close the gap, so that lookups
+ *          never need to probe past deleted entries.
+ */
+static void index_remove(uint16_t * p_index, index_home_t home_get, uint16_t slot)
+{
+    uint32_t hole = home_get(slot);
+    uint32_t pos;
+
+    while (p_index[hole] != slot)
+    {
+        hole = index_next(hole);
+    }
+
+    for (pos = index_next(hole); p_index[pos] != INVALID_SLOT; pos = index_next(pos))
+    {
+        uint32_t home = home_get(p_index[pos]);
+
+        // Entry can fill the hole unless its home position lies cyclically in (hole, pos].
+        if (((pos + INDEX_SIZE - home) % INDEX_SIZE) >= ((pos + INDEX_SIZE - hole) % INDEX_SIZE))
+        {
+            p_index[hole] = p_index[pos];
+            hole          = pos;
+        }
+    }
+
+    p_index[hole] = INVALID_SLOT;
+}
+
+
+static __INLINE bool deadline_before(uint16_t slot_a, uint16_t slot_b)
+{
+    return ((int32_t)(m_deadline[slot_a] - m_deadline[slot_b]) < 0);
+}
+
+
+static __INLINE void heap_set(uint16_t pos, uint16_t slot)
+{
+    m_heap[pos]      = slot;
+    m_heap_pos[slot] = pos;
+}
+
+
+static void heap_sift_up(uint16_t pos)
+{
+    uint16_t slot = m_heap[pos];
+
+    while (pos > 0)
+    {
+        uint16_t parent = (pos - 1) / 2;
+
+        if (!deadline_before(slot, m_heap[parent]))
+        {
+            break;
+        }
+        heap_set(pos, m_heap[parent]);
+        pos = parent;
+    }
+    heap_set(pos, slot);
+}
+
+
+static void heap_sift_down(uint16_t pos)
+{
+    uint16_t slot = m_heap[pos];
+
+    for (;;)
+    {
+        uint32_t child = (2 * (uint32_t)pos) + 1;
+
+        if (child >= m_message_queue_count)
+        {
+            break;
+        }
+        if ((child + 1 < m_message_queue_count) && deadline_before(m_heap[child + 1], m_heap[child]))
+        {
+            child++;
+        }
+        if (!deadline_before(m_heap[child], slot))
+        {
+            break;
+        }
+        heap_set(pos, m_heap[child]);
+        pos = (uint16_t)child;
+    }
+    heap_set(pos, slot);
+}
+
+
+/**@brief Function for restoring the heap order after the deadline of an item has changed. */
+static void heap_update(uint16_t pos)
+{
+    if (COAP_MESSAGE_QUEUE_SIZE == 1)
+    {
+        // A single item is always in order. Also keeps GCC from warning about heap accesses
+        // past the only entry, which it cannot see are never made.
+        return;
+    }
+    if ((pos > 0) && deadline_before(m_heap[pos], m_heap[(pos - 1) / 2]))
+    {
+        heap_sift_up(pos);
+    }
+    else
+    {
+        heap_sift_down(pos);
+    }
+}
+
+
+/**@brief Function for getting the slot of a queued item, or INVALID_SLOT if the item is not queued. */
+static uint16_t slot_get(coap_queue_item_t const * p_item)
+{
+    if ((p_item < &m_queue[0]) || (p_item >= &m_queue[COAP_MESSAGE_QUEUE_SIZE]))
+    {
+        return INVALID_SLOT;
+    }
+
+    uint16_t slot = (uint16_t)(p_item - m_queue);
+
+    if ((p_item != &m_queue[slot]) || (m_heap_pos[slot] == INVALID_SLOT))
+    {
+        return INVALID_SLOT;
+    }
+
+    return slot;
+}
+
 
 uint32_t coap_queue_init(void)
 {
-    for (uint8_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
+    for (uint16_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
     {
         memset(&m_queue[i], 0, sizeof(coap_queue_item_t));
         m_queue[i].handle = i;
+        m_heap_pos[i]     = INVALID_SLOT;
+        m_free[i]         = COAP_MESSAGE_QUEUE_SIZE - 1 - i;
+    }
+    for (uint32_t i = 0; i < INDEX_SIZE; i++)
+    {
+        m_mid_index[i]   = INVALID_SLOT;
+        m_token_index[i] = INVALID_SLOT;
     }
     m_message_queue_count = 0;
+    m_time                = 0;
 
     return NRF_SUCCESS;
 }
@@ -80,52 +296,78 @@ uint32_t coap_queue_add(coap_queue_item_t * item)
     {
        return (NRF_ERROR_NO_MEM | IOT_COAP_ERR_BASE);
     }
-    else
-    {
-        for (uint8_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
-        {
-            if (m_queue[i].p_buffer == NULL)
-            {
-                // Free spot in message queue. Add message here...
-                memcpy(&m_queue[i], item, sizeof(coap_queue_item_t));
 
-                m_message_queue_count++;
+    // Free spot in message queue. Add message here...
+    uint16_t slot = m_free[COAP_MESSAGE_QUEUE_SIZE - 1 - m_message_queue_count];
 
-                return NRF_SUCCESS;
-            }
-        }
+    item->handle = slot;
+    memcpy(&m_queue[slot], item, sizeof(coap_queue_item_t));
 
+    index_insert(m_mid_index, mid_home(slot), slot);
+    if (item->token_len != 0)
+    {
+        index_insert(m_token_index, token_home(slot), slot);
     }
-    return (NRF_ERROR_DATA_SIZE | IOT_COAP_ERR_BASE);
+
+    // Timeout expires after the given number of ticks have passed since this one.
+    m_deadline[slot] = m_time + item->timeout + 1;
+    heap_set(m_message_queue_count, slot);
+    m_message_queue_count++;
+    heap_sift_up(m_heap_pos[slot]);
+
+    return NRF_SUCCESS;
 }
 
 uint32_t coap_queue_remove(coap_queue_item_t * p_item)
 {
-    for (uint8_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
+    uint16_t slot = slot_get(p_item);
+
+    if (slot == INVALID_SLOT)
     {
-        if (p_item == (coap_queue_item_t *)&m_queue[i])
-        {
-            memset(&m_queue[i], 0, sizeof(coap_queue_item_t));
-            m_message_queue_count--;
-            return NRF_SUCCESS;
-        }
+        return (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE);
     }
 
-    return (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE);
+    index_remove(m_mid_index, mid_home, slot);
+    if (m_queue[slot].token_len != 0)
+    {
+        index_remove(m_token_index, token_home, slot);
+    }
+
+    uint16_t pos = m_heap_pos[slot];
+
+    m_message_queue_count--;
+    if (pos != m_message_queue_count)
+    {
+        heap_set(pos, m_heap[m_message_queue_count]);
+        heap_update(pos);
+    }
+    m_heap_pos[slot] = INVALID_SLOT;
+
+    memset(&m_queue[slot], 0, sizeof(coap_queue_item_t));
+    m_queue[slot].handle = slot;
+    m_free[COAP_MESSAGE_QUEUE_SIZE - 1 - m_message_queue_count] = slot;
+
+    return NRF_SUCCESS;
 }
 
 uint32_t coap_queue_item_by_token_get(coap_queue_item_t ** pp_item, uint8_t * p_token, uint8_t token_len)
 {
-    for (uint8_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
+    if (token_len == 0)
     {
-        if (m_queue[i].token_len == token_len)
+        return (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE);
+    }
+
+    for (uint32_t pos = index_pos(token_hash(p_token, token_len));
+         m_token_index[pos] != INVALID_SLOT;
+         pos = index_next(pos))
+    {
+        coap_queue_item_t * p_item = &m_queue[m_token_index[pos]];
+
+        if ((p_item->token_len == token_len) &&
+            (memcmp(p_item->token, p_token, token_len) == 0))
         {
-            if ((0 != m_queue[i].token_len) &&
-                (memcmp(m_queue[i].token, p_token, m_queue[i].token_len) == 0))
-            {
-                    *pp_item = &m_queue[i];
-                    return NRF_SUCCESS;
-            }
+            *pp_item = p_item;
+            return NRF_SUCCESS;
         }
     }
 
@@ -135,13 +377,13 @@ uint32_t coap_queue_item_by_token_get(coap_queue_item_t ** pp_item, uint8_t * p_
 
 uint32_t coap_queue_item_by_mid_get(coap_queue_item_t ** pp_item, uint16_t message_id)
 {
-
-
-    for (uint8_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
+    for (uint32_t pos = index_pos(mid_hash(message_id));
+         m_mid_index[pos] != INVALID_SLOT;
+         pos = index_next(pos))
     {
-        if (m_queue[i].mid == message_id)
+        if (m_queue[m_mid_index[pos]].mid == message_id)
         {
-            *pp_item = &m_queue[i];
+            *pp_item = &m_queue[m_mid_index[pos]];
             return NRF_SUCCESS;
         }
     }
@@ -152,31 +394,54 @@ uint32_t coap_queue_item_by_mid_get(coap_queue_item_t ** pp_item, uint16_t messa
 
 uint32_t coap_queue_item_next_get(coap_queue_item_t ** pp_item, coap_queue_item_t * p_item)
 {
-    if (p_item == NULL)
+    uint16_t first = (p_item == NULL) ? 0 : (uint16_t)(p_item - m_queue) + 1;
+
+    for (uint16_t i = first; i < COAP_MESSAGE_QUEUE_SIZE; i++)
     {
-        for (uint8_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
+        if (m_queue[i].p_buffer != NULL)
         {
-            if (m_queue[i].p_buffer != NULL)
-            {
-                (*pp_item) = &m_queue[i];
-                return NRF_SUCCESS;
-            }
+            (*pp_item) = &m_queue[i];
+            return NRF_SUCCESS;
         }
     }
-    else
+    (*pp_item) = NULL;
+
+    return (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE);
+}
+
+
+void coap_queue_tick(void)
+{
+    m_time++;
+}
+
+
+uint32_t coap_queue_item_expired_get(coap_queue_item_t ** pp_item)
+{
+    if ((m_message_queue_count == 0) || ((int32_t)(m_deadline[m_heap[0]] - m_time) > 0))
     {
-        uint8_t index_to_previous = (uint8_t)(((uint32_t)p_item - (uint32_t)m_queue) / (uint32_t)sizeof(coap_queue_item_t));
+        (*pp_item) = NULL;
+        return (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE);
+    }
 
-        for (uint8_t i = index_to_previous + 1; i < COAP_MESSAGE_QUEUE_SIZE; i++)
-        {
-            if (m_queue[i].p_buffer != NULL)
-            {
-                (*pp_item) = &m_queue[i];
-                return NRF_SUCCESS;
-            }
-        }
+    (*pp_item) = &m_queue[m_heap[0]];
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t coap_queue_item_timeout_set(coap_queue_item_t * p_item, uint16_t timeout)
+{
+    uint16_t slot = slot_get(p_item);
+
+    if (slot == INVALID_SLOT)
+    {
+        return (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE);
     }
-    (*pp_item) = NULL;
 
-    return (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE);
+    p_item->timeout  = timeout;
+    m_deadline[slot] = m_time + timeout + 1;
+    heap_update(m_heap_pos[slot]);
+
+    return NRF_SUCCESS;
 }
@@ -65,7 +65,7 @@ typedef struct
     uint8_t                  token_len;             /**< Message Token length. */
     uint8_t                  token[8];              /**< Message Token value up to 8 bytes. */
     uint8_t                  retrans_count;         /**< Re-transmission attempt count. */
-    uint16_t                 timeout;               /**< Time until new re-transmission attempt. */
+    uint16_t                 timeout;               /**< Time until new re-transmission attempt, in ticks, when the item was added or its timeout was last set. */
     uint16_t                 timeout_val;           /**< Last timeout value used. */
     coap_port_t              port;                  /**< Source port to use when re-transmitting. */
     uint8_t *                p_buffer;              /**< Pointer to the data buffer containing the encoded CoAP message. */
@@ -81,9 +81,12 @@ typedef struct
 uint32_t coap_queue_init(void);
 
 /**@brief Add item to the queue.
+ *
+ * @details The timeout of the item expires when the number of ticks given by its timeout field
+ *          has passed after the current one.
  *
  * @param[in] p_item      Pointer to an item which to add to the queue. The function will copy all
- *                        data provided.
+ *                        data provided. The handle of the queued item is written back to it.
  *
  * @retval NRF_SUCCESS         If adding the item was successful.
  * @retval NRF_ERROR_NO_MEM    If max number of queued elements has been reached. This is
@@ -144,6 +147,33 @@ uint32_t coap_queue_item_by_mid_get(coap_queue_item_t ** pp_item, uint16_t messa
  */
 uint32_t coap_queue_item_next_get(coap_queue_item_t ** pp_item, coap_queue_item_t * p_item);
 
+/**@brief Advance the time of the queue by one tick.
+ */
+void coap_queue_tick(void);
+
+/**@brief Get the item with the earliest expired timeout.
+ *
+ * @details Items are kept ordered by their timeouts, so this function does not iterate through
+ *          the queue. The item stays queued until it is removed or its timeout is set again.
+ *
+ * @param[out] pp_item    Pointer to be filled by the function with the item whose timeout has
+ *                        expired. Should not be NULL.
+ *
+ * @retval NRF_SUCCESS         If an item with expired timeout was found.
+ * @retval NRF_ERROR_NOT_FOUND If no item has expired timeout.
+ */
+uint32_t coap_queue_item_expired_get(coap_queue_item_t ** pp_item);
+
+/**@brief Set a new timeout for a queued item.
+ *
+ * @param[in] p_item      Pointer to a queued item. Should not be NULL.
+ * @param[in] timeout     Number of ticks after the current one when the timeout expires.
+ *
+ * @retval NRF_SUCCESS         If the timeout was set.
+ * @retval NRF_ERROR_NOT_FOUND If the item was not located in the queue.
+ */
+uint32_t coap_queue_item_timeout_set(coap_queue_item_t * p_item, uint16_t timeout);
+
 #ifdef __cplusplus
 }
 #endif
@@ -63,6 +63,28 @@ static char m_scratch_buffer[(COAP_RESOURCE_MAX_NAME_LEN + 1) * COAP_RESOURCE_MA
 
 #endif // COAP_DISABLE_API_PARAM_CHECK
 
+/**@brief Calculate the hash of a resource name or a path segment.
+ *
+ * @details 32-bit FNV-1a folded to 16 bits.
+ *
+ * @param[in] p_name Name to hash. Does not need to be zero terminated.
+ * @param[in] length Length of the name.
+ *
+ * @retval Hash of the name.
+ */
+static uint16_t name_hash(const uint8_t * p_name, uint16_t length)
+{
+    uint32_t hash = 0x811C9DC5;
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        hash ^= p_name[i];
+        hash *= 0x01000193;
+    }
+
+    return (uint16_t)((hash >> 16) ^ hash);
+}
+
 uint32_t coap_resource_init(void)
 {
     mp_root_resource = NULL;
@@ -74,12 +96,17 @@ uint32_t coap_resource_create(coap_resource_t * p_resource, const char * name)
     NULL_PARAM_CHECK(p_resource);
     NULL_PARAM_CHECK(name);
 
-    if (strlen(name) > COAP_RESOURCE_MAX_NAME_LEN)
+    size_t name_len = strlen(name);
+
+    if (name_len > COAP_RESOURCE_MAX_NAME_LEN)
     {
         return (NRF_ERROR_DATA_SIZE | IOT_COAP_ERR_BASE);
     }
 
-    memcpy(p_resource->name, name, strlen(name));
+    memcpy(p_resource->name, name, name_len);
+    p_resource->name[name_len] = '\0';
+    p_resource->name_len       = (uint8_t)name_len;
+    p_resource->name_hash      = name_hash((const uint8_t *)name, (uint16_t)name_len);
 
     if (mp_root_resource == NULL)
     {
@@ -113,7 +140,12 @@ uint32_t coap_resource_child_add(coap_resource_t * p_parent, coap_resource_t * p
     return NRF_SUCCESS;
 }
 
-static uint32_t generate_path(uint16_t buffer_pos, coap_resource_t * p_current_resource, char * parent_path, uint8_t * string, uint16_t * length)
+static uint32_t generate_path(uint16_t          buffer_pos,
+                              coap_resource_t * p_current_resource,
+                              char *            parent_path,
+                              uint8_t *         string,
+                              uint16_t *        p_string_pos,
+                              uint16_t *        length)
 {
     uint32_t err_code = NRF_SUCCESS;
 
@@ -126,7 +158,12 @@ static uint32_t generate_path(uint16_t buffer_pos, coap_resource_t * p_current_r
             coap_resource_t * next_child = p_current_resource->p_front;
             do
             {
-                err_code = generate_path(buffer_pos, next_child, m_scratch_buffer, string, length);
+                err_code = generate_path(buffer_pos,
+                                         next_child,
+                                         m_scratch_buffer,
+                                         string,
+                                         p_string_pos,
+                                         length);
                 if (err_code != NRF_SUCCESS)
                 {
                     return err_code;
@@ -137,7 +174,7 @@ static uint32_t generate_path(uint16_t buffer_pos, coap_resource_t * p_current_r
     }
     else
     {
-        uint16_t size = strlen(p_current_resource->name);
+        uint16_t size = p_current_resource->name_len;
         m_scratch_buffer[buffer_pos++] = '/';
 
         memcpy(&m_scratch_buffer[buffer_pos], p_current_resource->name, size);
@@ -148,7 +185,12 @@ static uint32_t generate_path(uint16_t buffer_pos, coap_resource_t * p_current_r
             coap_resource_t * next_child = p_current_resource->p_front;
             do
             {
-                err_code = generate_path(buffer_pos, next_child, m_scratch_buffer, string, length);
+                err_code = generate_path(buffer_pos,
+                                         next_child,
+                                         m_scratch_buffer,
+                                         string,
+                                         p_string_pos,
+                                         length);
                 if (err_code != NRF_SUCCESS)
                 {
                     return err_code;
@@ -171,7 +213,8 @@ static uint32_t generate_path(uint16_t buffer_pos, coap_resource_t * p_current_r
         if (buffer_pos <= (*length))
         {
             *length -= buffer_pos;
-            memcpy(&string[strlen((char *)string)], m_scratch_buffer, buffer_pos);
+            memcpy(&string[*p_string_pos], m_scratch_buffer, buffer_pos);
+            *p_string_pos += buffer_pos;
         }
         else
         {
@@ -192,27 +235,35 @@ uint32_t coap_resource_well_known_generate(uint8_t * string, uint16_t * length)
         return (NRF_ERROR_INVALID_STATE | IOT_COAP_ERR_BASE);
     }
 
+    uint16_t string_pos = 0;
+
     memset(string, 0, *length);
 
-    uint32_t err_code = generate_path(0, mp_root_resource, NULL, string, length);
+    uint32_t err_code = generate_path(0, mp_root_resource, NULL, string, &string_pos, length);
 
-    string[strlen((char *)string) - 1] = '\0'; // remove the last comma
+    if (string_pos > 0)
+    {
+        string[string_pos - 1] = '\0'; // remove the last comma
+    }
 
     return err_code;
 }
 
 static coap_resource_t * coap_resource_child_resolve(coap_resource_t * p_parent,
-                                                     char *            p_path)
+                                                     uint8_t *         p_path,
+                                                     uint16_t          path_len)
 {
     coap_resource_t * result = NULL;
     if (p_parent->p_front != NULL)
     {
         coap_resource_t * sibling_in_question = p_parent->p_front;
+        uint16_t          hash                = name_hash(p_path, path_len);
 
         do {
-            // Check if the sibling name match.
-            size_t size = strlen(sibling_in_question->name);
-            if (strncmp(sibling_in_question->name, p_path, size) == 0)
+            // Check if the sibling name match. Names are only compared if the hash and length match.
+            if ((sibling_in_question->name_hash == hash)     &&
+                (sibling_in_question->name_len  == path_len) &&
+                (memcmp(sibling_in_question->name, p_path, path_len) == 0))
             {
                 return sibling_in_question;
             }
@@ -225,7 +276,10 @@ static coap_resource_t * coap_resource_child_resolve(coap_resource_t * p_parent,
     return result;
 }
 
-uint32_t coap_resource_get(coap_resource_t ** p_resource, uint8_t ** pp_uri_pointers, uint8_t num_of_uris)
+uint32_t coap_resource_get(coap_resource_t ** p_resource,
+                           uint8_t **         pp_uri_pointers,
+                           uint16_t *         p_uri_lengths,
+                           uint8_t            num_of_uris)
 {
     if (mp_root_resource == NULL)
     {
@@ -239,7 +293,9 @@ uint32_t coap_resource_get(coap_resource_t ** p_resource, uint8_t ** pp_uri_poin
     // Every node should start at root.
     for (uint8_t i = 0; i < num_of_uris; i++)
     {
-        p_current_resource = coap_resource_child_resolve(p_current_resource, (char *)pp_uri_pointers[i]);
+        p_current_resource = coap_resource_child_resolve(p_current_resource,
+                                                         pp_uri_pointers[i],
+                                                         p_uri_lengths[i]);
 
         if (p_current_resource == NULL)
         {
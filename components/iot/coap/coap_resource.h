@@ -70,9 +70,14 @@ extern "C" {
 uint32_t coap_resource_init(void);
 
 /**@brief Find a resource by traversing the resource names.
+ *
+ * @details Each path segment is hashed once and compared with the name hashes computed when
+ *          the resources were created. Names are compared only when the hashes match.
  *
  * @param[out] p_resource      Located resource.
- * @param[in]  pp_uri_pointers Array of strings which forms the hierarchical path to the resource.
+ * @param[in]  pp_uri_pointers Array of path segments which forms the hierarchical path to the
+ *                             resource. Segments do not need to be zero terminated.
+ * @param[in]  p_uri_lengths   Array of lengths of the path segments.
  * @param[in]  num_of_uris     Number of URIs supplied through the path pointer list.
  *
  * @retval NRF_SUCCESS             The resource was instance located.
@@ -81,6 +86,7 @@ uint32_t coap_resource_init(void);
  */
 uint32_t coap_resource_get(coap_resource_t ** p_resource,
                            uint8_t **         pp_uri_pointers,
+                           uint16_t *         p_uri_lengths,
                            uint8_t            num_of_uris);
 
 
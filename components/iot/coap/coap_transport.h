@@ -75,6 +75,17 @@ typedef struct
 } coap_remote_t;
 
 
+/**@brief Serializes outgoing data into a buffer provided by the transport.
+ *
+ * @param[in]    p_context Context passed to \ref coap_transport_encode_write.
+ * @param[in]    p_buffer  Transport buffer where to put the serialized data.
+ * @param[inout] p_length  Size of the buffer. In return the length of the serialized data.
+ *
+ * @retval NRF_SUCCESS If the data was serialized successfully. Otherwise, an error code that indicates the reason for the failure is returned.
+ */
+typedef uint32_t (* coap_transport_encode_t)(void * p_context, uint8_t * p_buffer, uint16_t * p_length);
+
+
 /**@brief Transport initialization information. */
 typedef struct
 {
@@ -108,6 +119,29 @@ uint32_t coap_transport_write(const coap_port_t    * p_port,
                               uint16_t               datalen);
 
 
+/**@brief Sends data on a CoAP endpoint or port, serializing it directly into the transport buffer.
+ *
+ * @details The transport allocates its buffer for the outgoing datagram and lets the encoder
+ *          fill it in place, avoiding an intermediate buffer and a copy. Used for messages that
+ *          are not kept for retransmission.
+ *
+ *          A default implementation serializing into a temporary buffer and sending it with
+ *          \ref coap_transport_write is provided for transports that do not own their buffers.
+ *
+ * @param[in] p_port    Port on which the data is to be sent.
+ * @param[in] p_remote  Remote endpoint to which the data is targeted.
+ * @param[in] datalen   Length of the serialized data.
+ * @param[in] encode    Function serializing the data into the transport buffer.
+ * @param[in] p_context Context passed to the encode function.
+ *
+ * @retval NRF_SUCCESS If the data was sent successfully. Otherwise, an error code that indicates the reason for the failure is returned.
+ */
+uint32_t coap_transport_encode_write(const coap_port_t       * p_port,
+                                     const coap_remote_t     * p_remote,
+                                     uint16_t                  datalen,
+                                     coap_transport_encode_t   encode,
+                                     void                    * p_context);
+
 
 /**@brief Handles data received on a CoAP endpoint or port.
  *
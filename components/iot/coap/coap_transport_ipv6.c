@@ -243,6 +243,73 @@ uint32_t coap_transport_write(const coap_port_t    * p_port,
 }
 
 
+uint32_t coap_transport_encode_write(const coap_port_t       * p_port,
+                                     const coap_remote_t     * p_remote,
+                                     uint16_t                  datalen,
+                                     coap_transport_encode_t   encode,
+                                     void                    * p_context)
+{
+    uint32_t                       err_code = NRF_ERROR_NOT_FOUND;
+    uint32_t                       index;
+    udp6_socket_t                  socket;
+    ipv6_addr_t                    remote_addr;
+    iot_pbuffer_t                * p_buffer;
+    iot_pbuffer_alloc_param_t      buffer_param;
+
+    NULL_PARAM_CHECK(p_port);
+    NULL_PARAM_CHECK(p_remote);
+    NULL_PARAM_CHECK(encode);
+
+    memcpy(remote_addr.u8, p_remote->addr, 16);
+
+
+    buffer_param.type   = UDP6_PACKET_TYPE;
+    buffer_param.flags  = PBUFFER_FLAG_DEFAULT;
+    buffer_param.length = datalen;
+
+    //Search for the corresponding port.
+    for (index = 0; index < COAP_PORT_COUNT; index ++)
+    {
+        if (m_port_table[index].port_number == p_port->port_number)
+        {
+            //Allocate buffer to send the data on port.
+            err_code = iot_pbuffer_allocate(&buffer_param, &p_buffer);
+
+            if (err_code == NRF_SUCCESS)
+            {
+                socket.socket_id = m_port_table[index].socket_id;
+
+                //Serialize the data in place, after the headroom reserved for the lower layers.
+                uint16_t length = datalen;
+                err_code = encode(p_context, p_buffer->p_payload, &length);
+
+                if (err_code == NRF_SUCCESS)
+                {
+                    COAP_MUTEX_UNLOCK();
+
+                    //Send on UDP port.
+                    err_code = udp6_socket_sendto(&socket,
+                                                  &remote_addr,
+                                                  p_remote->port_number,
+                                                  p_buffer);
+
+                    COAP_MUTEX_LOCK();
+                }
+
+                if (err_code != NRF_SUCCESS)
+                {
+                    //Free the allocated buffer as serialization or send procedure has failed.
+                    UNUSED_VARIABLE(iot_pbuffer_free(p_buffer, true));
+                }
+            }
+            break;
+        }
+    }
+
+    return err_code;
+}
+
+
 void coap_transport_process(void)
 {
     return;
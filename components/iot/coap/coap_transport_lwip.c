@@ -233,6 +233,64 @@ uint32_t coap_transport_write(const coap_port_t    * p_port,
 }
 
 
+uint32_t coap_transport_encode_write(const coap_port_t       * p_port,
+                                     const coap_remote_t     * p_remote,
+                                     uint16_t                  datalen,
+                                     coap_transport_encode_t   encode,
+                                     void                    * p_context)
+{
+    uint32_t err_code = NRF_ERROR_NOT_FOUND;
+    uint32_t index;
+
+    NULL_PARAM_CHECK(p_port);
+    NULL_PARAM_CHECK(p_remote);
+    NULL_PARAM_CHECK(encode);
+
+    //Search for the corresponding port.
+    for (index = 0; index < COAP_PORT_COUNT; index++)
+    {
+        if (m_port_table[index].port_number == p_port->port_number)
+        {
+            //Allocate Buffer to send the data on port. PBUF_RAM is allocated as one contiguous buffer.
+            struct pbuf * lwip_buffer = pbuf_alloc(PBUF_TRANSPORT, datalen, PBUF_RAM);
+
+            if (NULL != lwip_buffer)
+            {
+                //Serialize the data in place.
+                uint16_t length = datalen;
+                err_code = encode(p_context, lwip_buffer->payload, &length);
+
+                if (err_code == NRF_SUCCESS)
+                {
+                    COAP_MUTEX_UNLOCK();
+
+                    //Send on UDP port.
+                    err_t err = udp_sendto(m_port_table[index].p_socket,
+                                           lwip_buffer,
+                                           (ip6_addr_t *)p_remote->addr,
+                                           p_remote->port_number);
+
+                    COAP_MUTEX_LOCK();
+
+                    if (err != ERR_OK)
+                    {
+                        err_code = NRF_ERROR_INTERNAL;
+                    }
+                }
+                UNUSED_VARIABLE(pbuf_free(lwip_buffer));
+            }
+            else
+            {
+                //Buffer allocation failed, cannot send data.
+                err_code = NRF_ERROR_NO_MEM;
+            }
+            break;
+        }
+    }
+    return err_code;
+}
+
+
 void coap_transport_process(void)
 {
     return;
@@ -476,17 +476,22 @@ static void echo_reply_send(iot_interface_t  * p_interface,
                p_packet->p_payload,
                p_packet->length);
 
-        // Calculate checksum.
-        checksum = p_pbuffer->length + ICMP6_HEADER_SIZE + IPV6_NEXT_HEADER_ICMP6;
+        // Calculate checksum. Payload, identifier and sequence number are echoed and addresses
+        // are swapped, so the verified checksum of the request is updated only with the fields
+        // that differ.
+        checksum = NTOHS(p_icmp_header->checksum);
 
-        ipv6_checksum_calculate(p_reply_ip_header->srcaddr.u8, IPV6_ADDR_SIZE, &checksum, false);
-        ipv6_checksum_calculate(p_reply_ip_header->destaddr.u8, IPV6_ADDR_SIZE, &checksum, false);
-        ipv6_checksum_calculate(p_pbuffer->p_payload - ICMP6_HEADER_SIZE,
-                                p_pbuffer->length + ICMP6_HEADER_SIZE,
-                                &checksum,
-                                false);
+        ipv6_checksum_update(&p_icmp_header->type, &p_reply_icmp_header->type, 2, &checksum);
 
-        p_reply_icmp_header->checksum = HTONS((~checksum));
+        if (IPV6_ADDRESS_IS_MULTICAST(&p_ip_header->destaddr))
+        {
+            ipv6_checksum_update(p_ip_header->destaddr.u8,
+                                 p_reply_ip_header->srcaddr.u8,
+                                 IPV6_ADDR_SIZE,
+                                 &checksum);
+        }
+
+        p_reply_icmp_header->checksum = HTONS(checksum);
 
         p_pbuffer->p_payload -= ICMP6_OFFSET;
         p_pbuffer->length    += ICMP6_OFFSET;
@@ -44,50 +44,125 @@
 #include "sdk_config.h"
 #include "ipv6_utils.h"
 
+/**@brief Function for folding a checksum accumulator into 16 bits with end-around carry.
+ *
+ * @param[in] sum  Accumulated sum.
+ *
+ * @return Ones' complement sum of the 16-bit halves of the accumulator, 0 only if sum is 0.
+ */
+static __INLINE uint32_t checksum_fold(uint64_t sum)
+{
+    uint32_t folded;
+
+    sum    = (sum & 0xFFFFFFFF) + (sum >> 32);
+    sum    = (sum & 0xFFFFFFFF) + (sum >> 32);
+    folded = (uint32_t)sum;
+    folded = (folded & 0xFFFF) + (folded >> 16);
+    folded = (folded & 0xFFFF) + (folded >> 16);
+
+    return folded;
+}
+
+
 void ipv6_checksum_calculate(const uint8_t * p_data, uint16_t len, uint16_t * p_checksum, bool flip_flag)
 {
-    uint16_t checksum_even = (((*p_checksum) & 0xFF00) >> 8);
-    uint16_t checksum_odd  = ((*p_checksum) & 0x00FF);
+    uint64_t sum        = 0;
+    uint32_t checksum;
+    uint32_t first_byte = 0;
+    bool     odd_start  = (((uintptr_t)p_data & 0x01) != 0);
 
-    while (len)
+    // Data is summed in words loaded in the little-endian byte order of the platform. Ones'
+    // complement sum does not depend on byte order, so the result is swapped once at the end.
+    // Carries are collected in the upper half of the accumulator and folded only once.
+    if (odd_start && (len > 0))
     {
-        if ( len == 1 )
-        {
-          checksum_even += (*p_data);
-          len           -= 1;
-        }
-        else
-        {
-          checksum_even += *p_data++;
-          checksum_odd  += *p_data++;
-          len           -= 2;
-        }
+        first_byte = *p_data++;
+        len       -= 1;
+    }
 
-        if (checksum_odd & 0xFF00)
-        {
-            checksum_even += ((checksum_odd & 0xFF00) >> 8);
-            checksum_odd   = (checksum_odd & 0x00FF);
-        }
+    if ((((uintptr_t)p_data & 0x02) != 0) && (len >= 2))
+    {
+        sum    += *(const uint16_t *)p_data;
+        p_data += 2;
+        len    -= 2;
+    }
 
-        if (checksum_even & 0xFF00)
-        {
-            checksum_odd += ((checksum_even & 0xFF00) >> 8);
-            checksum_even = (checksum_even & 0x00FF);
-        }
+    while (len >= 16)
+    {
+        const uint32_t * p_words = (const uint32_t *)p_data;
+
+        sum    += p_words[0];
+        sum    += p_words[1];
+        sum    += p_words[2];
+        sum    += p_words[3];
+        p_data += 16;
+        len    -= 16;
     }
 
-    checksum_even = (checksum_even << 8) + (checksum_odd & 0xFFFF);
+    while (len >= 4)
+    {
+        sum    += *(const uint32_t *)p_data;
+        p_data += 4;
+        len    -= 4;
+    }
+
+    if (len >= 2)
+    {
+        sum    += *(const uint16_t *)p_data;
+        p_data += 2;
+        len    -= 2;
+    }
+
+    if (len == 1)
+    {
+        // Last byte is the high byte of a word in network byte order.
+        sum += *p_data;
+    }
+
+    checksum = checksum_fold(sum);
+
+    if (odd_start)
+    {
+        // Data after the first byte was summed shifted by one byte, which is the same as summing
+        // it in network byte order. The first byte is the high byte of a word.
+        checksum = checksum_fold((uint64_t)checksum + (first_byte << 8));
+    }
+    else
+    {
+        checksum = HTONS(checksum);
+    }
+
+    checksum = checksum_fold((uint64_t)checksum + (*p_checksum));
 
     if (flip_flag)
     {
         // We use 0xFFFF instead of 0x0000 because of not operator.
-        if (checksum_even == 0xFFFF)
+        if (checksum == 0xFFFF)
         {
-            checksum_even = 0x0000;
+            checksum = 0x0000;
         }
     }
 
-    (*p_checksum) = (uint16_t)(checksum_even);
+    (*p_checksum) = (uint16_t)(checksum);
+}
+
+
+void ipv6_checksum_update(const uint8_t * p_old_data,
+                          const uint8_t * p_new_data,
+                          uint16_t        len,
+                          uint16_t      * p_checksum)
+{
+    uint16_t old_sum = 0;
+    uint16_t new_sum = 0;
+    uint32_t checksum;
+
+    ipv6_checksum_calculate(p_old_data, len, &old_sum, false);
+    ipv6_checksum_calculate(p_new_data, len, &new_sum, false);
+
+    // RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m').
+    checksum = checksum_fold((uint64_t)(uint16_t)~(*p_checksum) + (uint16_t)~old_sum + new_sum);
+
+    (*p_checksum) = (uint16_t)~checksum;
 }
 
 void ipv6_header_init(ipv6_header_t * p_ip_header)
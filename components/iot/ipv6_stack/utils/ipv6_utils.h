@@ -59,6 +59,10 @@ extern "C" {
 #endif
 
 /**@brief Function for calculating checksum using IPv6 algorithm.
+ *
+ * @details Data is summed one word at a time, so it is faster for word aligned buffers. Data of
+ *          odd length is padded with a zero byte, so only the last part of the checksummed data
+ *          may have an odd length.
  *
  * @param[in]  p_data      Pointer to the data needs to be checksummed.
  * @param[in]  len         Length of the data.
@@ -73,6 +77,30 @@ void ipv6_checksum_calculate(const uint8_t * p_data,
                              bool            flip_zero);
 
 
+/**@brief Function for updating a checksum after a part of the checksummed data was changed.
+ *
+ * @details The checksum is updated incrementally as described in RFC 1624, without summing the
+ *          unchanged data again. The changed part must start at an even offset in the
+ *          checksummed data.
+ *
+ * @note    The result can be 0x0000. If it is not allowed by the protocol, as in UDP, the caller
+ *          must replace it with 0xFFFF.
+ *
+ * @param[in]  p_old_data  Pointer to the changed part before the change.
+ * @param[in]  p_new_data  Pointer to the changed part after the change.
+ * @param[in]  len         Length of the changed part.
+ * @param[in]  p_checksum  Pointer to the checksum field value (complemented sum) in host byte
+ *                         order.
+ * @param[out] p_checksum  Value of updated checksum.
+ *
+ * @retval None.
+ */
+void ipv6_checksum_update(const uint8_t * p_old_data,
+                          const uint8_t * p_new_data,
+                          uint16_t        len,
+                          uint16_t      * p_checksum);
+
+
 /**@brief Function for initializing default values of IPv6 Header.
  *
  * @note  Function initializes Version, Traffic Class, Flow Label, Next Header, Hop Limit and
@@ -40,7 +40,7 @@
 #include "nrf_atomic.h"
 
 #ifndef NRF_ATOMIC_USE_BUILD_IN
-#if (defined(__GNUC__) && defined(WIN32))
+#if (defined(__GNUC__) && (defined(WIN32) || defined(__unix) || defined(__APPLE__)))
     #define NRF_ATOMIC_USE_BUILD_IN 1
 #else
     #define NRF_ATOMIC_USE_BUILD_IN 0
@@ -58,6 +58,17 @@
 /* Unions testing */
 STATIC_ASSERT(sizeof(nrf_atfifo_postag_t) == sizeof(uint32_t));
 
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED
+/* Single item operations go through the generic implementation, which gathers statistics. */
+#define WSPACE_REQ(p_fifo, p_old_tail) \
+    nrf_atfifo_wspace_req_n((p_fifo), (p_fifo)->item_size, (p_old_tail))
+#define RSPACE_REQ(p_fifo, p_old_head) \
+    (nrf_atfifo_rspace_req_n((p_fifo), (p_fifo)->item_size, (p_old_head)) != 0)
+#else
+#define WSPACE_REQ(p_fifo, p_old_tail) nrf_atfifo_wspace_req((p_fifo), (p_old_tail))
+#define RSPACE_REQ(p_fifo, p_old_head) nrf_atfifo_rspace_req((p_fifo), (p_old_head))
+#endif
+
 
 ret_code_t nrf_atfifo_init(nrf_atfifo_t * const p_fifo, void * p_buf, uint16_t buf_size, uint16_t item_size)
 {
@@ -77,6 +88,9 @@ ret_code_t nrf_atfifo_init(nrf_atfifo_t * const p_fifo, void * p_buf, uint16_t b
     p_fifo->head.tag  = 0;
     p_fifo->buf_size  = buf_size;
     p_fifo->item_size = item_size;
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED
+    memset(&p_fifo->stats, 0, sizeof(p_fifo->stats));
+#endif
 
     NRF_LOG_INST_INFO(p_fifo->p_log, "Initialized.");
     return NRF_SUCCESS;
@@ -116,7 +130,7 @@ ret_code_t nrf_atfifo_alloc_put(nrf_atfifo_t * const p_fifo, void const * p_var,
 
 void * nrf_atfifo_item_alloc(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
 {
-    if (nrf_atfifo_wspace_req(p_fifo, &(p_context->last_tail)))
+    if (WSPACE_REQ(p_fifo, &(p_context->last_tail)))
     {
         void * p_item = ((uint8_t*)(p_fifo->p_buf)) + p_context->last_tail.pos.wr;
         NRF_LOG_INST_DEBUG(p_fifo->p_log, "Allocated  element (0x%08X).", p_item);
@@ -127,6 +141,21 @@ void * nrf_atfifo_item_alloc(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t
 }
 
 
+void * nrf_atfifo_items_alloc(nrf_atfifo_t * const p_fifo, size_t count, nrf_atfifo_item_put_t * p_context)
+{
+    ASSERT(count != 0);
+    if ((count < (size_t)(p_fifo->buf_size / p_fifo->item_size)) &&
+        nrf_atfifo_wspace_req_n(p_fifo, (uint16_t)(count * p_fifo->item_size), &(p_context->last_tail)))
+    {
+        void * p_item = ((uint8_t*)(p_fifo->p_buf)) + p_context->last_tail.pos.wr;
+        NRF_LOG_INST_DEBUG(p_fifo->p_log, "Allocated %d elements (0x%08X).", count, p_item);
+        return p_item;
+    }
+    NRF_LOG_INST_WARNING(p_fifo->p_log, "Allocation of %d elements failed - no space.", count);
+    return NULL;
+}
+
+
 bool nrf_atfifo_item_put(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
 {
     if ((p_context->last_tail.pos.wr) == (p_context->last_tail.pos.rd))
@@ -165,7 +194,7 @@ ret_code_t nrf_atfifo_get_free(nrf_atfifo_t * const p_fifo, void * const p_var,
 
 void * nrf_atfifo_item_get(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
 {
-    if (nrf_atfifo_rspace_req(p_fifo, &(p_context->last_head)))
+    if (RSPACE_REQ(p_fifo, &(p_context->last_head)))
     {
         void * p_item = ((uint8_t*)(p_fifo->p_buf)) + p_context->last_head.pos.rd;
         NRF_LOG_INST_DEBUG(p_fifo->p_log, "Get element: 0x%08X", p_item);
@@ -176,6 +205,32 @@ void * nrf_atfifo_item_get(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t *
 }
 
 
+void * nrf_atfifo_items_get(nrf_atfifo_t * const p_fifo, size_t * p_count, nrf_atfifo_item_get_t * p_context)
+{
+    uint16_t size;
+    size_t   max_count = *p_count;
+
+    ASSERT(max_count != 0);
+    if (max_count > (size_t)(p_fifo->buf_size / p_fifo->item_size))
+    {
+        max_count = p_fifo->buf_size / p_fifo->item_size;
+    }
+
+    size = nrf_atfifo_rspace_req_n(p_fifo,
+                                   (uint16_t)(max_count * p_fifo->item_size),
+                                   &(p_context->last_head));
+    *p_count = size / p_fifo->item_size;
+    if (size != 0)
+    {
+        void * p_item = ((uint8_t*)(p_fifo->p_buf)) + p_context->last_head.pos.rd;
+        NRF_LOG_INST_DEBUG(p_fifo->p_log, "Get %d elements: 0x%08X", *p_count, p_item);
+        return p_item;
+    }
+    NRF_LOG_INST_WARNING(p_fifo->p_log, "Get failed - no item in the FIFO.");
+    return NULL;
+}
+
+
 bool nrf_atfifo_item_free(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
 {
     if ((p_context->last_head.pos.wr) == (p_context->last_head.pos.rd))
@@ -187,3 +242,18 @@ bool nrf_atfifo_item_free(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p
     NRF_LOG_INST_DEBUG(p_fifo->p_log, "Free (interrupted)");
     return false;
 }
+
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED
+void nrf_atfifo_stats_get(nrf_atfifo_t const * const p_fifo, nrf_atfifo_stats_t * p_stats)
+{
+    *p_stats = p_fifo->stats;
+}
+
+
+void nrf_atfifo_stats_reset(nrf_atfifo_t * const p_fifo)
+{
+    p_fifo->stats.max_used     = 0;
+    p_fifo->stats.wr_contended = 0;
+    p_fifo->stats.rd_contended = 0;
+}
+#endif // NRF_ATFIFO_CONFIG_STATS_ENABLED
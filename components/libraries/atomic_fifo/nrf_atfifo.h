@@ -42,11 +42,17 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "sdk_config.h"
 #include "nordic_common.h"
 #include "nrf_assert.h"
 #include "sdk_errors.h"
 #include "nrf_log_instance.h"
+
+#ifndef NRF_ATFIFO_CONFIG_STATS_ENABLED
+#define NRF_ATFIFO_CONFIG_STATS_ENABLED 0
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -92,6 +98,16 @@ extern "C" {
  * }
  *
  * @endcode
+ * - Function pair to write several items at once:
+ * @code
+ * point3d_t * points;
+ *
+ * if (NULL != (points = nrf_atfifo_items_alloc(my_fifo, 4, &context)))
+ * {
+ *      // Fill points[0] to points[3].
+ *      (void) nrf_atfifo_item_put(my_fifo, &context);
+ * }
+ * @endcode
  * @note
  * This atomic FIFO implementation requires that the operation that is
  * opened last is finished (committed/flushed) first.
@@ -128,6 +144,21 @@ typedef union nrf_atfifo_postag_u
     nrf_atfifo_postag_pos_t pos; //!< Structure that holds reading and writing position separately
 }nrf_atfifo_postag_t;
 
+/**
+ * @brief FIFO usage statistics.
+ *
+ * Gathered only when @ref NRF_ATFIFO_CONFIG_STATS_ENABLED is set.
+ * Contention counters are incremented each time an exclusive store fails because
+ * another context accessed the FIFO in the middle of the reservation and the reservation
+ * had to be repeated.
+ */
+typedef struct nrf_atfifo_stats_s
+{
+    uint32_t max_used;     //!< Highest number of items that were allocated or waiting to be freed at the same time
+    uint32_t wr_contended; //!< Number of repeated write space reservations
+    uint32_t rd_contended; //!< Number of repeated read space reservations
+}nrf_atfifo_stats_t;
+
 /**
  * @brief The FIFO instance.
  *
@@ -141,6 +172,9 @@ typedef struct nrf_atfifo_s
     nrf_atfifo_postag_t   head;         //!< Read and write head position tag
     uint16_t              buf_size;     //!< FIFO size in number of bytes (has to be divisible by @c item_size)
     uint16_t              item_size;    //!< Size of a single FIFO item
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED
+    nrf_atfifo_stats_t    stats;        //!< Usage statistics (Conditionally compiled).
+#endif
     NRF_LOG_INSTANCE_PTR_DECLARE(p_log) //!< Pointer to instance of the logger object (Conditionally compiled).
 }nrf_atfifo_t;
 
@@ -355,6 +389,26 @@ ret_code_t nrf_atfifo_alloc_put(nrf_atfifo_t * const p_fifo, void const * const
  */
 void * nrf_atfifo_item_alloc(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context);
 
+/**
+ * @brief Function for opening the FIFO for writing several items at once.
+ *
+ * Reserves space for @p count items placed one after another in the FIFO buffer
+ * in a single atomic operation. The operation is closed with @ref nrf_atfifo_item_put,
+ * which makes all the items visible to read at once.
+ *
+ * The items are never split at the end of the buffer. If there is enough free space
+ * in total, but it is not contiguous, the allocation fails and it may be repeated
+ * with a smaller @p count.
+ *
+ * @param[in,out] p_fifo    FIFO object.
+ * @param[in]     count     Number of items to allocate. Cannot be 0.
+ * @param[out]    p_context Operation context, required by @ref nrf_atfifo_item_put.
+ *
+ * @return Pointer to the space where the first item can be stored.
+ *         NULL if there is no space for @p count contiguous items in the buffer.
+ */
+void * nrf_atfifo_items_alloc(nrf_atfifo_t * const p_fifo, size_t count, nrf_atfifo_item_put_t * p_context);
+
 /**
  * @brief Function for closing the writing operation.
  *
@@ -363,7 +417,8 @@ void * nrf_atfifo_item_alloc(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t
  * It sets all the buffers and marks the data, so that it is visible to read.
  *
  * @param[in,out] p_fifo    FIFO object.
- * @param[in]     p_context Operation context, filled by the @ref nrf_atfifo_item_alloc function.
+ * @param[in]     p_context Operation context, filled by the @ref nrf_atfifo_item_alloc
+ *                          or @ref nrf_atfifo_items_alloc function.
  *
  * @retval true  Data is currently ready and will be visible to read.
  * @retval false The internal commit was marked, but the writing operation interrupted another writing operation.
@@ -399,6 +454,25 @@ ret_code_t nrf_atfifo_get_free(nrf_atfifo_t * const p_fifo, void * const p_var,
  */
 void * nrf_atfifo_item_get(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context);
 
+/**
+ * @brief Function for opening the FIFO for reading several items at once.
+ *
+ * Takes up to @p *p_count items placed one after another in the FIFO buffer
+ * in a single atomic operation. The operation is closed with @ref nrf_atfifo_item_free,
+ * which releases all the items at once.
+ *
+ * The items are never split at the end of the buffer, so fewer items than requested
+ * may be returned even if more are stored in the FIFO. The rest can be read with the next call.
+ *
+ * @param[in,out] p_fifo    FIFO object.
+ * @param[in,out] p_count   Maximum number of items to read. Cannot be 0.
+ *                          Number of items actually read on return.
+ * @param[out]    p_context The operation context, required by @ref nrf_atfifo_item_free.
+ *
+ * @return Pointer to the first item or NULL if there is no data in the FIFO.
+ */
+void * nrf_atfifo_items_get(nrf_atfifo_t * const p_fifo, size_t * p_count, nrf_atfifo_item_get_t * p_context);
+
 /**
  * @brief Function for closing the reading operation.
  *
@@ -407,13 +481,31 @@ void * nrf_atfifo_item_get(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t *
  * If this reading operation is placed in the middle of another reading, only the new read pointer is written.
  *
  * @param[in,out] p_fifo    FIFO object.
- * @param[in]     p_context Context of the reading operation to be closed.
+ * @param[in]     p_context Context of the reading operation to be closed, filled by the
+ *                          @ref nrf_atfifo_item_get or @ref nrf_atfifo_items_get function.
  *
  * @retval true  This operation is not generated in the middle of another read operation and the write head will be updated to the read head (space is released).
  * @retval false This operation was performed in the middle of another read operation and the write buffer head was not moved (no space is released).
  */
 bool nrf_atfifo_item_free(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context);
 
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED || defined(__SDK_DOXYGEN__)
+/**
+ * @brief Function for reading the FIFO usage statistics.
+ *
+ * @param[in]  p_fifo  FIFO object.
+ * @param[out] p_stats Copy of the statistics.
+ */
+void nrf_atfifo_stats_get(nrf_atfifo_t const * const p_fifo, nrf_atfifo_stats_t * p_stats);
+
+/**
+ * @brief Function for clearing the FIFO usage statistics.
+ *
+ * @param[in,out] p_fifo FIFO object.
+ */
+void nrf_atfifo_stats_reset(nrf_atfifo_t * const p_fifo);
+#endif
+
 
 /** @} */
 
@@ -67,6 +67,7 @@
 STATIC_ASSERT(offsetof(nrf_atfifo_postag_pos_t, wr) == 0);
 STATIC_ASSERT(offsetof(nrf_atfifo_postag_pos_t, rd) == 2);
 
+#if !NRF_ATFIFO_CONFIG_STATS_ENABLED
 /**
  * @brief Atomically reserve space for a new write.
  *
@@ -79,6 +80,26 @@ STATIC_ASSERT(offsetof(nrf_atfifo_postag_pos_t, rd) == 2);
  * @sa nrf_atfifo_wspace_close
  */
 static bool nrf_atfifo_wspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_tail);
+#endif
+
+/**
+ * @brief Atomically reserve contiguous space for a new write of any size.
+ *
+ * Works like @ref nrf_atfifo_wspace_req, but reserves @p size bytes at once.
+ * The space is never wrapped at the end of the buffer.
+ *
+ * @param[in,out] p_fifo     FIFO object.
+ * @param[in]     size       Number of bytes to reserve (multiple of the item size).
+ * @param[out]    p_old_tail Tail position tag before new space is reserved.
+ *
+ * @retval true  Space available.
+ * @retval false Not enough contiguous free space.
+ *
+ * @sa nrf_atfifo_wspace_close
+ */
+static bool nrf_atfifo_wspace_req_n(nrf_atfifo_t * const p_fifo,
+                                    uint16_t             size,
+                                    nrf_atfifo_postag_t * const p_old_tail);
 
 /**
  * @brief Atomically mark all written data available.
@@ -104,6 +125,7 @@ static bool nrf_atfifo_wspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag
  */
 static void nrf_atfifo_wspace_close(nrf_atfifo_t * const p_fifo);
 
+#if !NRF_ATFIFO_CONFIG_STATS_ENABLED
 /**
  * @brief Atomically get a part of a buffer to read data.
  *
@@ -116,6 +138,25 @@ static void nrf_atfifo_wspace_close(nrf_atfifo_t * const p_fifo);
  * @sa nrf_atfifo_rspace_close
  */
 static bool nrf_atfifo_rspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_head);
+#endif
+
+/**
+ * @brief Atomically get a contiguous part of a buffer to read data of any size.
+ *
+ * Works like @ref nrf_atfifo_rspace_req, but takes up to @p max_size bytes at once.
+ * The data is never wrapped at the end of the buffer.
+ *
+ * @param[in,out] p_fifo     FIFO object.
+ * @param[in]     max_size   Maximum number of bytes to take (multiple of the item size).
+ * @param[out]    p_old_head Head position tag before the data buffer is read.
+ *
+ * @return Number of bytes taken. 0 if there is no data in the buffer.
+ *
+ * @sa nrf_atfifo_rspace_close
+ */
+static uint16_t nrf_atfifo_rspace_req_n(nrf_atfifo_t * const p_fifo,
+                                        uint16_t             max_size,
+                                        nrf_atfifo_postag_t * const p_old_head);
 
 /**
  * @brief Atomically release all read data.
@@ -159,9 +200,78 @@ static bool nrf_atfifo_space_clear(nrf_atfifo_t * const p_fifo);
  * Implementation starts here
  */
 
-#if defined ( __CC_ARM )
+#if defined(_WIN32) || defined(__unix) || defined(__APPLE__)
+
+/* PC host build. The exclusive access intrinsics are provided by the host stand-ins. */
+
+#if !NRF_ATFIFO_CONFIG_STATS_ENABLED
+static bool nrf_atfifo_wspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_tail)
+{
+    return nrf_atfifo_wspace_req_n(p_fifo, p_fifo->item_size, p_old_tail);
+}
+#endif
+
+
+static void nrf_atfifo_wspace_close(nrf_atfifo_t * const p_fifo)
+{
+    nrf_atfifo_postag_t new_tail;
+    do
+    {
+        new_tail.tag    = __LDREXW(&p_fifo->tail.tag);
+        new_tail.pos.rd = new_tail.pos.wr;
+    } while (__STREXW(new_tail.tag, &p_fifo->tail.tag) != 0);
+}
+
+
+#if !NRF_ATFIFO_CONFIG_STATS_ENABLED
+static bool nrf_atfifo_rspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_head)
+{
+    return (nrf_atfifo_rspace_req_n(p_fifo, p_fifo->item_size, p_old_head) != 0);
+}
+#endif
+
+
+static void nrf_atfifo_rspace_close(nrf_atfifo_t * const p_fifo)
+{
+    nrf_atfifo_postag_t new_head;
+    do
+    {
+        new_head.tag    = __LDREXW(&p_fifo->head.tag);
+        new_head.pos.wr = new_head.pos.rd;
+    } while (__STREXW(new_head.tag, &p_fifo->head.tag) != 0);
+}
+
+
+static bool nrf_atfifo_space_clear(nrf_atfifo_t * const p_fifo)
+{
+    bool                ret;
+    nrf_atfifo_postag_t old_head;
+    nrf_atfifo_postag_t new_head;
+    do
+    {
+        old_head.tag    = __LDREXW(&p_fifo->head.tag);
+        new_head.pos.rd = ((nrf_atfifo_postag_t volatile *)&p_fifo->tail)->pos.rd;
+        ret             = false;
+        if (old_head.pos.wr != old_head.pos.rd)
+        {
+            /* Reading in progress, the space is released when the read is closed. */
+            new_head.pos.wr = old_head.pos.wr;
+        }
+        else
+        {
+            nrf_atfifo_postag_t tail;
+            tail.tag        = ((nrf_atfifo_postag_t volatile *)&p_fifo->tail)->tag;
+            new_head.pos.wr = new_head.pos.rd;
+            ret             = (tail.pos.wr == tail.pos.rd);
+        }
+    } while (__STREXW(new_head.tag, &p_fifo->head.tag) != 0);
+    return ret;
+}
+
+#elif defined ( __CC_ARM )
 
 
+#if !NRF_ATFIFO_CONFIG_STATS_ENABLED
 __ASM bool nrf_atfifo_wspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_tail)
 {
     /* Registry usage:
@@ -213,6 +323,7 @@ nrf_atfifo_wspace_req_exit
     pop {r4, r5}
     bx  lr
 }
+#endif
 
 
 __ASM void nrf_atfifo_wspace_close(nrf_atfifo_t * const p_fifo)
@@ -234,6 +345,7 @@ nrf_atfifo_wspace_close_repeat
 }
 
 
+#if !NRF_ATFIFO_CONFIG_STATS_ENABLED
 __ASM bool nrf_atfifo_rspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_head)
 {
     /* Registry usage:
@@ -286,6 +398,7 @@ nrf_atfifo_rspace_req_exit
     pop {r4, r5}
     bx  lr
 }
+#endif
 
 
 __ASM void nrf_atfifo_rspace_close(nrf_atfifo_t * const p_fifo)
@@ -349,6 +462,7 @@ nrf_atfifo_space_clear_head_test_skip
 
 #elif defined ( __ICCARM__ ) || defined ( __GNUC__ )
 
+#if !NRF_ATFIFO_CONFIG_STATS_ENABLED
 bool nrf_atfifo_wspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_tail)
 {
     volatile bool ret;
@@ -405,6 +519,7 @@ bool nrf_atfifo_wspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * co
     UNUSED_VARIABLE(temp);
     return ret;
 }
+#endif
 
 
 void nrf_atfifo_wspace_close(nrf_atfifo_t * const p_fifo)
@@ -435,6 +550,7 @@ void nrf_atfifo_wspace_close(nrf_atfifo_t * const p_fifo)
 }
 
 
+#if !NRF_ATFIFO_CONFIG_STATS_ENABLED
 bool nrf_atfifo_rspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * const p_old_head)
 {
     volatile bool ret;
@@ -491,6 +607,7 @@ bool nrf_atfifo_rspace_req(nrf_atfifo_t * const p_fifo, nrf_atfifo_postag_t * co
     UNUSED_VARIABLE(temp);
     return ret;
 }
+#endif
 
 
 void nrf_atfifo_rspace_close(nrf_atfifo_t * const p_fifo)
@@ -574,4 +691,166 @@ bool nrf_atfifo_space_clear(nrf_atfifo_t * const p_fifo)
 #error Unsupported compiler
 #endif
 
+/* ---------------------------------------------------------------------------
+ * Multiple item access and statistics, common for all compilers
+ */
+
+/* Positions of the other side of the FIFO are only read, never reserved. */
+#define NRF_ATFIFO_POS_GET(p_tag, field) (((nrf_atfifo_postag_t volatile *)(p_tag))->pos.field)
+
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED
+static void nrf_atfifo_stat_add(uint32_t * const p_stat, uint32_t value)
+{
+    uint32_t new_value;
+    do
+    {
+        new_value = __LDREXW(p_stat) + value;
+    } while (__STREXW(new_value, p_stat) != 0);
+}
+
+
+static void nrf_atfifo_stat_max(uint32_t * const p_stat, uint32_t value)
+{
+    do
+    {
+        if (__LDREXW(p_stat) >= value)
+        {
+            __CLREX();
+            return;
+        }
+    } while (__STREXW(value, p_stat) != 0);
+}
+
+
+static void nrf_atfifo_stat_used(nrf_atfifo_t * const p_fifo, uint16_t tail_wr)
+{
+    int32_t used = (int32_t)tail_wr - (int32_t)NRF_ATFIFO_POS_GET(&p_fifo->head, wr);
+    if (used < 0)
+    {
+        used += p_fifo->buf_size;
+    }
+    nrf_atfifo_stat_max(&p_fifo->stats.max_used, (uint32_t)used / p_fifo->item_size);
+}
+#endif // NRF_ATFIFO_CONFIG_STATS_ENABLED
+
+
+static bool nrf_atfifo_wspace_req_n(nrf_atfifo_t * const p_fifo,
+                                    uint16_t             size,
+                                    nrf_atfifo_postag_t * const p_old_tail)
+{
+    nrf_atfifo_postag_t old_tail;
+    nrf_atfifo_postag_t new_tail;
+    uint32_t            attempts = 0;
+
+    do
+    {
+        uint16_t head_wr;
+        uint16_t space;
+
+        old_tail.tag = __LDREXW(&p_fifo->tail.tag);
+        head_wr      = NRF_ATFIFO_POS_GET(&p_fifo->head, wr);
+
+        /* One item is always left empty, so that a full FIFO can be told from an empty one. */
+        if (head_wr > old_tail.pos.wr)
+        {
+            space = head_wr - old_tail.pos.wr - p_fifo->item_size;
+        }
+        else
+        {
+            space = p_fifo->buf_size - old_tail.pos.wr;
+            if (head_wr == 0)
+            {
+                space -= p_fifo->item_size;
+            }
+        }
+
+        if (size > space)
+        {
+            __CLREX();
+            *p_old_tail = old_tail;
+            return false;
+        }
+
+        new_tail        = old_tail;
+        new_tail.pos.wr = old_tail.pos.wr + size;
+        if (new_tail.pos.wr >= p_fifo->buf_size)
+        {
+            new_tail.pos.wr = 0;
+        }
+        ++attempts;
+    } while (__STREXW(new_tail.tag, &p_fifo->tail.tag) != 0);
+
+    *p_old_tail = old_tail;
+
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED
+    if (attempts > 1)
+    {
+        nrf_atfifo_stat_add(&p_fifo->stats.wr_contended, attempts - 1);
+    }
+    nrf_atfifo_stat_used(p_fifo, new_tail.pos.wr);
+#else
+    UNUSED_VARIABLE(attempts);
+#endif
+    return true;
+}
+
+
+static uint16_t nrf_atfifo_rspace_req_n(nrf_atfifo_t * const p_fifo,
+                                        uint16_t             max_size,
+                                        nrf_atfifo_postag_t * const p_old_head)
+{
+    nrf_atfifo_postag_t old_head;
+    nrf_atfifo_postag_t new_head;
+    uint16_t            size;
+    uint32_t            attempts = 0;
+
+    do
+    {
+        uint16_t tail_rd;
+
+        old_head.tag = __LDREXW(&p_fifo->head.tag);
+        tail_rd      = NRF_ATFIFO_POS_GET(&p_fifo->tail, rd);
+
+        if (tail_rd == old_head.pos.rd)
+        {
+            __CLREX();
+            *p_old_head = old_head;
+            return 0;
+        }
+
+        if (tail_rd > old_head.pos.rd)
+        {
+            size = tail_rd - old_head.pos.rd;
+        }
+        else
+        {
+            size = p_fifo->buf_size - old_head.pos.rd;
+        }
+        if (size > max_size)
+        {
+            size = max_size;
+        }
+
+        new_head        = old_head;
+        new_head.pos.rd = old_head.pos.rd + size;
+        if (new_head.pos.rd >= p_fifo->buf_size)
+        {
+            new_head.pos.rd = 0;
+        }
+        ++attempts;
+    } while (__STREXW(new_head.tag, &p_fifo->head.tag) != 0);
+
+    *p_old_head = old_head;
+
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED
+    if (attempts > 1)
+    {
+        nrf_atfifo_stat_add(&p_fifo->stats.rd_contended, attempts - 1);
+    }
+#else
+    UNUSED_VARIABLE(attempts);
+#endif
+    return size;
+}
+
 #endif /* NRF_ATFIFO_INTERNAL_H__ */
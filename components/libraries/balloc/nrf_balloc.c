@@ -59,6 +59,11 @@
 #define TAIL_GUARD_FILL     0xBAADCAFE      /**< Magic number used to mark tail guard.*/
 #define FREE_MEM_FILL       0xBAADBAAD      /**< Magic number used to mark free memory.*/
 
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+/**@brief Number of blocks moved between a magazine and the shared stack at once. */
+#define MAGAZINE_BATCH      ((NRF_BALLOC_CONFIG_MAGAZINE_SIZE + 1) / 2)
+#endif
+
 #if NRF_BALLOC_CONFIG_DEBUG_ENABLED
 #define POOL_ID(_p_pool) _p_pool->p_name
 #define POOL_MARKER     "%s"
@@ -104,11 +109,54 @@ static void nrf_balloc_status(nrf_cli_t const * p_cli, size_t argc, char **argv)
         nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL,
                         "%s\r\n\t- Element size:\t%d + %d bytes of debug information\r\n"
                         "\t- Usage:\t%u%% (%u out of %u elements)\r\n"
-                        "\t- Maximum:\t%u%% (%u out of %u elements)\r\n\r\n",
+                        "\t- Maximum:\t%u%% (%u out of %u elements)\r\n",
                         p_name, element_size, dbg_addon,
                         100ul * util/pool_size, util,pool_size,
                         100ul * max_util/pool_size, max_util,pool_size);
 
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+        uint32_t hits   = 0;
+        uint32_t misses = 0;
+        uint32_t cached = 0;
+        uint32_t j;
+
+        for (j = 0; j < NRF_BALLOC_CONTEXT_COUNT; j++)
+        {
+            hits   += p_instance->p_cb->magazines[j].hits;
+            misses += p_instance->p_cb->magazines[j].misses;
+            cached += p_instance->p_cb->magazines[j].count;
+        }
+
+        uint64_t total = (uint64_t)hits + misses;
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL,
+                        "\t- Magazines:\t%u%% hit rate (%u hits, %u locked), %u elements cached\r\n",
+                        (uint32_t)((total == 0) ? 0 : ((100ull * hits) / total)),
+                        hits, misses, cached);
+
+        // Print only contexts which used the pool.
+        for (j = 0; j < NRF_BALLOC_CONTEXT_COUNT; j++)
+        {
+            nrf_balloc_magazine_t const * p_mag = &p_instance->p_cb->magazines[j];
+
+            if ((p_mag->hits == 0) && (p_mag->misses == 0))
+            {
+                continue;
+            }
+
+            if (j == NRF_BALLOC_CONTEXT_COUNT - 1)
+            {
+                nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\t\t- Thread mode:");
+            }
+            else
+            {
+                nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\t\t- Priority %u:", j);
+            }
+            nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\t%u hits, %u locked, %u cached\r\n",
+                            p_mag->hits, p_mag->misses, p_mag->count);
+        }
+#endif // NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+
+        nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\r\n");
     }
 }
 // Register "balloc" command and its subcommands in CLI.
@@ -246,6 +294,167 @@ static uint8_t nrf_balloc_block2idx(nrf_balloc_t const * p_pool, void const * p_
     return ((size_t)(p_block) - (size_t)(p_pool->p_memory_begin)) / p_pool->block_size;
 }
 
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+/**@brief  Get the magazine of the current execution context.
+ *
+ * @param[in]   p_pool      Pointer to the memory pool.
+ *
+ * @return      Pointer to the magazine.
+ */
+static nrf_balloc_magazine_t * nrf_balloc_magazine_get(nrf_balloc_t const * p_pool)
+{
+    uint32_t context = current_int_priority_get();
+
+    // Thread Mode uses the last magazine.
+    if (context >= NRF_BALLOC_CONTEXT_COUNT - 1)
+    {
+        context = NRF_BALLOC_CONTEXT_COUNT - 1;
+    }
+
+    return &p_pool->p_cb->magazines[context];
+}
+
+/**@brief  Move blocks from the top of a magazine to the shared stack.
+ *
+ * @note    Must be called in a critical region.
+ *
+ * @param[in]   p_pool      Pointer to the memory pool.
+ * @param[in]   p_mag       Pointer to the magazine.
+ * @param[in]   count       Maximum number of blocks to move.
+ */
+static void nrf_balloc_magazine_drain(nrf_balloc_t const   * p_pool,
+                                      nrf_balloc_magazine_t * p_mag,
+                                      uint8_t                 count)
+{
+    while ((count-- > 0) && (p_mag->count > 0))
+    {
+        *(p_pool->p_cb->p_stack_pointer)++ = p_mag->idx[--(p_mag->count)];
+    }
+}
+
+/**@brief  Mark the magazine as being changed by the current context, which owns it.
+ *
+ * @param[in]   p_mag       Pointer to the magazine.
+ */
+static void nrf_balloc_magazine_lock(nrf_balloc_magazine_t * p_mag)
+{
+    p_mag->busy = 1;
+    __DMB();
+}
+
+/**@brief  Clear the mark set by @ref nrf_balloc_magazine_lock.
+ *
+ * @param[in]   p_mag       Pointer to the magazine.
+ */
+static void nrf_balloc_magazine_unlock(nrf_balloc_magazine_t * p_mag)
+{
+    __DMB();
+    p_mag->busy = 0;
+}
+
+/**@brief  Take a block cached in the magazine of another context.
+ *
+ * Magazines of contexts preempted while changing their magazine are skipped.
+ *
+ * @note    Must be called in a critical region.
+ *
+ * @param[in]   p_pool      Pointer to the memory pool.
+ *
+ * @return      Pointer to the block or NULL if all magazines are empty.
+ */
+static void * nrf_balloc_magazine_steal(nrf_balloc_t const * p_pool)
+{
+    for (uint32_t i = 0; i < NRF_BALLOC_CONTEXT_COUNT; i++)
+    {
+        nrf_balloc_magazine_t * p_mag = &p_pool->p_cb->magazines[i];
+
+        if (!p_mag->busy && (p_mag->count > 0))
+        {
+            return nrf_balloc_idx2block(p_pool, p_mag->idx[--(p_mag->count)]);
+        }
+    }
+
+    return NULL;
+}
+
+/**@brief  Update utilization statistics after an allocation.
+ *
+ * @param[in]   p_pool      Pointer to the memory pool.
+ */
+static void nrf_balloc_utilization_increment(nrf_balloc_t const * p_pool)
+{
+    uint8_t utilization = (uint8_t)nrf_atomic_u32_add(&p_pool->p_cb->utilization, 1);
+
+    // The maximum changes rarely, so check it before locking.
+    if (utilization > p_pool->p_cb->max_utilization)
+    {
+        CRITICAL_REGION_ENTER();
+
+        if (p_pool->p_cb->max_utilization < utilization)
+        {
+            p_pool->p_cb->max_utilization = utilization;
+        }
+
+        CRITICAL_REGION_EXIT();
+    }
+}
+#endif // NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+
+#if NRF_BALLOC_CONFIG_DEBUG_ENABLED
+/**@brief  Check if the block can be returned to the pool.
+ *
+ * @note    Must be called in a critical region.
+ *
+ * @param[in]   p_pool      Pointer to the memory pool.
+ * @param[in]   p_block     Pointer to the beginning of the block.
+ * @param[in]   p_element   Pointer to the element.
+ */
+static void nrf_balloc_free_check(nrf_balloc_t const * p_pool, void * p_block, void * p_element)
+{
+    if (NRF_BALLOC_DEBUG_BASIC_CHECKS_GET(p_pool->debug_flags))
+    {
+        // Check for allocated/free ballance.
+        if (nrf_balloc_utilization_get(p_pool) == 0)
+        {
+            NRF_LOG_INST_ERROR(p_pool->p_log,
+                               "Attempted to free an element (0x%08X) while the pool is full.",
+                               p_element);
+            APP_ERROR_CHECK_BOOL(false);
+        }
+    }
+
+    if (NRF_BALLOC_DEBUG_DOUBLE_FREE_CHECK_GET(p_pool->debug_flags))
+    {
+        bool double_free = false;
+
+        // Check for double free.
+        for (uint8_t * p_idx = p_pool->p_stack_base; p_idx < p_pool->p_cb->p_stack_pointer; p_idx++)
+        {
+            double_free |= (nrf_balloc_idx2block(p_pool, *p_idx) == p_block);
+        }
+
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+        for (uint32_t i = 0; i < NRF_BALLOC_CONTEXT_COUNT; i++)
+        {
+            nrf_balloc_magazine_t const * p_mag = &p_pool->p_cb->magazines[i];
+
+            for (uint8_t j = 0; j < p_mag->count; j++)
+            {
+                double_free |= (nrf_balloc_idx2block(p_pool, p_mag->idx[j]) == p_block);
+            }
+        }
+#endif
+
+        if (double_free)
+        {
+            NRF_LOG_INST_ERROR(p_pool->p_log, "Attempted to double-free an element (0x%08X).",
+                               p_element);
+            APP_ERROR_CHECK_BOOL(false);
+        }
+    }
+}
+#endif // NRF_BALLOC_CONFIG_DEBUG_ENABLED
+
 ret_code_t nrf_balloc_init(nrf_balloc_t const * p_pool)
 {
     uint8_t pool_size;
@@ -284,6 +493,11 @@ ret_code_t nrf_balloc_init(nrf_balloc_t const * p_pool)
 
     p_pool->p_cb->max_utilization = 0;
 
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+    p_pool->p_cb->utilization = 0;
+    memset(p_pool->p_cb->magazines, 0, sizeof(p_pool->p_cb->magazines));
+#endif
+
     return NRF_SUCCESS;
 }
 
@@ -293,6 +507,49 @@ void * nrf_balloc_alloc(nrf_balloc_t const * p_pool)
 
     void * p_block = NULL;
 
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+    nrf_balloc_magazine_t * p_mag = nrf_balloc_magazine_get(p_pool);
+
+    nrf_balloc_magazine_lock(p_mag);
+    if (p_mag->count > 0)
+    {
+        // Allocate block from the magazine.
+        p_mag->hits++;
+        p_block = nrf_balloc_idx2block(p_pool, p_mag->idx[--(p_mag->count)]);
+    }
+    nrf_balloc_magazine_unlock(p_mag);
+
+    if (p_block == NULL)
+    {
+        p_mag->misses++;
+
+        CRITICAL_REGION_ENTER();
+
+        if (p_pool->p_cb->p_stack_pointer > p_pool->p_stack_base)
+        {
+            // Allocate block and refill the magazine with a batch of blocks.
+            p_block = nrf_balloc_idx2block(p_pool, *--(p_pool->p_cb->p_stack_pointer));
+
+            while ((p_mag->count < MAGAZINE_BATCH) &&
+                   (p_pool->p_cb->p_stack_pointer > p_pool->p_stack_base))
+            {
+                p_mag->idx[(p_mag->count)++] = *--(p_pool->p_cb->p_stack_pointer);
+            }
+        }
+        else
+        {
+            // Shared stack is empty, use a block cached by another context.
+            p_block = nrf_balloc_magazine_steal(p_pool);
+        }
+
+        CRITICAL_REGION_EXIT();
+    }
+
+    if (p_block != NULL)
+    {
+        nrf_balloc_utilization_increment(p_pool);
+    }
+#else
     CRITICAL_REGION_ENTER();
 
     if (p_pool->p_cb->p_stack_pointer > p_pool->p_stack_base)
@@ -309,6 +566,7 @@ void * nrf_balloc_alloc(nrf_balloc_t const * p_pool)
     }
 
     CRITICAL_REGION_EXIT();
+#endif // NRF_BALLOC_CONFIG_MAGAZINE_SIZE
 
 #if NRF_BALLOC_CONFIG_DEBUG_ENABLED
     if (p_block != NULL)
@@ -359,41 +617,77 @@ void nrf_balloc_free(nrf_balloc_t const * p_pool, void * p_element)
     void * p_block = p_element;
 #endif // NRF_BALLOC_CONFIG_DEBUG_ENABLED
 
-    CRITICAL_REGION_ENTER();
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+    nrf_balloc_magazine_t * p_mag = nrf_balloc_magazine_get(p_pool);
 
 #if NRF_BALLOC_CONFIG_DEBUG_ENABLED
-    // These checks have to be done in critical region as they use p_pool->p_stack_pointer.
-    if (NRF_BALLOC_DEBUG_BASIC_CHECKS_GET(p_pool->debug_flags))
+    // These checks have to be done in critical region as they use the stack and the magazines.
+    if (NRF_BALLOC_DEBUG_BASIC_CHECKS_GET(p_pool->debug_flags) ||
+        NRF_BALLOC_DEBUG_DOUBLE_FREE_CHECK_GET(p_pool->debug_flags))
     {
-        // Check for allocated/free ballance.
-        if (p_pool->p_cb->p_stack_pointer >= p_pool->p_stack_limit)
-        {
-            NRF_LOG_INST_ERROR(p_pool->p_log,
-                               "Attempted to free an element (0x%08X) while the pool is full.",
-                               p_element);
-            APP_ERROR_CHECK_BOOL(false);
-        }
+        CRITICAL_REGION_ENTER();
+        nrf_balloc_free_check(p_pool, p_block, p_element);
+        CRITICAL_REGION_EXIT();
     }
+#endif // NRF_BALLOC_CONFIG_DEBUG_ENABLED
 
-    if (NRF_BALLOC_DEBUG_DOUBLE_FREE_CHECK_GET(p_pool->debug_flags))
+    UNUSED_RETURN_VALUE(nrf_atomic_u32_sub(&p_pool->p_cb->utilization, 1));
+
+    bool cached = false;
+
+    nrf_balloc_magazine_lock(p_mag);
+    if (p_mag->count < NRF_BALLOC_CONFIG_MAGAZINE_SIZE)
     {
-        // Check for double free.
-        for (uint8_t * p_idx = p_pool->p_stack_base; p_idx < p_pool->p_cb->p_stack_pointer; p_idx++)
-        {
-            if (nrf_balloc_idx2block(p_pool, *p_idx) == p_block)
-            {
-                NRF_LOG_INST_ERROR(p_pool->p_log, "Attempted to double-free an element (0x%08X).",
-                                   p_element);
-                APP_ERROR_CHECK_BOOL(false);
-            }
-        }
+        // Free the element to the magazine.
+        p_mag->hits++;
+        p_mag->idx[(p_mag->count)++] = nrf_balloc_block2idx(p_pool, p_block);
+        cached = true;
+    }
+    nrf_balloc_magazine_unlock(p_mag);
+
+    if (!cached)
+    {
+        p_mag->misses++;
+
+        CRITICAL_REGION_ENTER();
+
+        // Return a batch of blocks to the shared stack and cache the element.
+        nrf_balloc_magazine_drain(p_pool, p_mag, MAGAZINE_BATCH);
+        p_mag->idx[(p_mag->count)++] = nrf_balloc_block2idx(p_pool, p_block);
+
+        CRITICAL_REGION_EXIT();
     }
+#else
+    CRITICAL_REGION_ENTER();
+
+#if NRF_BALLOC_CONFIG_DEBUG_ENABLED
+    // These checks have to be done in critical region as they use p_pool->p_stack_pointer.
+    nrf_balloc_free_check(p_pool, p_block, p_element);
 #endif // NRF_BALLOC_CONFIG_DEBUG_ENABLED
 
     // Free the element.
     *(p_pool->p_cb->p_stack_pointer)++ = nrf_balloc_block2idx(p_pool, p_block);
 
     CRITICAL_REGION_EXIT();
+#endif // NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+}
+
+void nrf_balloc_magazine_flush(nrf_balloc_t const * p_pool)
+{
+    ASSERT(p_pool != NULL);
+
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+    nrf_balloc_magazine_t * p_mag = nrf_balloc_magazine_get(p_pool);
+
+    if (p_mag->count > 0)
+    {
+        CRITICAL_REGION_ENTER();
+        nrf_balloc_magazine_drain(p_pool, p_mag, p_mag->count);
+        CRITICAL_REGION_EXIT();
+    }
+#else
+    UNUSED_PARAMETER(p_pool);
+#endif
 }
 
 #endif // NRF_MODULE_ENABLED(NRF_BALLOC)
@@ -100,11 +100,43 @@ extern "C" {
     #define NRF_BALLOC_DEFAULT_DEBUG_FLAGS   0
 #endif // NRF_BALLOC_CONFIG_DEBUG_ENABLED
 
+#ifndef NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+#define NRF_BALLOC_CONFIG_MAGAZINE_SIZE 0
+#endif
+
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+#include "nrf_atomic.h"
+
+/**@brief Number of execution contexts with a separate magazine: Thread Mode and every interrupt
+ *        priority level.
+ */
+#define NRF_BALLOC_CONTEXT_COUNT    ((1UL << __NVIC_PRIO_BITS) + 1)
+
+/**@brief Cache of free blocks owned by a single execution context.
+ *
+ * A magazine is changed without a critical region only by the context that owns it. Contexts that
+ * can preempt it use their own magazines. When the shared stack is empty, another context takes
+ * blocks from the magazine in a critical region, unless the owner was preempted while changing it.
+ */
+typedef struct
+{
+    uint32_t hits;                                  //!< Allocations and frees served by the magazine.
+    uint32_t misses;                                //!< Allocations and frees that locked the shared stack.
+    volatile uint8_t busy;                          //!< Set while the owner changes the magazine.
+    uint8_t  count;                                 //!< Number of cached blocks.
+    uint8_t  idx[NRF_BALLOC_CONFIG_MAGAZINE_SIZE];  //!< Indexes of the cached blocks.
+} nrf_balloc_magazine_t;
+#endif // NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+
 /**@brief Block memory allocator control block.*/
 typedef struct
 {
     uint8_t * p_stack_pointer;          //!< Current allocation stack pointer.
     uint8_t   max_utilization;          //!< Maximum utilization of the memory pool.
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+    nrf_atomic_u32_t      utilization;  //!< Number of allocated elements.
+    nrf_balloc_magazine_t magazines[NRF_BALLOC_CONTEXT_COUNT]; //!< Per-context caches of free blocks.
+#endif
 } nrf_balloc_cb_t;
 
 /**@brief Block memory allocator pool instance. The pool is made of elements of the same size. */
@@ -339,10 +371,26 @@ __STATIC_INLINE uint8_t nrf_balloc_utilization_get(nrf_balloc_t const * p_pool);
 __STATIC_INLINE uint8_t nrf_balloc_utilization_get(nrf_balloc_t const * p_pool)
 {
     ASSERT(p_pool != NULL);
-    return (p_pool->p_stack_limit - p_pool->p_cb->p_stack_pointer);
+#if NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+    // Elements cached in the magazines are free, so the count is kept separately.
+    return (uint8_t)(p_pool->p_cb->utilization);
+#else
+    return p_pool->p_stack_limit - p_pool->p_cb->p_stack_pointer;
+#endif
 }
 #endif //SUPPRESS_INLINE_IMPLEMENTATION
 
+/**@brief Function for returning all elements cached by the current execution context to the pool.
+ *
+ * Elements cached in a magazine (see @ref NRF_BALLOC_CONFIG_MAGAZINE_SIZE) are taken by other
+ * contexts only when the shared stack runs out, which requires a critical region. Call this function
+ * before a context stays idle for a long time to return these elements in advance. The function
+ * does nothing if magazines are disabled.
+ *
+ * @param[in]   p_pool  Pointer to the memory pool.
+ */
+void nrf_balloc_magazine_flush(nrf_balloc_t const * p_pool);
+
 #ifdef __cplusplus
 }
 #endif
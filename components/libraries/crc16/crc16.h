@@ -56,6 +56,15 @@
 extern "C" {
 #endif
 
+/**@brief Implementations of the @ref crc16_compute function, selected with CRC16_IMPLEMENTATION.
+ *
+ * All implementations produce identical results. They trade flash for speed.
+ */
+#define CRC16_IMPLEMENTATION_SHIFT       0 /**< Byte-wise shift-and-XOR computation. No lookup table. */
+#define CRC16_IMPLEMENTATION_TABLE       1 /**< One 256-entry lookup table (512 bytes of flash). */
+#define CRC16_IMPLEMENTATION_SLICE_BY_4  2 /**< Four bytes per step using four tables (2 KB of flash). */
+#define CRC16_IMPLEMENTATION_SLICE_BY_8  3 /**< Eight bytes per step using eight tables (4 KB of flash). */
+
 /**@brief Function for calculating CRC-16 in blocks.
  *
  * Feed each consecutive data block into this function, along with the current value of p_crc as
@@ -55,6 +55,15 @@
 extern "C" {
 #endif
 
+/**@brief Implementations of the @ref crc32_compute function, selected with CRC32_IMPLEMENTATION.
+ *
+ * All implementations produce identical results. They trade flash for speed.
+ */
+#define CRC32_IMPLEMENTATION_BITWISE     0 /**< Bit-by-bit computation. Smallest and slowest. */
+#define CRC32_IMPLEMENTATION_TABLE       1 /**< One 256-entry lookup table (1 KB of flash). */
+#define CRC32_IMPLEMENTATION_SLICE_BY_4  2 /**< Four bytes per step using four tables (4 KB of flash). */
+#define CRC32_IMPLEMENTATION_SLICE_BY_8  3 /**< Eight bytes per step using eight tables (8 KB of flash). */
+
 /**@brief Function for calculating CRC-32 in blocks.
  *
  * Feed each consecutive data block into this function, along with the current value of p_crc as
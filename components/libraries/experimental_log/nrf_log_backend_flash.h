@@ -91,6 +91,11 @@ typedef struct {
  * Flash logger backend consists of two logical backends: flashlog and crashlog. Since both
  * backends write to the same flash area, the initialization is common.
  *
+ * Both backends write to one ring of segments. When the area is full, the oldest segment is
+ * erased, so the entries of an earlier crash are overwritten like any other entries. Each crash
+ * log starts with a CRASHLOG marker entry. Read it out after the reset which followed the crash,
+ * before enough new entries are logged to wrap the ring.
+ *
  * @param p_fs_api fstorage API to be used.
  *
  * @return NRF_SUCCESS or error code returned by @ref nrf_fstorage_init.
@@ -100,7 +105,9 @@ ret_code_t nrf_log_backend_flash_init(nrf_fstorage_api_t const * p_fs_api);
 /**
  * @brief Function for getting a log entry stored in flash.
  *
- * Log messages stored in flash can be read one by one starting from the oldest one.
+ * Log messages stored in flash can be read one by one starting from the oldest one. Entries are
+ * stored compressed, so they are decoded into an internal buffer which is valid until the next
+ * call.
  *
  * @param[in, out] p_token   Token reused between consecutive readings of log entries.
  *                           Token must be set to 0 to read the first entry.
@@ -110,11 +117,29 @@ ret_code_t nrf_log_backend_flash_init(nrf_fstorage_api_t const * p_fs_api);
  * @retval NRF_SUCCESS             Entry was successfully read.
  * @retval NRF_ERROR_NOT_SUPPORTED fstorage API does not support direct reading.
  * @retval NRF_ERROR_NOT_FOUND     Entry not found. Last entry was already reached or area is empty.
+ * @retval NRF_ERROR_INVALID_PARAM Token does not point to an entry.
  */
 ret_code_t nrf_log_backend_flash_next_entry_get(uint32_t *          p_token,
                                                nrf_log_header_t * * pp_header,
                                                uint8_t * *          pp_data);
 
+/**
+ * @brief Function for finding the first log entry which is not older than the given timestamp.
+ *
+ * Flash log area is split into segments (one per page). Each segment header holds the timestamp
+ * of its first entry, so only one segment is decoded to find the entry. Timestamps are assumed to
+ * grow monotonically.
+ *
+ * @param[out] p_token   Token to be used with @ref nrf_log_backend_flash_next_entry_get.
+ * @param[in]  timestamp Timestamp.
+ *
+ * @retval NRF_SUCCESS             Token is set. If all entries are older than the timestamp,
+ *                                 token points to the end of the log.
+ * @retval NRF_ERROR_NOT_SUPPORTED fstorage API does not support direct reading.
+ * @retval NRF_ERROR_NOT_FOUND     Flash log is empty.
+ */
+ret_code_t nrf_log_backend_flash_seek(uint32_t * p_token, uint32_t timestamp);
+
 /**
  * @brief Function for erasing flash area dedicated for the flash logger backend.
  */
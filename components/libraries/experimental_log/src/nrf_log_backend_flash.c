@@ -41,37 +41,76 @@
 #if NRF_MODULE_ENABLED(NRF_LOG) && NRF_MODULE_ENABLED(NRF_LOG_BACKEND_FLASH)
 #include "nrf_log_backend_flash.h"
 #include "nrf_log_str_formatter.h"
+#if NRF_LOG_BACKEND_FLASH_IN_RAM
+#include "nrf_fstorage_ram.h"
+#else
 #include "nrf_fstorage_nvmc.h"
+#endif
 #include "nrf_log.h"
 #include "nrf_atomic.h"
 #include "nrf_queue.h"
 #include "app_error.h"
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
 
 #if (NRF_LOG_BACKEND_FLASHLOG_ENABLED == 0) && (NRF_LOG_BACKEND_CRASHLOG_ENABLED == 0)
 #error "No flash backend enabled."
 #endif
 
-/** @brief Maximum logger message payload (arguments or data in hexdump) which can be stored. */
-#define FLASH_LOG_MAX_PAYLOAD_SIZE (NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE - sizeof(nrf_log_header_t))
-
 /** @brief Size of serialization buffer in words. */
 #define FLASH_LOG_SER_BUFFER_WORDS (NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE/sizeof(uint32_t))
 
-/** @brief Length of logger header. */
-#define LOG_HEADER_LEN             (sizeof(nrf_log_header_t))
+/** @brief Maximum length of varint encoded 32 bit value. */
+#define VARINT_MAX_LEN             5
 
-/** @brief Length of logger header given in 32 bit words. */
-#define LOG_HEADER_LEN_WORDS       (LOG_HEADER_LEN/sizeof(uint32_t))
+/** @brief Maximum length of encoded entry without arguments or hexdump data.
+ *
+ * Tag followed by at most four values: dropped count, timestamp, module ID and hexdump length
+ * (or raw header in case of standard entry which is shorter than varint).
+ */
+#define ENTRY_PREFIX_MAX_LEN       (1 + 4*VARINT_MAX_LEN)
 
-/** @brief Maximum possible length of standard log message. */
-#define STD_LOG_MSG_MAX_LEN (LOG_HEADER_LEN + NRF_LOG_MAX_NUM_OF_ARGS*sizeof(uint32_t))
+/** @brief Maximum possible length of encoded standard log message. */
+#define STD_LOG_MSG_MAX_LEN        (ENTRY_PREFIX_MAX_LEN + NRF_LOG_MAX_NUM_OF_ARGS*VARINT_MAX_LEN)
 
 /* Buffer must be multiple of 4. */
 STATIC_ASSERT((NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE % sizeof(uint32_t)) == 0);
 
+/** @brief Number of recently used format string and module pairs remembered by the encoder. */
+#define FLASH_LOG_DICT_SIZE        8
+
+/** @brief Marker of valid segment header ("SLOG"). */
+#define FLASH_LOG_SEGMENT_MAGIC    0x474F4C53
+
+/** @brief Value of erased flash word. */
+#define FLASH_LOG_ERASED_WORD      0xFFFFFFFF
+
+/* Entry tag: bits 7-6 - type, bit 5 - dropped count present, bits 2-0 - dictionary index of
+ * repeated standard entry or severity of hexdump. */
+#define TAG_TYPE_POS               6
+#define TAG_TYPE_STD_REF           0    /**< Standard entry with format string from dictionary. */
+#define TAG_TYPE_STD               1    /**< Standard entry with raw header. */
+#define TAG_TYPE_HEXDUMP           2    /**< Hexdump entry. */
+#define TAG_DROPPED                (1U << 5)
+#define TAG_VAL_MASK               0x07
+#define TAG_PAD                    0xC0 /**< Padding up to the word boundary. */
+#define TAG_RECORD                 0xC1 /**< Start of record, followed by record length in words. */
+#define TAG_END                    0xFF /**< Erased flash, no more entries in the segment. */
+
+/* Record: record tag, length in words, entries and at least one padding byte. Since flash words
+ * are programmed in order, a record is complete only if its last byte is not erased. */
+#define RECORD_HDR_LEN             2
+
+/** @brief Record overhead: record header and at least one trailing padding byte. */
+#define RECORD_OVERHEAD            (RECORD_HDR_LEN + 1)
+
 /* Buffer must fit standard log message. */
-STATIC_ASSERT(NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE >= STD_LOG_MSG_MAX_LEN);
+STATIC_ASSERT(NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE >=
+              CEIL_DIV(RECORD_OVERHEAD + STD_LOG_MSG_MAX_LEN, sizeof(uint32_t))*sizeof(uint32_t));
+
+/* Record length in words must fit in the record header. */
+STATIC_ASSERT(NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE <= (UINT8_MAX*sizeof(uint32_t)));
 
 /** @brief Flash page size in bytes. */
 #define CODE_PAGE_SIZE        4096
@@ -89,7 +128,9 @@ STATIC_ASSERT(NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE >= STD_LOG_MSG_MAX_LEN);
  *
  * If configuration indicates that flash log should be placed after application.
  * */
-#if defined ( __CC_ARM )
+#if NRF_LOG_BACKEND_FLASH_IN_RAM
+#define RUNTIME_START_ADDR nrf_fstorage_ram_start_addr()
+#elif defined ( __CC_ARM )
 #define RUNTIME_START_ADDR                                                                           \
                _Pragma("diag_suppress 170")                                                          \
                ((NRF_LOG_BACKEND_FLASH_START_PAGE == 0) ?                                            \
@@ -99,6 +140,14 @@ STATIC_ASSERT(NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE >= STD_LOG_MSG_MAX_LEN);
 #define RUNTIME_START_ADDR ((NRF_LOG_BACKEND_FLASH_START_PAGE == 0) ? \
                (CODE_PAGE_SIZE*CEIL_DIV((uint32_t)CODE_END, CODE_PAGE_SIZE)) : FLASH_LOG_START_ADDR)
 #endif
+
+/** @brief fstorage API used in panic mode, when flash must be written synchronously. */
+#if NRF_LOG_BACKEND_FLASH_IN_RAM
+#define PANIC_FSTORAGE_API nrf_fstorage_ram
+#else
+#define PANIC_FSTORAGE_API nrf_fstorage_nvmc
+#endif
+
 static void fstorage_evt_handler(nrf_fstorage_evt_t * p_evt);
 
 /** @brief Message queue for run time flash log. */
@@ -142,118 +191,725 @@ typedef enum
     LOG_BACKEND_FLASH_IN_PANIC, /**< Flash backend is in panic mode. Incoming messages are written to flash in synchronous mode. */
 } log_backend_flash_state_t;
 
+/** @brief Segment header placed at the beginning of each flash page.
+ *
+ * Header is written when the segment is opened. Entry count is written when the segment is
+ * closed, it stays erased in the segment which is currently written.
+ */
+typedef struct
+{
+    uint32_t magic;           /**< @ref FLASH_LOG_SEGMENT_MAGIC. */
+    uint32_t seq;             /**< Sequence number, incremented with each opened segment. */
+    uint32_t first_timestamp; /**< Timestamp of the first entry in the segment. */
+    uint32_t entry_cnt;       /**< Number of entries in the closed segment. */
+} flash_log_segment_hdr_t;
+
+/** @brief Encoder and decoder state.
+ *
+ * State is reset at the beginning of each segment so that every segment can be decoded
+ * independently.
+ */
+typedef struct
+{
+    uint32_t hdr[FLASH_LOG_DICT_SIZE];                           /**< Raw headers of standard entries. */
+    uint16_t module_id[FLASH_LOG_DICT_SIZE];                     /**< Module IDs of standard entries. */
+    uint32_t args[FLASH_LOG_DICT_SIZE][NRF_LOG_MAX_NUM_OF_ARGS]; /**< Last arguments, base for deltas. */
+    uint32_t timestamp;                                          /**< Timestamp of the last entry. */
+    uint8_t  next;                                               /**< Dictionary slot to be replaced. */
+} flash_log_codec_t;
+
+/** @brief Segment reader. */
+typedef struct
+{
+    flash_log_codec_t codec;    /**< Decoder state. */
+    uint32_t          seg_addr; /**< Address of the segment being read. */
+    uint32_t          seg_seq;  /**< Sequence number of the segment being read. */
+    uint32_t          addr;     /**< Address of the next entry. */
+    uint32_t          rec_end;  /**< End address of the record being read. */
+} flash_log_reader_t;
+
+/** @brief Flash operations performed by the backend. */
+typedef enum
+{
+    FLASH_OP_NONE,
+    FLASH_OP_SEGMENT_CLOSE, /**< Writing entry count of the current segment. */
+    FLASH_OP_SEGMENT_ERASE, /**< Erasing page of the next segment. */
+    FLASH_OP_SEGMENT_OPEN,  /**< Writing header of the next segment. */
+    FLASH_OP_RECORD,        /**< Writing record of encoded entries. */
+} flash_op_t;
+
 static log_backend_flash_state_t m_state;                      /**< Flash logger backend state. */
 static nrf_atomic_flag_t         m_busy_flag;                  /**< Flag indicating if module performs flash writing. */
 static uint32_t                  m_flash_buf[FLASH_LOG_SER_BUFFER_WORDS]; /**< Buffer used for serializing messages. */
 static uint32_t                  m_curr_addr;                  /**< Address of free spot in the storage area. */
-static size_t                    m_curr_len;                   /**< Length of current message being written. */
+static size_t                    m_curr_len;                   /**< Length of current record being written. */
+static uint32_t                  m_rec_entries;                /**< Number of entries in the current record. */
 static uint32_t                  m_dropped;                    /**< Number of dropped messages. */
+static flash_op_t                m_op;                         /**< Flash operation in progress. */
+static flash_log_codec_t         m_codec;                      /**< Encoder state of the current segment. */
+static uint32_t                  m_seg_addr;                   /**< Current segment or segment to be opened. */
+static uint32_t                  m_seg_seq;                    /**< Sequence number of the last opened segment. */
+static uint32_t                  m_seg_entries;                /**< Number of entries in the current segment. */
+static bool                      m_seg_open;                   /**< True if the current segment accepts records. */
+static flash_log_segment_hdr_t   m_seg_hdr;                    /**< Buffer for segment header write. */
+static bool                      m_marker_pending;             /**< Crashlog marker to be written. */
+static flash_log_reader_t        m_reader;                     /**< Reader used by @ref nrf_log_backend_flash_next_entry_get. */
+static nrf_log_header_t          m_read_header;                /**< Last decoded header. */
+static uint32_t                  m_read_data[FLASH_LOG_SER_BUFFER_WORDS]; /**< Last decoded arguments or data. */
 
 /** @brief Log message string injected when entering panic mode. */
 static const char crashlog_str[] =  "-----------CRASHLOG------------\r\n";
 
-/** @brief Function saturates input to maximum possible length and rounds up value to be multiple
- *         of word size.
+static uint32_t varint_put(uint8_t * p_buf, uint32_t value)
+{
+    uint32_t len = 0;
+    while (value >= 0x80)
+    {
+        p_buf[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    p_buf[len++] = (uint8_t)value;
+    return len;
+}
+
+static bool varint_get(uint8_t const * * pp_buf, uint8_t const * p_end, uint32_t * p_value)
+{
+    uint8_t const * p_buf = *pp_buf;
+    uint32_t        value = 0;
+    uint32_t        shift = 0;
+
+    do
+    {
+        if ((p_buf == p_end) || (shift >= 7*VARINT_MAX_LEN))
+        {
+            return false;
+        }
+        value |= (uint32_t)(*p_buf & 0x7F) << shift;
+        shift += 7;
+    } while (*p_buf++ & 0x80);
+
+    *pp_buf  = p_buf;
+    *p_value = value;
+    return true;
+}
+
+static uint32_t zigzag_encode(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t zigzag_decode(uint32_t value)
+{
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static void codec_reset(flash_log_codec_t * p_codec, uint32_t timestamp)
+{
+    memset(p_codec, 0, sizeof(flash_log_codec_t));
+    p_codec->timestamp = timestamp;
+}
+
+/**
+ * @brief Function for encoding a log entry.
  *
- * @param length Length value.
+ * Standard entries with the same format string and module as one of the recent entries refer to
+ * the dictionary instead of storing the header. Arguments are stored as a difference to the
+ * arguments of the previous entry with the same format string and timestamp as a difference to
+ * the previous entry, so counters, addresses and repeated values take single bytes.
  *
- * @return Modified input length.
+ * @param[in,out] p_codec  Encoder state.
+ * @param[in]     p_header Entry header.
+ * @param[in]     p_data   Arguments or hexdump data.
+ * @param[out]    p_buf    Output buffer. Must fit @ref STD_LOG_MSG_MAX_LEN or hexdump data with
+ *                         @ref ENTRY_PREFIX_MAX_LEN.
+ *
+ * @return Length of the encoded entry.
  */
-static uint32_t saturate_align_length(uint32_t length)
+static uint32_t entry_encode(flash_log_codec_t *      p_codec,
+                             nrf_log_header_t const * p_header,
+                             uint8_t const *          p_data,
+                             uint8_t *                p_buf)
 {
-    length = (length > FLASH_LOG_MAX_PAYLOAD_SIZE) ? FLASH_LOG_MAX_PAYLOAD_SIZE : length; //saturate
-    length = CEIL_DIV(length, sizeof(uint32_t))*sizeof(uint32_t);
-    return length;
-}
+    uint32_t len = 1;
+    uint8_t  tag;
+
+    if (p_header->dropped)
+    {
+        len += varint_put(&p_buf[len], p_header->dropped);
+    }
+    len += varint_put(&p_buf[len], zigzag_encode((int32_t)(p_header->timestamp - p_codec->timestamp)));
+    p_codec->timestamp = p_header->timestamp;
+
+    if (p_header->base.generic.type == HEADER_TYPE_STD)
+    {
+        uint32_t const * p_args = (uint32_t const *)p_data;
+        uint32_t         nargs  = p_header->base.std.nargs;
+        uint32_t         idx;
+        uint32_t         i;
+
+        for (idx = 0; idx < FLASH_LOG_DICT_SIZE; idx++)
+        {
+            if ((p_codec->hdr[idx] == p_header->base.raw) &&
+                (p_codec->module_id[idx] == p_header->module_id))
+            {
+                break;
+            }
+        }
+
+        if (idx < FLASH_LOG_DICT_SIZE)
+        {
+            tag = (uint8_t)((TAG_TYPE_STD_REF << TAG_TYPE_POS) | idx);
+        }
+        else
+        {
+            idx = p_codec->next;
+            p_codec->next = (uint8_t)((idx + 1) % FLASH_LOG_DICT_SIZE);
+            p_codec->hdr[idx]       = p_header->base.raw;
+            p_codec->module_id[idx] = p_header->module_id;
+            memset(p_codec->args[idx], 0, sizeof(p_codec->args[idx]));
+
+            tag = (uint8_t)(TAG_TYPE_STD << TAG_TYPE_POS);
+            len += uint32_encode(p_header->base.raw, &p_buf[len]);
+            len += varint_put(&p_buf[len], p_header->module_id);
+        }
+
+        for (i = 0; i < nargs; i++)
+        {
+            len += varint_put(&p_buf[len], zigzag_encode((int32_t)(p_args[i] - p_codec->args[idx][i])));
+            p_codec->args[idx][i] = p_args[i];
+        }
+    }
+    else
+    {
+        tag = (uint8_t)((TAG_TYPE_HEXDUMP << TAG_TYPE_POS) |
+                        (p_header->base.hexdump.severity & TAG_VAL_MASK));
+        len += varint_put(&p_buf[len], p_header->module_id);
+        len += varint_put(&p_buf[len], p_header->base.hexdump.len);
+        memcpy(&p_buf[len], p_data, p_header->base.hexdump.len);
+        len += p_header->base.hexdump.len;
+    }
 
+    p_buf[0] = (uint8_t)(tag | (p_header->dropped ? TAG_DROPPED : 0));
+    return len;
+}
 
 /**
- * @brief Function for copying logger message to the buffer.
+ * @brief Function for decoding a log entry.
  *
- * @param[in]     p_msg Logger message.
- * @param[out]    p_buf Output buffer where serialized message is placed.
- * @param[in,out] p_len Buffer size as input, length of prepared data as output.
+ * @param[in,out] p_codec  Decoder state.
+ * @param[in]     p_buf    Encoded entry.
+ * @param[in]     p_end    End of the segment.
+ * @param[out]    p_header Decoded header.
+ * @param[out]    p_data   Decoded arguments or hexdump data. Must fit @ref NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE.
  *
- * @return True if message fits into the buffer, false otherwise
+ * @return Length of the entry or 0 if there is no valid entry at the given location.
  */
-static bool msg_to_buf(nrf_log_entry_t * p_msg, uint8_t * p_buf, size_t * p_len)
+static uint32_t entry_decode(flash_log_codec_t * p_codec,
+                             uint8_t const *     p_buf,
+                             uint8_t const *     p_end,
+                             nrf_log_header_t *  p_header,
+                             uint8_t *           p_data)
 {
-    uint32_t         data_len;
-    nrf_log_header_t header = {0};
-    uint32_t         memobj_offset = HEADER_SIZE*sizeof(uint32_t);
+    uint8_t const * p_in    = p_buf + 1;
+    uint32_t        tag     = p_buf[0];
+    uint32_t        type    = tag >> TAG_TYPE_POS;
+    uint32_t        dropped = 0;
+    uint32_t        value;
 
-    nrf_memobj_read(p_msg, &header, HEADER_SIZE*sizeof(uint32_t), 0);
+    if ((tag & TAG_DROPPED) && !varint_get(&p_in, p_end, &dropped))
+    {
+        return 0;
+    }
+    if (!varint_get(&p_in, p_end, &value))
+    {
+        return 0;
+    }
 
-    memcpy(p_buf, &header, sizeof(nrf_log_header_t));
-    p_buf +=  sizeof(nrf_log_header_t);
+    memset(p_header, 0, sizeof(nrf_log_header_t));
+    p_header->dropped   = (uint16_t)dropped;
+    p_header->timestamp = p_codec->timestamp + (uint32_t)zigzag_decode(value);
 
-    switch (header.base.generic.type)
+    if ((type == TAG_TYPE_STD_REF) || (type == TAG_TYPE_STD))
     {
-        case HEADER_TYPE_STD:
+        uint32_t * p_args = (uint32_t *)p_data;
+        uint32_t   idx;
+        uint32_t   i;
+
+        if (type == TAG_TYPE_STD_REF)
         {
-            data_len = header.base.std.nargs * sizeof(uint32_t);
-            break;
+            idx = tag & TAG_VAL_MASK;
+            if (p_codec->hdr[idx] == 0)
+            {
+                return 0;
+            }
         }
-        case HEADER_TYPE_HEXDUMP:
+        else
         {
-            data_len = saturate_align_length(header.base.hexdump.len);
-            break;
+            uint32_t raw;
+            uint32_t module_id;
+
+            if ((p_end - p_in) < (int32_t)sizeof(uint32_t))
+            {
+                return 0;
+            }
+            raw = uint32_decode(p_in);
+            p_in += sizeof(uint32_t);
+            if (!varint_get(&p_in, p_end, &module_id))
+            {
+                return 0;
+            }
+
+            idx = p_codec->next;
+            p_codec->next = (uint8_t)((idx + 1) % FLASH_LOG_DICT_SIZE);
+            p_codec->hdr[idx]       = raw;
+            p_codec->module_id[idx] = (uint16_t)module_id;
+            memset(p_codec->args[idx], 0, sizeof(p_codec->args[idx]));
         }
-        default:
-            *p_len = 0;
+
+        p_header->base.raw  = p_codec->hdr[idx];
+        p_header->module_id = p_codec->module_id[idx];
+        if ((p_header->base.generic.type != HEADER_TYPE_STD) ||
+            (p_header->base.std.nargs > NRF_LOG_MAX_NUM_OF_ARGS))
+        {
+            return 0;
+        }
+
+        for (i = 0; i < p_header->base.std.nargs; i++)
+        {
+            if (!varint_get(&p_in, p_end, &value))
+            {
+                return 0;
+            }
+            p_codec->args[idx][i] += (uint32_t)zigzag_decode(value);
+            p_args[i] = p_codec->args[idx][i];
+        }
+    }
+    else if (type == TAG_TYPE_HEXDUMP)
+    {
+        uint32_t module_id;
+        uint32_t len;
+
+        if (!varint_get(&p_in, p_end, &module_id) ||
+            !varint_get(&p_in, p_end, &len) ||
+            (len > NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE) ||
+            ((p_end - p_in) < (int32_t)len))
+        {
+            return 0;
+        }
+        p_header->base.hexdump.type     = HEADER_TYPE_HEXDUMP;
+        p_header->base.hexdump.severity = tag & TAG_VAL_MASK;
+        p_header->base.hexdump.len      = len;
+        p_header->module_id             = (uint16_t)module_id;
+        memcpy(p_data, p_in, len);
+        p_in += len;
+    }
+    else
+    {
+        return 0;
+    }
+
+    p_codec->timestamp = p_header->timestamp;
+    return (uint32_t)(p_in - p_buf);
+}
+
+static flash_log_segment_hdr_t const * segment_hdr_get(uint32_t seg_addr)
+{
+    return (flash_log_segment_hdr_t const *)nrf_fstorage_rmap(&m_log_flash_fstorage, seg_addr);
+}
+
+static bool segment_valid(flash_log_segment_hdr_t const * p_hdr)
+{
+    return (p_hdr->magic == FLASH_LOG_SEGMENT_MAGIC) && (p_hdr->seq != FLASH_LOG_ERASED_WORD);
+}
+
+/**
+ * @brief Function for checking if the whole page of the segment is erased.
+ *
+ * Erase which failed or was cut short by a reset may leave the beginning of the page erased and
+ * the rest of it with the records of the old segment, so the header alone is not enough.
+ */
+static bool segment_erased(uint32_t seg_addr)
+{
+    uint32_t const * p_word = (uint32_t const *)nrf_fstorage_rmap(&m_log_flash_fstorage, seg_addr);
+    uint32_t         i;
+
+    for (i = 0; i < CODE_PAGE_SIZE/sizeof(uint32_t); i++)
+    {
+        if (p_word[i] != FLASH_LOG_ERASED_WORD)
+        {
             return false;
+        }
     }
-    nrf_memobj_read(p_msg, p_buf, data_len, memobj_offset);
+    return true;
+}
 
-    if (*p_len >= sizeof(nrf_log_header_t) + data_len)
+/** @brief Function for getting the segment which follows the given one in the ring. */
+static uint32_t segment_next(uint32_t seg_addr)
+{
+    seg_addr += CODE_PAGE_SIZE;
+    return (seg_addr >= RUNTIME_START_ADDR + FLASH_LOG_SIZE) ? RUNTIME_START_ADDR : seg_addr;
+}
+
+/**
+ * @brief Function for finding the oldest or the newest valid segment.
+ *
+ * @return Segment address or 0 if flash log area is empty.
+ */
+static uint32_t segment_find(bool newest)
+{
+    uint32_t seg_addr = RUNTIME_START_ADDR;
+    uint32_t found    = 0;
+    uint32_t found_seq = 0;
+    uint32_t i;
+
+    for (i = 0; i < NRF_LOG_BACKEND_PAGES; i++)
     {
-        *p_len = sizeof(nrf_log_header_t) + data_len;
-        return true;
+        flash_log_segment_hdr_t const * p_hdr = segment_hdr_get(seg_addr);
+        if (segment_valid(p_hdr) &&
+            ((found == 0) || (newest ? (p_hdr->seq > found_seq) : (p_hdr->seq < found_seq))))
+        {
+            found     = seg_addr;
+            found_seq = p_hdr->seq;
+        }
+        seg_addr += CODE_PAGE_SIZE;
     }
-    else
+    return found;
+}
+
+static void reader_segment_set(flash_log_reader_t * p_reader, uint32_t seg_addr)
+{
+    flash_log_segment_hdr_t const * p_hdr = segment_hdr_get(seg_addr);
+
+    p_reader->seg_addr = seg_addr;
+    p_reader->seg_seq  = p_hdr->seq;
+    p_reader->addr     = seg_addr + sizeof(flash_log_segment_hdr_t);
+    p_reader->rec_end  = p_reader->addr;
+    codec_reset(&p_reader->codec, p_hdr->first_timestamp);
+}
+
+/**
+ * @brief Function for entering the record which starts at the current reader position.
+ *
+ * @return True if there is a complete record, false if the segment ends (erased or torn record).
+ */
+static bool reader_record_start(flash_log_reader_t * p_reader)
+{
+    uint8_t const * p_buf = (uint8_t const *)p_reader->addr;
+    uint32_t        end   = p_reader->seg_addr + CODE_PAGE_SIZE;
+    uint32_t        len;
+
+    if ((p_reader->addr + RECORD_HDR_LEN > end) || (p_buf[0] != TAG_RECORD))
+    {
+        return false;
+    }
+
+    len = p_buf[1]*sizeof(uint32_t);
+    if ((len < RECORD_OVERHEAD) || (p_reader->addr + len > end) || (p_buf[len - 1] != TAG_PAD))
     {
         return false;
     }
+
+    p_reader->rec_end = p_reader->addr + len;
+    p_reader->addr   += RECORD_HDR_LEN;
+    return true;
 }
 
 /**
- * @brief Function for getting logger message stored in flash.
+ * @brief Function for decoding the next entry.
  *
- * @param[in]  p_buf     Pointer to the location where message is stored.
- * @param[out] pp_header Pointer to the log message header.
- * @param[out] pp_data   Pointer to the log message data (arguments or data in case of hexdump).
+ * When the end of the segment is reached, reading continues in the following segment if it is
+ * newer. Otherwise, the reader stays at the end of the log.
  *
- * @return True if message was successfully fetched, false otherwise.
+ * @return True if entry was decoded, false if there are no more entries.
  */
-static bool msg_from_buf(uint32_t *           p_buf,
-                         nrf_log_header_t * * pp_header,
-                         uint8_t * *          pp_data,
-                         uint32_t *           p_len)
+static bool reader_next(flash_log_reader_t * p_reader,
+                        nrf_log_header_t *   p_header,
+                        uint8_t *            p_data)
 {
-    *pp_header = (nrf_log_header_t *)p_buf;
-    *pp_data = (uint8_t *)&p_buf[LOG_HEADER_LEN_WORDS];
+    while (1)
+    {
+        if (p_reader->addr < p_reader->rec_end)
+        {
+            uint8_t const * p_buf = (uint8_t const *)p_reader->addr;
+            uint8_t const * p_end = (uint8_t const *)p_reader->rec_end;
+
+            while ((p_buf < p_end) && (*p_buf == TAG_PAD))
+            {
+                p_buf++;
+            }
+            if (p_buf == p_end)
+            {
+                p_reader->addr = p_reader->rec_end;
+                continue;
+            }
 
-    uint32_t data_len;
+            uint32_t len = entry_decode(&p_reader->codec, p_buf, p_end, p_header, p_data);
+            if (len > 0)
+            {
+                p_reader->addr = (uint32_t)(p_buf + len);
+                return true;
+            }
+        }
+        else if (reader_record_start(p_reader))
+        {
+            continue;
+        }
+
+        uint32_t                        next_addr = segment_next(p_reader->seg_addr);
+        flash_log_segment_hdr_t const * p_next    = segment_hdr_get(next_addr);
+
+        if (!segment_valid(p_next) || (p_next->seq <= p_reader->seg_seq))
+        {
+            return false;
+        }
+        reader_segment_set(p_reader, next_addr);
+    }
+}
 
-    switch ((*pp_header)->base.generic.type)
+/**
+ * @brief Function for recovering the reader state for the given token.
+ *
+ * If token does not match the current position of the reader, the decoder state is rebuilt by
+ * decoding the segment up to the token. The same happens if the segment of the reader was erased
+ * and reopened since it was read (its sequence number changed), because the token then points to
+ * data which is not related to the cached decoder state.
+ */
+static ret_code_t reader_sync(uint32_t token)
+{
+    if (token == 0)
     {
-        case HEADER_TYPE_STD:
+        uint32_t oldest = segment_find(false);
+        if (oldest == 0)
+        {
+            return NRF_ERROR_NOT_FOUND;
+        }
+        reader_segment_set(&m_reader, oldest);
+        return NRF_SUCCESS;
+    }
+
+    if ((token == m_reader.addr) && (segment_hdr_get(m_reader.seg_addr)->seq == m_reader.seg_seq))
+    {
+        return NRF_SUCCESS;
+    }
+
+    if ((token <= RUNTIME_START_ADDR) || (token > RUNTIME_START_ADDR + FLASH_LOG_SIZE))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    uint32_t seg_addr = token - ((token - 1 - RUNTIME_START_ADDR) % CODE_PAGE_SIZE) - 1;
+
+    if (!segment_valid(segment_hdr_get(seg_addr)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    reader_segment_set(&m_reader, seg_addr);
+    while ((m_reader.seg_addr == seg_addr) && (m_reader.addr < token))
+    {
+        if (!reader_next(&m_reader, &m_read_header, (uint8_t *)m_read_data))
         {
-            data_len = ((*pp_header)->base.std.nargs)*sizeof(uint32_t);
             break;
         }
-        case HEADER_TYPE_HEXDUMP:
+    }
+
+    return (m_reader.addr == token) ? NRF_SUCCESS : NRF_ERROR_INVALID_PARAM;
+}
+
+/**
+ * @brief Function for packing queued log messages into a record.
+ *
+ * Messages are encoded until the record buffer is full. Hexdump which does not fit into an empty
+ * record is trimmed. Messages are released as soon as they are encoded. Record is padded to the
+ * word boundary with at least one padding byte and its length is stored in the record header.
+ */
+static void record_prepare(nrf_queue_t const * p_queue)
+{
+    uint8_t *         p_buf = (uint8_t *)m_flash_buf;
+    uint32_t          len   = RECORD_HDR_LEN;
+    nrf_log_entry_t * p_msg;
+
+    m_rec_entries = 0;
+
+    if (m_marker_pending)
+    {
+        nrf_log_header_t crashlog_marker_hdr = {
+                .base = {
+                    .std = {
+                         .type = HEADER_TYPE_STD,
+                         .severity = NRF_LOG_SEVERITY_INFO_RAW,
+                         .nargs = 0,
+                         .addr = (uint32_t)crashlog_str & STD_ADDR_MASK
+                    }
+                },
+                .module_id = 0,
+                .timestamp = m_codec.timestamp,
+        };
+        len += entry_encode(&m_codec, &crashlog_marker_hdr, NULL, &p_buf[len]);
+        m_rec_entries++;
+        m_marker_pending = false;
+    }
+
+    while ((p_queue != NULL) && (nrf_queue_peek(p_queue, &p_msg) == NRF_SUCCESS))
+    {
+        uint32_t         data[FLASH_LOG_SER_BUFFER_WORDS];
+        uint32_t         data_len;
+        uint32_t         max_len;
+        nrf_log_header_t header = {0};
+
+        nrf_memobj_read(p_msg, &header, HEADER_SIZE*sizeof(uint32_t), 0);
+
+        if (header.base.generic.type == HEADER_TYPE_STD)
+        {
+            data_len = header.base.std.nargs*sizeof(uint32_t);
+            max_len  = ENTRY_PREFIX_MAX_LEN + header.base.std.nargs*VARINT_MAX_LEN;
+        }
+        else if (header.base.generic.type == HEADER_TYPE_HEXDUMP)
         {
+            uint32_t available = sizeof(m_flash_buf) - 1 - len - ENTRY_PREFIX_MAX_LEN;
+            if ((m_rec_entries == 0) && (header.base.hexdump.len > available))
+            {
+                header.base.hexdump.len = available;
+            }
+            data_len = header.base.hexdump.len;
+            max_len  = ENTRY_PREFIX_MAX_LEN + data_len;
+        }
+        else
+        {
+            UNUSED_RETURN_VALUE(nrf_queue_pop(p_queue, &p_msg));
+            nrf_memobj_put(p_msg);
+            continue;
+        }
 
-            data_len = saturate_align_length((*pp_header)->base.hexdump.len);
+        if (len + max_len + 1 > sizeof(m_flash_buf))
+        {
             break;
         }
-        default:
-            return false;
+
+        nrf_memobj_read(p_msg, data, data_len, HEADER_SIZE*sizeof(uint32_t));
+        len += entry_encode(&m_codec, &header, (uint8_t const *)data, &p_buf[len]);
+        m_rec_entries++;
+
+        UNUSED_RETURN_VALUE(nrf_queue_pop(p_queue, &p_msg));
+        nrf_memobj_put(p_msg);
     }
 
-    *p_len = LOG_HEADER_LEN + data_len;
-    return true;
+    if (m_rec_entries == 0)
+    {
+        m_curr_len = 0;
+        return;
+    }
+
+    do
+    {
+        p_buf[len++] = TAG_PAD;
+    } while ((len % sizeof(uint32_t)) != 0);
+
+    p_buf[0]   = TAG_RECORD;
+    p_buf[1]   = (uint8_t)(len / sizeof(uint32_t));
+    m_curr_len = len;
+}
+
+/**
+ * @brief Function for starting the next flash operation.
+ *
+ * Queued messages are written as records. Before a record is prepared, it is ensured that the
+ * current segment has space for a full record. If not, the segment is closed and the next page in
+ * the ring is erased (if needed) and opened. The oldest segment is overwritten when the area is
+ * full. Operations are repeatable, so the pending one can be restarted (e.g. after entering panic
+ * mode).
+ *
+ * @retval NRF_SUCCESS         Operation started.
+ * @retval NRF_ERROR_NOT_FOUND Nothing to write.
+ * @return Other errors returned by fstorage.
+ */
+static ret_code_t flash_op_start(nrf_queue_t const * p_queue)
+{
+    if (m_curr_len == 0)
+    {
+        nrf_log_entry_t * p_msg = NULL;
+
+        if (!m_marker_pending &&
+            ((p_queue == NULL) || (nrf_queue_peek(p_queue, &p_msg) != NRF_SUCCESS)))
+        {
+            return NRF_ERROR_NOT_FOUND;
+        }
+
+        if (m_seg_open &&
+            ((m_seg_addr + CODE_PAGE_SIZE - m_curr_addr) < NRF_LOG_BACKEND_FLASH_SER_BUFFER_SIZE))
+        {
+            m_seg_hdr.entry_cnt = m_seg_entries;
+            m_op = FLASH_OP_SEGMENT_CLOSE;
+            return nrf_fstorage_write(&m_log_flash_fstorage,
+                                      m_seg_addr + offsetof(flash_log_segment_hdr_t, entry_cnt),
+                                      &m_seg_hdr.entry_cnt,
+                                      sizeof(uint32_t),
+                                      NULL);
+        }
+
+        if (!m_seg_open)
+        {
+            if (!segment_erased(m_seg_addr))
+            {
+                m_op = FLASH_OP_SEGMENT_ERASE;
+                return nrf_fstorage_erase(&m_log_flash_fstorage, m_seg_addr, 1, NULL);
+            }
+
+            nrf_log_header_t header = {0};
+            if (p_msg != NULL)
+            {
+                nrf_memobj_read(p_msg, &header, HEADER_SIZE*sizeof(uint32_t), 0);
+            }
+            m_seg_hdr.magic           = FLASH_LOG_SEGMENT_MAGIC;
+            m_seg_hdr.seq             = m_seg_seq + 1;
+            m_seg_hdr.first_timestamp = m_marker_pending ? m_codec.timestamp : header.timestamp;
+            m_op = FLASH_OP_SEGMENT_OPEN;
+            return nrf_fstorage_write(&m_log_flash_fstorage,
+                                      m_seg_addr,
+                                      &m_seg_hdr,
+                                      offsetof(flash_log_segment_hdr_t, entry_cnt),
+                                      NULL);
+        }
+
+        record_prepare(p_queue);
+        if (m_curr_len == 0)
+        {
+            return NRF_ERROR_NOT_FOUND;
+        }
+    }
+
+    m_op = FLASH_OP_RECORD;
+    return nrf_fstorage_write(&m_log_flash_fstorage, m_curr_addr, m_flash_buf, m_curr_len, NULL);
+}
+
+/** @brief Function for updating the state after successful flash operation. */
+static void flash_op_complete(void)
+{
+    switch (m_op)
+    {
+        case FLASH_OP_SEGMENT_CLOSE:
+            m_seg_open = false;
+            m_seg_addr = segment_next(m_seg_addr);
+            break;
+
+        case FLASH_OP_SEGMENT_OPEN:
+            m_seg_open    = true;
+            m_seg_seq     = m_seg_hdr.seq;
+            m_seg_entries = 0;
+            m_curr_addr   = m_seg_addr + sizeof(flash_log_segment_hdr_t);
+            codec_reset(&m_codec, m_seg_hdr.first_timestamp);
+            break;
+
+        case FLASH_OP_RECORD:
+            m_curr_addr   += m_curr_len;
+            m_seg_entries += m_rec_entries;
+            m_curr_len     = 0;
+            break;
+
+        default:
+            break;
+    }
+    m_op = FLASH_OP_NONE;
 }
 
 /**
@@ -263,35 +919,22 @@ static bool msg_from_buf(uint32_t *           p_buf,
  * If writing to flash is asynchronous then function starts single write operation. In asynchronous mode
  * function is called when new message is put into the queue from from flash operation callback.
  *
- * Function detects the situation that flash module reports attempt to write outside dedicated area.
- * In that case flash backend stops writing any new messages.
- *
  * @param p_queue           Queue will log messages
  * @param fstorage_blocking If true it indicates that flash operations are blocking, event handler is not used.
  */
 static void log_msg_queue_process(nrf_queue_t const * p_queue, bool fstorage_blocking)
 {
-    nrf_log_entry_t * p_msg;
-    bool              busy = false;
-    while (nrf_queue_pop(p_queue, &p_msg) == NRF_SUCCESS)
-    {
-        ret_code_t err_code;
-
-        m_curr_len = sizeof(m_flash_buf);
-        if (!msg_to_buf(p_msg, (uint8_t *)m_flash_buf, &m_curr_len))
-        {
-            continue;
-        }
+    bool busy = false;
 
-        err_code = nrf_fstorage_write(&m_log_flash_fstorage, m_curr_addr, m_flash_buf, m_curr_len, p_msg);
+    while (1)
+    {
+        ret_code_t err_code = flash_op_start(p_queue);
 
         if (err_code == NRF_SUCCESS)
         {
             if (fstorage_blocking)
             {
-                m_curr_addr += m_curr_len;
-
-                nrf_memobj_put(p_msg);
+                flash_op_complete();
             }
             else
             {
@@ -299,22 +942,21 @@ static void log_msg_queue_process(nrf_queue_t const * p_queue, bool fstorage_blo
                 break;
             }
         }
-        else if (!fstorage_blocking && (err_code == NRF_ERROR_NO_MEM))
+        else if (err_code == NRF_ERROR_NOT_FOUND)
         {
-            // fstorage queue got full. Drop entry.
-            nrf_memobj_put(p_msg);
-            m_dropped++;
             break;
         }
-        else if (err_code == NRF_ERROR_INVALID_ADDR)
+        else if (!fstorage_blocking && (err_code == NRF_ERROR_NO_MEM))
         {
-            // Trying to write outside the area, flash log is full. Skip any new writes.
-            nrf_memobj_put(p_msg);
-            m_state = LOG_BACKEND_FLASH_INACTIVE;
+            // fstorage queue got full. Operation is restarted when next entry is put.
+            m_op = FLASH_OP_NONE;
+            break;
         }
         else
         {
-            ASSERT(false);
+            m_op = FLASH_OP_NONE;
+            m_state = LOG_BACKEND_FLASH_INACTIVE;
+            break;
         }
     }
 
@@ -341,21 +983,19 @@ static void fstorage_evt_handler(nrf_fstorage_evt_t * p_evt)
         switch (p_evt->id)
         {
             case NRF_FSTORAGE_EVT_WRITE_RESULT:
+            case NRF_FSTORAGE_EVT_ERASE_RESULT:
             {
                 if (p_evt->result == NRF_SUCCESS)
                 {
-                    m_curr_addr += m_curr_len;
-                    m_curr_len = 0;
+                    flash_op_complete();
                     log_msg_queue_process(mp_flashlog_queue, false);
                 }
                 else
                 {
-                    m_dropped++;
-                }
-
-                if (p_evt->p_param)
-                {
-                    nrf_memobj_put((nrf_log_entry_t *)p_evt->p_param);
+                    // Operation is repeated when next entry is put. Record is kept in the buffer
+                    // and written again to the same location.
+                    m_op = FLASH_OP_NONE;
+                    UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&m_busy_flag));
                 }
                 break;
             }
@@ -449,43 +1089,23 @@ void nrf_log_backend_flashlog_panic_set(nrf_log_backend_t const * p_backend)
     /* Empty */
 }
 
-/**
- * @brief Function for injecting log message which will indicate start of crash log.
- */
-static void crashlog_marker_inject(void)
-{
-    nrf_log_header_t crashlog_marker_hdr = {
-            .base = {
-                .std = {
-                     .type = HEADER_TYPE_STD,
-                     .severity = NRF_LOG_SEVERITY_INFO_RAW,
-                     .nargs = 0,
-                     .addr = (uint32_t)crashlog_str & STD_ADDR_MASK
-                }
-            },
-            .module_id = 0,
-            .timestamp = 0,
-    };
-    m_flash_buf[0] = crashlog_marker_hdr.base.raw;
-    m_flash_buf[1] = crashlog_marker_hdr.module_id;
-    m_flash_buf[2] = crashlog_marker_hdr.timestamp;
-    (void)nrf_fstorage_write(&m_log_flash_fstorage, m_curr_addr, m_flash_buf, LOG_HEADER_LEN, NULL);
-    m_curr_addr += LOG_HEADER_LEN;
-}
-
-
 void nrf_log_backend_crashlog_panic_set(nrf_log_backend_t const * p_backend)
 {
-    if (nrf_fstorage_init(&m_log_flash_fstorage, &nrf_fstorage_nvmc, NULL) == NRF_SUCCESS)
+    if (nrf_fstorage_init(&m_log_flash_fstorage, &PANIC_FSTORAGE_API, NULL) == NRF_SUCCESS)
     {
         m_state = LOG_BACKEND_FLASH_IN_PANIC;
 
+#if !NRF_LOG_BACKEND_FLASH_IN_RAM
         /* In case of Softdevice MWU may protect access to NVMC. */
         NVIC_DisableIRQ(MWU_IRQn);
+#endif
+
+        /* Operation interrupted by the panic is restarted. */
+        m_op = FLASH_OP_NONE;
 
         log_msg_queue_process(mp_flashlog_queue, true);
 
-        crashlog_marker_inject();
+        m_marker_pending = true;
 
         log_msg_queue_process(mp_crashlog_queue, true);
     }
@@ -496,20 +1116,59 @@ void nrf_log_backend_crashlog_panic_set(nrf_log_backend_t const * p_backend)
 }
 
 /**
- * @brief Function for determining first empty location in area dedicated for flash logger backend.
+ * @brief Function for restoring the write position from the content of the flash log area.
+ *
+ * Writing continues in the newest segment if it was not closed. Encoder state is restored by
+ * decoding the segment. If the segment ends with a damaged entry (e.g. reset during write), it
+ * is closed and writing continues in the next one.
  */
-static uint32_t empty_addr_get(void)
+static void write_position_restore(void)
 {
-    uint32_t token = 0;
-    nrf_log_header_t * p_dummy_header;
-    uint8_t * p_dummy_data;
+    uint32_t newest = segment_find(true);
 
-    while(nrf_log_backend_flash_next_entry_get(&token, &p_dummy_header, &p_dummy_data) == NRF_SUCCESS)
+    m_seg_open    = false;
+    m_seg_seq     = 0;
+    m_seg_entries = 0;
+    m_seg_addr    = RUNTIME_START_ADDR;
+    m_curr_len    = 0;
+    m_op          = FLASH_OP_NONE;
+
+    if (newest == 0)
+    {
+        return;
+    }
+
+    flash_log_segment_hdr_t const * p_hdr = segment_hdr_get(newest);
+    m_seg_seq = p_hdr->seq;
+
+    if (p_hdr->entry_cnt != FLASH_LOG_ERASED_WORD)
+    {
+        m_seg_addr = segment_next(newest);
+        return;
+    }
+
+    flash_log_reader_t * p_reader = &m_reader;
+    reader_segment_set(p_reader, newest);
+    while ((p_reader->seg_addr == newest) &&
+           reader_next(p_reader, &m_read_header, (uint8_t *)m_read_data))
     {
+        m_seg_entries++;
+    }
 
+    m_seg_open  = true;
+    m_seg_addr  = newest;
+    m_curr_addr = p_reader->addr;
+    m_codec     = p_reader->codec;
+
+    if (((m_curr_addr % sizeof(uint32_t)) != 0) ||
+        ((m_curr_addr < newest + CODE_PAGE_SIZE) &&
+         (*(uint32_t const *)m_curr_addr != FLASH_LOG_ERASED_WORD)))
+    {
+        m_curr_addr = newest + CODE_PAGE_SIZE;
     }
 
-    return token;
+    /* Force reader synchronization on the next read. */
+    p_reader->addr = 0;
 }
 
 
@@ -530,9 +1189,18 @@ ret_code_t nrf_log_backend_flash_init(nrf_fstorage_api_t const * p_fs_api)
         return err_code;
     }
 
-    m_curr_addr = empty_addr_get();
+    if (nrf_fstorage_rmap(&m_log_flash_fstorage, start_addr) == NULL)
+    {
+        //Supports only memories which can be mapped for reading.
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    write_position_restore();
     m_state  = LOG_BACKEND_FLASH_ACTIVE;
 
+    /* An operation cut short by a reset never completes. */
+    UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&m_busy_flag));
+
     return err_code;
 }
 
@@ -541,26 +1209,82 @@ ret_code_t nrf_log_backend_flash_next_entry_get(uint32_t *                p_toke
                                                 nrf_log_header_t * *      pp_header,
                                                 uint8_t * *               pp_data)
 {
-    uint32_t * p_addr = p_token;
-    uint32_t   len;
-
-    *p_addr = (*p_addr == 0) ? RUNTIME_START_ADDR : *p_addr;
+    ret_code_t err_code;
 
-    if (nrf_fstorage_rmap(&m_log_flash_fstorage, *p_addr) == NULL)
+    if (nrf_fstorage_rmap(&m_log_flash_fstorage, RUNTIME_START_ADDR) == NULL)
     {
         //Supports only memories which can be mapped for reading.
         return NRF_ERROR_NOT_SUPPORTED;
     }
 
-    if (msg_from_buf((uint32_t *)*p_addr, pp_header, pp_data, &len))
+    err_code = reader_sync(*p_token);
+    if (err_code != NRF_SUCCESS)
     {
-        *p_addr += len;
-        return NRF_SUCCESS;
+        return err_code;
     }
-    else
+
+    bool found = reader_next(&m_reader, &m_read_header, (uint8_t *)m_read_data);
+    *p_token = m_reader.addr;
+    if (!found)
     {
         return NRF_ERROR_NOT_FOUND;
     }
+
+    *pp_header = &m_read_header;
+    *pp_data   = (uint8_t *)m_read_data;
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_log_backend_flash_seek(uint32_t * p_token, uint32_t timestamp)
+{
+    if (nrf_fstorage_rmap(&m_log_flash_fstorage, RUNTIME_START_ADDR) == NULL)
+    {
+        //Supports only memories which can be mapped for reading.
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    uint32_t seg_addr = segment_find(false);
+    if (seg_addr == 0)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    /* Find the last segment which starts before the timestamp using segment headers only. Entries
+     * with the same timestamp may precede a segment which starts with it. */
+    uint32_t seq = segment_hdr_get(seg_addr)->seq;
+    while (1)
+    {
+        uint32_t                        next_addr = segment_next(seg_addr);
+        flash_log_segment_hdr_t const * p_next    = segment_hdr_get(next_addr);
+
+        if (!segment_valid(p_next) || (p_next->seq <= seq) || (p_next->first_timestamp >= timestamp))
+        {
+            break;
+        }
+        seg_addr = next_addr;
+        seq      = p_next->seq;
+    }
+
+    /* Decode the segment up to the first entry which is not older than the timestamp. */
+    reader_segment_set(&m_reader, seg_addr);
+    while (1)
+    {
+        flash_log_reader_t prev = m_reader;
+
+        if (!reader_next(&m_reader, &m_read_header, (uint8_t *)m_read_data))
+        {
+            break;
+        }
+        if ((int32_t)(m_read_header.timestamp - timestamp) >= 0)
+        {
+            m_reader = prev;
+            break;
+        }
+    }
+
+    *p_token = m_reader.addr;
+    return NRF_SUCCESS;
 }
 
 
@@ -571,11 +1295,17 @@ ret_code_t nrf_log_backend_flash_erase(void)
     m_state = LOG_BACKEND_FLASH_INACTIVE;
     err_code = nrf_fstorage_erase(&m_log_flash_fstorage, RUNTIME_START_ADDR, NRF_LOG_BACKEND_PAGES, NULL);
 
-    m_curr_addr = RUNTIME_START_ADDR;
+    m_dropped     += (m_curr_len > 0) ? m_rec_entries : 0;
+    m_curr_len     = 0;
+    m_seg_open     = false;
+    m_seg_seq      = 0;
+    m_seg_entries  = 0;
+    m_seg_addr     = RUNTIME_START_ADDR;
+    m_curr_addr    = RUNTIME_START_ADDR;
+    m_reader.addr  = 0;
 
     return err_code;
 }
-
 #if NRF_LOG_BACKEND_FLASHLOG_ENABLED
 const nrf_log_backend_api_t nrf_log_backend_flashlog_api = {
         .put       = nrf_log_backend_flashlog_put,
@@ -684,6 +1414,16 @@ static void flashlog_read_cmd(nrf_cli_t const * p_cli, size_t argc, char ** argv
     bool               empty  = true;
     nrf_log_header_t * p_header;
 
+    if (argc > 1)
+    {
+        /* Start from the first entry not older than the given timestamp. */
+        if (nrf_log_backend_flash_seek(&token, (uint32_t)strtoul(argv[1], NULL, 0)) != NRF_SUCCESS)
+        {
+            nrf_cli_fprintf(p_cli, NRF_CLI_ERROR, "Flash log empty\r\n");
+            return;
+        }
+    }
+
     while (1)
     {
         if (nrf_log_backend_flash_next_entry_get(&token, &p_header, &p_data) == NRF_SUCCESS)
@@ -714,10 +1454,34 @@ static void flashlog_status_cmd(nrf_cli_t const * p_cli, size_t argc, char ** ar
     nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "Flash log status:\r\n");
     nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\t\t- Location (address: 0x%08X, length: %d)\r\n",
                                                                 RUNTIME_START_ADDR, FLASH_LOG_SIZE);
+
+    uint32_t seg_addr = RUNTIME_START_ADDR;
+    uint32_t segments = 0;
+    uint32_t entries  = m_seg_open ? m_seg_entries : 0;
+    uint32_t used     = m_seg_open ? (m_curr_addr - m_seg_addr) : 0;
+    uint32_t i;
+
+    for (i = 0; i < NRF_LOG_BACKEND_PAGES; i++)
+    {
+        flash_log_segment_hdr_t const * p_hdr = segment_hdr_get(seg_addr);
+        if (segment_valid(p_hdr))
+        {
+            segments++;
+            if (p_hdr->entry_cnt != FLASH_LOG_ERASED_WORD)
+            {
+                entries += p_hdr->entry_cnt;
+                used    += CODE_PAGE_SIZE;
+            }
+        }
+        seg_addr += CODE_PAGE_SIZE;
+    }
+
     nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\t\t- Current usage:%d%% (%d of %d bytes used)\r\n",
-                                       100ul * (m_curr_addr - RUNTIME_START_ADDR)/FLASH_LOG_SIZE,
-                                       m_curr_addr - RUNTIME_START_ADDR,
+                                       100ul * used/FLASH_LOG_SIZE,
+                                       used,
                                        FLASH_LOG_SIZE);
+    nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\t\t- Segments: %d of %d, entries: %d\r\n",
+                                       segments, NRF_LOG_BACKEND_PAGES, entries);
     nrf_cli_fprintf(p_cli, NRF_CLI_NORMAL, "\t\t- Dropped logs: %d\r\n", m_dropped);
 
 
@@ -727,7 +1491,7 @@ static void flashlog_status_cmd(nrf_cli_t const * p_cli, size_t argc, char ** ar
 NRF_CLI_CREATE_STATIC_SUBCMD_SET(m_flashlog_cmd)
 {
     NRF_CLI_CMD(clear,   NULL, "Remove logs",      flashlog_clear_cmd),
-    NRF_CLI_CMD(read,    NULL, "Read stored logs", flashlog_read_cmd),
+    NRF_CLI_CMD(read,    NULL, "Read stored logs (optionally starting from timestamp)", flashlog_read_cmd),
     NRF_CLI_CMD(status,  NULL, "Flash log status", flashlog_status_cmd),
     NRF_CLI_SUBCMD_SET_END
 };
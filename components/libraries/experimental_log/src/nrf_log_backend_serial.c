@@ -43,6 +43,285 @@
 #include "nrf_log_str_formatter.h"
 #include "nrf_log_internal.h"
 
+#ifndef NRF_LOG_BACKEND_SERIAL_BINARY
+#define NRF_LOG_BACKEND_SERIAL_BINARY 0
+#endif
+
+#if NRF_LOG_BACKEND_SERIAL_BINARY
+/* SLIP framing bytes. */
+#define BIN_FRAME_END     0xC0
+#define BIN_FRAME_ESC     0xDB
+#define BIN_FRAME_ESC_END 0xDC
+#define BIN_FRAME_ESC_ESC 0xDD
+
+#define BIN_TYPE_STD      0
+#define BIN_TYPE_HEXDUMP  1
+
+/* Encoding of standard entry arguments, derived from the format string. */
+#define BIN_ARG_UINT      0
+#define BIN_ARG_INT       1
+#define BIN_ARG_STR       2
+
+typedef struct
+{
+    uint8_t *          p_buffer;
+    uint32_t           length;
+    uint32_t           cnt;
+    nrf_fprintf_fwrite tx_func;
+} bin_writer_t;
+
+static void bin_flush(bin_writer_t * p_writer)
+{
+    if (p_writer->cnt > 0)
+    {
+        p_writer->tx_func(NULL, (char const *)p_writer->p_buffer, p_writer->cnt);
+        p_writer->cnt = 0;
+    }
+}
+
+static void bin_raw_put(bin_writer_t * p_writer, uint8_t byte)
+{
+    p_writer->p_buffer[p_writer->cnt++] = byte;
+    if (p_writer->cnt == p_writer->length)
+    {
+        bin_flush(p_writer);
+    }
+}
+
+static void bin_byte_put(bin_writer_t * p_writer, uint8_t byte)
+{
+    if (byte == BIN_FRAME_END)
+    {
+        bin_raw_put(p_writer, BIN_FRAME_ESC);
+        bin_raw_put(p_writer, BIN_FRAME_ESC_END);
+    }
+    else if (byte == BIN_FRAME_ESC)
+    {
+        bin_raw_put(p_writer, BIN_FRAME_ESC);
+        bin_raw_put(p_writer, BIN_FRAME_ESC_ESC);
+    }
+    else
+    {
+        bin_raw_put(p_writer, byte);
+    }
+}
+
+static void bin_varint_put(bin_writer_t * p_writer, uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        bin_byte_put(p_writer, (uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    bin_byte_put(p_writer, (uint8_t)value);
+}
+
+static void bin_string_put(bin_writer_t * p_writer, char const * p_str)
+{
+    if (p_str != NULL)
+    {
+        while (*p_str != '\0')
+        {
+            bin_byte_put(p_writer, (uint8_t)*p_str++);
+        }
+    }
+    bin_byte_put(p_writer, 0);
+}
+
+/**
+ * @brief Function for determining how each argument of a standard entry is encoded.
+ *
+ * Format string is walked the same way as nrf_fprintf does it. Strings are sent inline since
+ * the pointer is meaningless outside of the device, signed values are zigzag encoded to keep
+ * small negative numbers short.
+ */
+static void bin_arg_kinds_get(char const * p_fmt, uint8_t * p_kinds, uint32_t nargs)
+{
+    uint32_t i;
+
+    for (i = 0; i < nargs; i++)
+    {
+        p_kinds[i] = BIN_ARG_UINT;
+    }
+
+    i = 0;
+    while ((*p_fmt != '\0') && (i < nargs))
+    {
+        if (*p_fmt++ != '%')
+        {
+            continue;
+        }
+        while ((*p_fmt == '-') || (*p_fmt == '0') || (*p_fmt == '+'))
+        {
+            p_fmt++;
+        }
+        if (*p_fmt == '*')
+        {
+            /* Field width taken from the argument list. */
+            i++;
+            p_fmt++;
+        }
+        while ((*p_fmt >= '0') && (*p_fmt <= '9'))
+        {
+            p_fmt++;
+        }
+        if (*p_fmt == '.')
+        {
+            p_fmt++;
+            while ((*p_fmt >= '0') && (*p_fmt <= '9'))
+            {
+                p_fmt++;
+            }
+        }
+        while ((*p_fmt == 'l') || (*p_fmt == 'h'))
+        {
+            p_fmt++;
+        }
+        switch (*p_fmt)
+        {
+            case 'c':
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'p':
+                i++;
+                break;
+            case 'd':
+            case 'i':
+                if (i < nargs)
+                {
+                    p_kinds[i] = BIN_ARG_INT;
+                }
+                i++;
+                break;
+            case 's':
+                if (i < nargs)
+                {
+                    p_kinds[i] = BIN_ARG_STR;
+                }
+                i++;
+                break;
+            default:
+                break;
+        }
+        if (*p_fmt != '\0')
+        {
+            p_fmt++;
+        }
+    }
+}
+
+/**
+ * @brief Function for sending an entry as a binary frame.
+ *
+ * Frame (SLIP encoded, terminated with 0xC0):
+ * - byte: type (bit 0), severity (bits 1-3), nargs (bits 4-6), dropped present (bit 7),
+ * - varint: module ID,
+ * - varint: timestamp (0 if timestamps are disabled),
+ * - varint: number of dropped entries (only if present),
+ * - standard entry: varint string address followed by arguments (varint, zigzag varint or
+ *   null terminated string),
+ * - hexdump entry: varint length followed by raw data.
+ */
+static void serial_bin_put(nrf_log_entry_t * p_msg,
+                           uint8_t * p_buffer,
+                           uint32_t  length,
+                           nrf_fprintf_fwrite tx_func)
+{
+    bin_writer_t writer = {
+            .p_buffer = p_buffer,
+            .length   = length,
+            .cnt      = 0,
+            .tx_func  = tx_func
+    };
+
+    nrf_log_header_t header;
+    uint32_t         memobj_offset = 0;
+    nrf_memobj_read(p_msg, &header, HEADER_SIZE*sizeof(uint32_t), memobj_offset);
+    memobj_offset = HEADER_SIZE*sizeof(uint32_t);
+
+    uint32_t type;
+    uint32_t severity;
+    uint32_t nargs = 0;
+    if (header.base.generic.type == HEADER_TYPE_STD)
+    {
+        type     = BIN_TYPE_STD;
+        severity = header.base.std.severity;
+        nargs    = header.base.std.nargs;
+    }
+    else if (header.base.generic.type == HEADER_TYPE_HEXDUMP)
+    {
+        type     = BIN_TYPE_HEXDUMP;
+        severity = header.base.hexdump.severity;
+    }
+    else
+    {
+        return;
+    }
+
+    bin_byte_put(&writer, (uint8_t)(type | (severity << 1) | (nargs << 4) |
+                                    ((header.dropped ? 1UL : 0UL) << 7)));
+    bin_varint_put(&writer, header.module_id);
+    bin_varint_put(&writer, NRF_LOG_USES_TIMESTAMP ? header.timestamp : 0);
+    if (header.dropped)
+    {
+        bin_varint_put(&writer, header.dropped);
+    }
+
+    if (type == BIN_TYPE_STD)
+    {
+        char const * p_log_str = (char const *)((uint32_t)header.base.std.addr);
+        uint32_t args[NRF_LOG_MAX_NUM_OF_ARGS];
+        uint8_t  kinds[NRF_LOG_MAX_NUM_OF_ARGS];
+        uint32_t i;
+
+        nrf_memobj_read(p_msg, args, nargs*sizeof(uint32_t), memobj_offset);
+        bin_arg_kinds_get(p_log_str, kinds, nargs);
+
+        bin_varint_put(&writer, header.base.std.addr);
+        for (i = 0; i < nargs; i++)
+        {
+            if (kinds[i] == BIN_ARG_STR)
+            {
+                bin_string_put(&writer, (char const *)args[i]);
+            }
+            else if (kinds[i] == BIN_ARG_INT)
+            {
+                bin_varint_put(&writer, (args[i] << 1) ^ (uint32_t)((int32_t)args[i] >> 31));
+            }
+            else
+            {
+                bin_varint_put(&writer, args[i]);
+            }
+        }
+    }
+    else
+    {
+        uint32_t data_len = header.base.hexdump.len;
+        uint8_t  data_buf[8];
+        uint32_t chunk_len;
+        uint32_t i;
+
+        bin_varint_put(&writer, data_len);
+        while (data_len > 0)
+        {
+            chunk_len = sizeof(data_buf) > data_len ? data_len : sizeof(data_buf);
+            nrf_memobj_read(p_msg, data_buf, chunk_len, memobj_offset);
+            memobj_offset += chunk_len;
+            data_len -= chunk_len;
+
+            for (i = 0; i < chunk_len; i++)
+            {
+                bin_byte_put(&writer, data_buf[i]);
+            }
+        }
+    }
+
+    bin_raw_put(&writer, BIN_FRAME_END);
+    bin_flush(&writer);
+}
+#endif //NRF_LOG_BACKEND_SERIAL_BINARY
+
 void nrf_log_backend_serial_put(nrf_log_backend_t const * p_backend,
                                nrf_log_entry_t * p_msg,
                                uint8_t * p_buffer,
@@ -51,6 +330,9 @@ void nrf_log_backend_serial_put(nrf_log_backend_t const * p_backend,
 {
     nrf_memobj_get(p_msg);
 
+#if NRF_LOG_BACKEND_SERIAL_BINARY
+    serial_bin_put(p_msg, p_buffer, length, tx_func);
+#else
     nrf_fprintf_ctx_t fprintf_ctx = {
             .p_io_buffer = (char *)p_buffer,
             .io_buffer_size = length,
@@ -107,9 +389,12 @@ void nrf_log_backend_serial_put(nrf_log_backend_t const * p_backend,
                                          chunk_len,
                                          &params,
                                          &fprintf_ctx);
+            /* Dropped entries are reported once, before the first line. */
+            params.dropped = 0;
         } while (data_len > 0);
     }
-    nrf_memobj_put(p_msg);
     /*lint -restore*/
+#endif //NRF_LOG_BACKEND_SERIAL_BINARY
+    nrf_memobj_put(p_msg);
 }
 #endif //NRF_LOG_ENABLED
@@ -60,7 +60,9 @@ extern "C" {
 /**
  * @brief A function for processing logger entry with simple serial interface as output.
  *
- *
+ * If @ref NRF_LOG_BACKEND_SERIAL_BINARY is enabled, the entry is not formatted. Instead,
+ * it is sent as a SLIP encoded binary frame which is decoded on the host by
+ * tools/nrf_log_bin_decode.py.
  */
 void nrf_log_backend_serial_put(nrf_log_backend_t const * p_backend,
                                nrf_log_entry_t * p_msg,
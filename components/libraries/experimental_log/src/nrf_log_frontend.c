@@ -59,7 +59,33 @@ STATIC_ASSERT(IS_POWER_OF_TWO(NRF_LOG_BUFSIZE));
 #warning "NRF_LOG_BUFSIZE too small, significant number of logs may be lost."
 #endif
 
+#ifndef NRF_LOG_LOCK_FREE
+#define NRF_LOG_LOCK_FREE 0
+#endif
+
+#if NRF_LOG_LOCK_FREE
+// Oldest logs cannot be skipped without locking out the writers.
+#define NRF_LOG_SKIP_OLDEST 0
+
+// Word used to fill free space. It is seen as an entry which is still in progress, so the reader
+// stops on space which is reserved but not yet written.
+#define LOCK_FREE_EMPTY_WORD ((HEADER_TYPE_INVALID << 0) | (1U << 2))
+#else
+#define NRF_LOG_SKIP_OLDEST NRF_LOG_ALLOW_OVERFLOW
+#endif
+
+#ifndef NRF_LOG_MSGPOOL_ARENA_ENABLED
+#define NRF_LOG_MSGPOOL_ARENA_ENABLED 0
+#endif
+
+#if NRF_LOG_MSGPOOL_ARENA_ENABLED
+// Standard entries are stored contiguously. Chunks are left for hexdumps and for overflow.
+NRF_MEMOBJ_CLASS_DEF(log_msgclass, NRF_LOG_MSGPOOL_CLASS_SIZE, NRF_LOG_MSGPOOL_CLASS_COUNT);
+NRF_MEMOBJ_POOL_ARENA_DEF(log_mempool, NRF_LOG_MSGPOOL_ELEMENT_SIZE, NRF_LOG_MSGPOOL_ELEMENT_COUNT,
+                          &log_msgclass);
+#else
 NRF_MEMOBJ_POOL_DEF(log_mempool, NRF_LOG_MSGPOOL_ELEMENT_SIZE, NRF_LOG_MSGPOOL_ELEMENT_COUNT);
+#endif
 
 #define NRF_LOG_BACKENDS_FULL           0xFF
 #define NRF_LOG_FILTER_BITS_PER_BACKEND 3
@@ -118,6 +144,12 @@ ret_code_t nrf_log_init(nrf_log_timestamp_func_t timestamp_func, uint32_t timest
     m_log_data.mask         = NRF_LOG_BUF_WORDS - 1;
     m_log_data.wr_idx       = 0;
     m_log_data.rd_idx       = 0;
+#if NRF_LOG_LOCK_FREE
+    for (uint32_t i = 0; i < NRF_LOG_BUF_WORDS; i++)
+    {
+        m_log_data.buffer[i] = LOCK_FREE_EMPTY_WORD;
+    }
+#endif
     m_log_data.log_skipped  = 0;
     m_log_data.log_skipping = 0;
     m_log_data.autoflush    = NRF_LOG_DEFERRED ? false : true;
@@ -338,6 +370,7 @@ static bool invalid_packets_pushed_str_omit(nrf_log_header_t const * p_header, u
     }
     return ret;
 }
+#if !NRF_LOG_LOCK_FREE
 /**
  * @brief Skips the oldest, not pushed logs to make space for new logs.
  * @details This function moves forward read index to prepare space for new logs.
@@ -398,6 +431,7 @@ static uint32_t log_skip(void)
 
     return (uint32_t)dropped;
 }
+#endif // !NRF_LOG_LOCK_FREE
 
 /**
  * @brief Function for getting number of dropped logs. Dropped counter is reset after reading.
@@ -430,6 +464,9 @@ static inline void std_header_set(uint32_t severity_mid,
         m_log_data.buffer[(wr_idx + 2) & mask] = m_log_data.timestamp_func();
     }
 
+    // Arguments must be stored before the header is validated.
+    __DMB();
+
     nrf_log_header_t * p_header    = (nrf_log_header_t *)&m_log_data.buffer[wr_idx & mask];
     p_header->base.std.severity    = severity_mid & NRF_LOG_LEVEL_MASK;
     p_header->base.std.nargs       = nargs;
@@ -438,13 +475,83 @@ static inline void std_header_set(uint32_t severity_mid,
     p_header->base.std.in_progress = 0;
 }
 
+/**
+ * @brief Marks entry at given index as being in progress.
+ *
+ * @param content_len   Number of 32bit arguments or length of hex dump in bytes.
+ * @param wr_idx        Write index of the entry.
+ * @param std           True for standard entry, false for hex dump.
+ */
+static inline void header_in_progress_set(uint32_t content_len, uint32_t wr_idx, bool std)
+{
+    nrf_log_main_header_t invalid_header;
+    invalid_header.raw = 0;
+
+    if (std)
+    {
+        invalid_header.std.type        = HEADER_TYPE_STD;
+        invalid_header.std.in_progress = 1;
+        invalid_header.std.nargs       = content_len;
+    }
+    else
+    {
+        invalid_header.hexdump.type = HEADER_TYPE_HEXDUMP;
+        invalid_header.hexdump.in_progress = 1;
+        invalid_header.hexdump.len = content_len;
+    }
+
+    nrf_log_main_header_t * p_header = (nrf_log_main_header_t *)&m_log_data.buffer[wr_idx & m_log_data.mask];
+
+    p_header->raw = invalid_header.raw;
+}
+
+#if NRF_LOG_LOCK_FREE
 /**
  * @brief Allocates chunk in a buffer for one entry and injects overflow if
  * there is no room for requested entry.
  *
+ * Write index is moved with compare-and-swap, so entries can be allocated concurrently from any
+ * context without masking interrupts. Entry is marked as being in progress until its header is
+ * written.
+ *
  * @param content_len   Number of 32bit arguments. In case of allocating for hex dump it
  *                      is the size of the buffer in 32bit words (ceiled).
  * @param p_wr_idx      Pointer to write index.
+ * @param std           True for standard entry, false for hex dump.
+ *
+ * @return True if successful allocation, false otherwise.
+ *
+ */
+static inline bool buf_prealloc(uint32_t content_len, uint32_t * p_wr_idx, bool std)
+{
+    uint32_t req_len = content_len + HEADER_SIZE;
+    uint32_t wr_idx  = m_log_data.wr_idx;
+
+    do
+    {
+        uint32_t available_words = (m_log_data.mask + 1) - (wr_idx - m_log_data.rd_idx);
+        if (req_len > available_words)
+        {
+            UNUSED_RETURN_VALUE(nrf_atomic_u32_add(&m_log_data.log_dropped_cnt, 1));
+            return false;
+        }
+    } while (!nrf_atomic_u32_cmp_exch((nrf_atomic_u32_t *)&m_log_data.wr_idx,
+                                      &wr_idx,
+                                      wr_idx + req_len));
+
+    *p_wr_idx = wr_idx;
+    header_in_progress_set(content_len, wr_idx, std);
+    return true;
+}
+#else
+/**
+ * @brief Allocates chunk in a buffer for one entry and injects overflow if
+ * there is no room for requested entry.
+ *
+ * @param content_len   Number of 32bit arguments. In case of allocating for hex dump it
+ *                      is the size of the buffer in 32bit words (ceiled).
+ * @param p_wr_idx      Pointer to write index.
+ * @param std           True for standard entry, false for hex dump.
  *
  * @return True if successful allocation, false otherwise.
  *
@@ -459,7 +566,7 @@ static inline bool buf_prealloc(uint32_t content_len, uint32_t * p_wr_idx, bool
     while (req_len > available_words)
     {
         UNUSED_RETURN_VALUE(nrf_atomic_u32_add(&m_log_data.log_dropped_cnt, 1));
-        if (NRF_LOG_ALLOW_OVERFLOW)
+        if (NRF_LOG_SKIP_OLDEST)
         {
             uint32_t dropped_in_skip = log_skip();
             UNUSED_RETURN_VALUE(nrf_atomic_u32_add(&m_log_data.log_dropped_cnt, dropped_in_skip));
@@ -474,25 +581,7 @@ static inline bool buf_prealloc(uint32_t content_len, uint32_t * p_wr_idx, bool
 
     if (ret)
     {
-        nrf_log_main_header_t invalid_header;
-        invalid_header.raw = 0;
-
-        if (std)
-        {
-            invalid_header.std.type        = HEADER_TYPE_STD;
-            invalid_header.std.in_progress = 1;
-            invalid_header.std.nargs       = content_len;
-        }
-        else
-        {
-            invalid_header.hexdump.type = HEADER_TYPE_HEXDUMP;
-            invalid_header.hexdump.in_progress = 1;
-            invalid_header.hexdump.len = content_len;
-        }
-
-        nrf_log_main_header_t * p_header = (nrf_log_main_header_t *)&m_log_data.buffer[m_log_data.wr_idx & m_log_data.mask];
-
-        p_header->raw = invalid_header.raw;
+        header_in_progress_set(content_len, m_log_data.wr_idx, std);
 
         m_log_data.wr_idx += req_len;
     }
@@ -500,6 +589,7 @@ static inline bool buf_prealloc(uint32_t content_len, uint32_t * p_wr_idx, bool
     CRITICAL_REGION_EXIT();
     return ret;
 }
+#endif // NRF_LOG_LOCK_FREE
 
 
 /**
@@ -508,7 +598,7 @@ static inline bool buf_prealloc(uint32_t content_len, uint32_t * p_wr_idx, bool
  * If buffer does not fit starting from current position it will be allocated at
  * the beginning of the circular buffer and offset will be returned indicating
  * how much memory has been ommited at the end of the buffer. Function is
- * using critical section.
+ * using critical section or compare-and-swap if @ref NRF_LOG_LOCK_FREE is set.
  *
  * @param len32    Length of buffer to allocate. Given in words.
  * @param p_offset Offset of the buffer.
@@ -526,6 +616,31 @@ static inline uint32_t * cont_buf_prealloc(uint32_t len32,
 
     len32 += PUSHED_HEADER_SIZE; // Increment because 32bit header is needed to be stored.
 
+#if NRF_LOG_LOCK_FREE
+    uint32_t wr_idx = m_log_data.wr_idx;
+
+    do
+    {
+        uint32_t available_words = (m_log_data.mask + 1) - (wr_idx - m_log_data.rd_idx);
+        uint32_t tail_words =  (m_log_data.mask + 1) - (wr_idx & m_log_data.mask);
+
+        //available space is continuous
+        uint32_t curr_pos_available = (available_words <= tail_words) ? available_words : tail_words;
+        uint32_t start_pos_available = (available_words <= tail_words) ? 0 : (available_words - tail_words);
+
+        if ((len32 > curr_pos_available) &&
+            ((len32 - PUSHED_HEADER_SIZE) > start_pos_available))
+        {
+            return NULL;
+        }
+        *p_offset = (len32 <= curr_pos_available) ? 0 : (tail_words - PUSHED_HEADER_SIZE);
+    } while (!nrf_atomic_u32_cmp_exch((nrf_atomic_u32_t *)&m_log_data.wr_idx,
+                                      &wr_idx,
+                                      wr_idx + len32 + *p_offset));
+
+    *p_wr_idx = wr_idx;
+    p_buf = &m_log_data.buffer[(wr_idx + PUSHED_HEADER_SIZE + *p_offset) & m_log_data.mask];
+#else
     CRITICAL_REGION_ENTER();
     *p_wr_idx = m_log_data.wr_idx;
     uint32_t available_words = (m_log_data.mask + 1) -
@@ -550,6 +665,7 @@ static inline uint32_t * cont_buf_prealloc(uint32_t len32,
     }
 
     CRITICAL_REGION_EXIT();
+#endif // NRF_LOG_LOCK_FREE
 
     return p_buf;
 }
@@ -571,8 +687,12 @@ uint32_t nrf_log_push(char * const p_str)
     if (p_dst_str)
     {
         nrf_log_header_t * p_header = (nrf_log_header_t *)&m_log_data.buffer[wr_idx & mask];
-        PUSHED_HEADER_FILL(p_header, offset, buflen);
+        nrf_log_header_t   header;
         memcpy(p_dst_str, p_str, slen);
+        // Header is written with a single store, as it validates the string for the reader.
+        PUSHED_HEADER_FILL(&header, offset, buflen);
+        __DMB();
+        p_header->base.raw = header.base.raw;
     }
     return (uint32_t)p_dst_str;
 }
@@ -708,6 +828,7 @@ void nrf_log_frontend_hexdump(uint32_t           severity_mid,
         uint32_t module_id = severity_mid >> NRF_LOG_MODULE_ID_POS;
         uint32_t dropped   = dropped_sat16_get();
         m_log_data.buffer[(header_wr_idx + 1) & mask] = module_id | (dropped << 16);
+        __DMB();
         //Header prepare
         nrf_log_header_t * p_header = (nrf_log_header_t *)&m_log_data.buffer[header_wr_idx & mask];
         p_header->base.hexdump.severity    = severity_mid & NRF_LOG_LEVEL_MASK;
@@ -732,6 +853,25 @@ bool buffer_is_empty(void)
     return (m_log_data.rd_idx == m_log_data.wr_idx);
 }
 
+/**
+ * @brief Moves read index forward and releases the space to the writers.
+ *
+ * @param rd_idx New read index.
+ */
+static void rd_idx_update(uint32_t rd_idx)
+{
+#if NRF_LOG_LOCK_FREE
+    // Released space must be seen as not written before writers can allocate it.
+    uint32_t idx;
+    for (idx = m_log_data.rd_idx; idx != rd_idx; idx++)
+    {
+        m_log_data.buffer[idx & m_log_data.mask] = LOCK_FREE_EMPTY_WORD;
+    }
+    __DMB();
+#endif
+    m_log_data.rd_idx = rd_idx;
+}
+
 bool nrf_log_frontend_dequeue(void)
 {
 
@@ -752,12 +892,33 @@ bool nrf_log_frontend_dequeue(void)
 
     // Skip any string that is pushed to the circular buffer.
     do {
+#if NRF_LOG_LOCK_FREE
+        if (p_header->base.generic.in_progress == 1)
+        {
+            // Entry is still being written by an interrupted context. Strings pushed before it
+            // are skipped again on next attempt.
+            return false;
+        }
+        // Entry must be read after its header.
+        __DMB();
+#endif
         if (invalid_packets_pushed_str_omit(p_header, &rd_idx))
         {
             //Check if end of data is not reached.
             if (rd_idx >= m_log_data.wr_idx)
             {
+#if NRF_LOG_LOCK_FREE
+                // Pushed strings are kept until the entry which uses them is processed, because
+                // released space is cleared. Strings not followed by any entry are released only
+                // when they do not leave room for the largest entry, so logging does not stall.
+                uint32_t available_words = (mask + 1) - (rd_idx - m_log_data.rd_idx);
+                if (available_words < (HEADER_SIZE + NRF_LOG_MAX_NUM_OF_ARGS))
+                {
+                    rd_idx_update(rd_idx);
+                }
+#else
                 m_log_data.rd_idx     = m_log_data.wr_idx;
+#endif
                 return false;
             }
             //something was omitted. Point to new header and try again.
@@ -846,7 +1007,7 @@ bool nrf_log_frontend_dequeue(void)
     if (p_msg_buf)
     {
         nrf_log_backend_t * p_backend = m_log_data.p_backend_head;
-        if (NRF_LOG_ALLOW_OVERFLOW && m_log_data.log_skipped)
+        if (NRF_LOG_SKIP_OLDEST && m_log_data.log_skipped)
         {
             // Check if any log was skipped during log processing. Do not forward log if skipping
             // occured because data may be invalid.
@@ -889,7 +1050,7 @@ bool nrf_log_frontend_dequeue(void)
 
             nrf_memobj_put(p_msg_buf);
 
-            if (NRF_LOG_ALLOW_OVERFLOW)
+            if (NRF_LOG_SKIP_OLDEST)
             {
                 // Read index can be moved forward only if dequeueing process was not interrupt by
                 // skipping procedure. If NRF_LOG_ALLOW_OVERFLOW is set then in case of buffer gets full
@@ -904,7 +1065,7 @@ bool nrf_log_frontend_dequeue(void)
             }
             else
             {
-                m_log_data.rd_idx = rd_idx;
+                rd_idx_update(rd_idx);
             }
         }
     }
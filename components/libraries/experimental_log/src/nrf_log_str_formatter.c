@@ -110,9 +110,9 @@ static void prefix_process(nrf_log_str_formatter_entry_params_t * p_params,
     {
         nrf_fprintf(p_ctx,
                     "%sLogs dropped (%d)%s\r\n",
-                    NRF_LOG_COLOR_CODE_RED,
+                    p_params->use_colors ? NRF_LOG_COLOR_CODE_RED : "",
                     p_params->dropped,
-                    NRF_LOG_COLOR_CODE_DEFAULT);
+                    p_params->use_colors ? NRF_LOG_COLOR_CODE_DEFAULT : "");
     }
 
     if (!(p_params->severity == NRF_LOG_SEVERITY_INFO_RAW))
@@ -0,0 +1,426 @@
+#!/usr/bin/env python3
+"""
+Copyright (c) 2018, Nordic Semiconductor ASA
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form, except as embedded into a Nordic
+   Semiconductor ASA integrated circuit in a product or a software update for
+   such product, must reproduce the above copyright notice, this list of
+   conditions and the following disclaimer in the documentation and/or other
+   materials provided with the distribution.
+
+3. Neither the name of Nordic Semiconductor ASA nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+4. This software, with or without modification, must only be used with a
+   Nordic Semiconductor ASA integrated circuit.
+
+5. Any software provided in binary form under this license must not be reverse
+   engineered, decompiled, modified and/or disassembled.
+
+THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+"""
+Decoder for the binary output of nrf_log serial backends.
+
+When NRF_LOG_BACKEND_SERIAL_BINARY is enabled, the UART and RTT backends send
+SLIP encoded frames that contain the format string address and raw arguments
+instead of formatted text. This script resolves format strings and module
+names from the application ELF file and prints the log as text.
+
+Usage:
+    nrf_log_bin_decode.py app.elf log.bin
+    JLinkRTTLogger ... /dev/stdout | nrf_log_bin_decode.py --freq 32768 app.elf
+"""
+
+import argparse
+import struct
+import sys
+
+FRAME_END = 0xC0
+FRAME_ESC = 0xDB
+FRAME_ESC_END = 0xDC
+FRAME_ESC_ESC = 0xDD
+
+TYPE_STD = 0
+TYPE_HEXDUMP = 1
+
+ARG_UINT = 0
+ARG_INT = 1
+ARG_STR = 2
+
+SEVERITY_INFO_RAW = 5
+SEVERITY_NAMES = [None, 'error', 'warning', 'info', 'debug']
+
+HEXDUMP_BYTES_IN_LINE = 8
+
+MODULE_SYMBOL_PREFIX = 'm_nrf_log_'
+MODULE_SYMBOL_SUFFIX = '_logs_data_const'
+
+
+class Elf(object):
+    """Minimal reader for 32-bit little-endian ELF files."""
+
+    SHT_SYMTAB = 2
+    SHT_NOBITS = 8
+    SHF_ALLOC = 0x2
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError('%s is not a 32-bit little-endian ELF file' % path)
+
+        shoff, = struct.unpack_from('<I', self.data, 0x20)
+        shentsize, shnum = struct.unpack_from('<HH', self.data, 0x2E)
+
+        self.sections = []
+        for i in range(shnum):
+            self.sections.append(struct.unpack_from('<IIIIIIIIII', self.data,
+                                                    shoff + i * shentsize))
+
+        self.regions = []
+        for (_, sh_type, flags, addr, offset, size, _, _, _, _) in self.sections:
+            if (flags & self.SHF_ALLOC) and sh_type != self.SHT_NOBITS and size:
+                self.regions.append((addr, self.data[offset:offset + size]))
+
+    def read(self, addr, length):
+        for (start, data) in self.regions:
+            if start <= addr and addr + length <= start + len(data):
+                return data[addr - start:addr - start + length]
+        return None
+
+    def string(self, addr):
+        for (start, data) in self.regions:
+            if start <= addr < start + len(data):
+                end = data.find(b'\0', addr - start)
+                if end < 0:
+                    end = len(data)
+                return data[addr - start:end].decode('latin-1')
+        return None
+
+    def symbols(self):
+        for (_, sh_type, _, _, offset, size, link, _, _, entsize) in self.sections:
+            if sh_type != self.SHT_SYMTAB:
+                continue
+            strtab = self.sections[link]
+            str_offset = strtab[4]
+            for i in range(size // entsize):
+                name, value = struct.unpack_from('<II', self.data, offset + i * entsize)
+                end = self.data.find(b'\0', str_offset + name)
+                yield (self.data[str_offset + name:end].decode('latin-1'), value)
+
+
+def modules_get(elf):
+    """Return module names ordered by module ID.
+
+    Module ID is the index of the module in the constant data section, so
+    sorting the constant data symbols by address gives the ID order.
+    """
+    modules = sorted((value, name) for (name, value) in elf.symbols()
+                     if name.startswith(MODULE_SYMBOL_PREFIX) and
+                     name.endswith(MODULE_SYMBOL_SUFFIX))
+    names = []
+    for (addr, symbol) in modules:
+        name = None
+        raw = elf.read(addr, 4)
+        if raw is not None:
+            name = elf.string(struct.unpack('<I', raw)[0])
+        if name is None:
+            name = symbol[len(MODULE_SYMBOL_PREFIX):-len(MODULE_SYMBOL_SUFFIX)]
+        names.append(name)
+    return names
+
+
+def specifiers_get(fmt):
+    """Split format string the same way nrf_fprintf does.
+
+    Returns list of literal strings and (flags, width, precision, conversion)
+    tuples where width is None if it is taken from the argument list.
+    """
+    parts = []
+    i = 0
+    literal = ''
+    while i < len(fmt):
+        c = fmt[i]
+        i += 1
+        if c != '%':
+            literal += c
+            continue
+        if literal:
+            parts.append(literal)
+            literal = ''
+        flags = ''
+        while i < len(fmt) and fmt[i] in '-0+':
+            flags += fmt[i]
+            i += 1
+        width = ''
+        if i < len(fmt) and fmt[i] == '*':
+            width = None
+            i += 1
+        else:
+            while i < len(fmt) and fmt[i].isdigit():
+                width += fmt[i]
+                i += 1
+        precision = ''
+        if i < len(fmt) and fmt[i] == '.':
+            i += 1
+            while i < len(fmt) and fmt[i].isdigit():
+                precision += fmt[i]
+                i += 1
+        while i < len(fmt) and fmt[i] in 'lh':
+            i += 1
+        conversion = fmt[i] if i < len(fmt) else ''
+        i += 1
+        parts.append((flags, width, precision, conversion))
+    if literal:
+        parts.append(literal)
+    return parts
+
+
+def arg_kinds_get(parts, nargs):
+    """Mirror of bin_arg_kinds_get() in nrf_log_backend_serial.c."""
+    kinds = []
+    for part in parts:
+        if isinstance(part, str):
+            continue
+        (_, width, _, conversion) = part
+        if width is None:
+            kinds.append(ARG_UINT)
+        if conversion and conversion in 'cuxXp':
+            kinds.append(ARG_UINT)
+        elif conversion and conversion in 'di':
+            kinds.append(ARG_INT)
+        elif conversion == 's':
+            kinds.append(ARG_STR)
+    kinds = kinds[:nargs]
+    return kinds + [ARG_UINT] * (nargs - len(kinds))
+
+
+def format_render(parts, args):
+    out = ''
+    args = list(args)
+    for part in parts:
+        if isinstance(part, str):
+            out += part
+            continue
+        (flags, width, precision, conversion) = part
+        if width is None:
+            width = str(args.pop(0) if args else 0)
+        spec = '%' + flags + width + ('.' + precision if precision else '')
+        if conversion == '%':
+            out += '%'
+        elif conversion in ('d', 'i'):
+            value = args.pop(0) if args else 0
+            out += (spec + 'd') % value
+        elif conversion == 'u':
+            value = args.pop(0) if args else 0
+            out += (spec + 'u') % (value & 0xFFFFFFFF)
+        elif conversion in ('x', 'X'):
+            # nrf_fprintf always prints upper case hexadecimal digits.
+            value = args.pop(0) if args else 0
+            out += (spec + 'X') % (value & 0xFFFFFFFF)
+        elif conversion == 'c':
+            value = args.pop(0) if args else 0
+            out += chr(value & 0xFF)
+        elif conversion == 'p':
+            value = args.pop(0) if args else 0
+            out += '0x%08X' % (value & 0xFFFFFFFF)
+        elif conversion == 's':
+            value = args.pop(0) if args else ''
+            out += ('%' + flags + width + 's') % value
+    return out
+
+
+class Reader(object):
+    def __init__(self, frame):
+        self.frame = frame
+        self.idx = 0
+
+    def byte(self):
+        if self.idx >= len(self.frame):
+            raise ValueError('truncated frame')
+        value = self.frame[self.idx]
+        self.idx += 1
+        return value
+
+    def varint(self):
+        value = 0
+        shift = 0
+        while True:
+            b = self.byte()
+            value |= (b & 0x7F) << shift
+            shift += 7
+            if not (b & 0x80):
+                return value
+            if shift > 28:
+                raise ValueError('invalid varint')
+
+    def string(self):
+        end = self.frame.find(b'\0', self.idx)
+        if end < 0:
+            raise ValueError('truncated string')
+        value = self.frame[self.idx:end].decode('latin-1')
+        self.idx = end + 1
+        return value
+
+    def data(self, length):
+        if self.idx + length > len(self.frame):
+            raise ValueError('truncated data')
+        value = self.frame[self.idx:self.idx + length]
+        self.idx += length
+        return value
+
+
+class Decoder(object):
+    def __init__(self, elf, freq, raw_timestamp):
+        self.elf = elf
+        self.modules = modules_get(elf)
+        # Same reduction as nrf_log_str_formatter_timestamp_freq_set(), so that time printed
+        # here matches the text backend for frequencies above 1 MHz.
+        self.div = 1
+        while freq > 1000000:
+            freq //= 2
+            self.div *= 2
+        self.freq = freq
+        self.raw_timestamp = raw_timestamp
+        self.formats = {}
+
+    def timestamp_str(self, timestamp):
+        if self.freq:
+            seconds, remainder = divmod(timestamp // self.div, self.freq)
+            hours, seconds = divmod(seconds, 3600)
+            mins, seconds = divmod(seconds, 60)
+            us = (remainder * 1000000) // self.freq
+            return '[%02d:%02d:%02d.%03d,%03d] ' % (hours, mins, seconds, us // 1000, us % 1000)
+        if self.raw_timestamp:
+            return '[%08u] ' % timestamp
+        return ''
+
+    def prefix_str(self, severity, module_id, timestamp):
+        if severity == SEVERITY_INFO_RAW:
+            return ''
+        if module_id < len(self.modules):
+            module = self.modules[module_id]
+        else:
+            module = '<module %d>' % module_id
+        if 0 < severity < len(SEVERITY_NAMES):
+            severity_name = SEVERITY_NAMES[severity]
+        else:
+            severity_name = '?'
+        return '%s<%s> %s: ' % (self.timestamp_str(timestamp), severity_name, module)
+
+    def format_get(self, addr):
+        if addr not in self.formats:
+            fmt = self.elf.string(addr)
+            if fmt is None:
+                fmt = '<unknown string 0x%08x>' % addr
+            self.formats[addr] = specifiers_get(fmt)
+        return self.formats[addr]
+
+    def frame_decode(self, frame):
+        reader = Reader(frame)
+        first = reader.byte()
+        entry_type = first & 0x1
+        severity = (first >> 1) & 0x7
+        nargs = (first >> 4) & 0x7
+        module_id = reader.varint()
+        timestamp = reader.varint()
+        out = ''
+        if first & 0x80:
+            out += 'Logs dropped (%d)\n' % reader.varint()
+
+        prefix = self.prefix_str(severity, module_id, timestamp)
+        if entry_type == TYPE_STD:
+            parts = self.format_get(reader.varint())
+            args = []
+            for kind in arg_kinds_get(parts, nargs):
+                if kind == ARG_STR:
+                    args.append(reader.string())
+                elif kind == ARG_INT:
+                    value = reader.varint()
+                    args.append((value >> 1) ^ -(value & 1))
+                else:
+                    args.append(reader.varint())
+            out += prefix + format_render(parts, args)
+            if severity != SEVERITY_INFO_RAW:
+                out += '\n'
+        else:
+            data = reader.data(reader.varint())
+            for i in range(0, max(len(data), 1), HEXDUMP_BYTES_IN_LINE):
+                line = data[i:i + HEXDUMP_BYTES_IN_LINE]
+                hex_part = ''.join(' %02X' % b for b in line)
+                hex_part += '   ' * (HEXDUMP_BYTES_IN_LINE - len(line))
+                chr_part = ''.join(chr(b) if 0x20 <= b < 0x7F else '.' for b in line)
+                chr_part += ' ' * (HEXDUMP_BYTES_IN_LINE - len(line))
+                out += prefix + hex_part + '|' + chr_part + '\n'
+
+        if reader.idx != len(frame):
+            raise ValueError('unexpected trailing data')
+        return out
+
+
+def frames_get(stream):
+    """Yield SLIP decoded frames read from a binary stream."""
+    frame = bytearray()
+    escaped = False
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, 'read1') else stream.read(4096)
+        if not chunk:
+            break
+        for b in bytearray(chunk):
+            if b == FRAME_END:
+                if frame:
+                    yield bytes(frame)
+                frame = bytearray()
+                escaped = False
+            elif escaped:
+                frame.append(FRAME_END if b == FRAME_ESC_END else FRAME_ESC)
+                escaped = False
+            elif b == FRAME_ESC:
+                escaped = True
+            else:
+                frame.append(b)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode binary nrf_log output.')
+    parser.add_argument('elf', help='application ELF file')
+    parser.add_argument('input', nargs='?', help='binary log file (default: stdin)')
+    parser.add_argument('--freq', type=int, default=0,
+                        help='timestamp frequency in Hz, used to print time')
+    parser.add_argument('--raw-timestamp', action='store_true',
+                        help='print timestamps as raw ticks')
+    args = parser.parse_args()
+
+    decoder = Decoder(Elf(args.elf), args.freq, args.raw_timestamp)
+    stream = open(args.input, 'rb') if args.input else sys.stdin.buffer
+
+    for frame in frames_get(stream):
+        try:
+            sys.stdout.write(decoder.frame_decode(frame))
+        except ValueError as e:
+            sys.stderr.write('Corrupted frame (%s): %s\n' % (e, frame.hex()))
+        sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
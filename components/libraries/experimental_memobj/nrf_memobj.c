@@ -73,6 +73,7 @@ typedef struct
 } memobj_head_t;
 
 STATIC_ASSERT(sizeof(memobj_header_t) == NRF_MEMOBJ_STD_HEADER_SIZE);
+STATIC_ASSERT(sizeof(memobj_head_header_t) == NRF_MEMOBJ_HEAD_HEADER_SIZE);
 
 struct memobj_elem_s
 {
@@ -82,16 +83,65 @@ struct memobj_elem_s
 
 ret_code_t nrf_memobj_pool_init(nrf_memobj_pool_t const * p_pool)
 {
-    return nrf_balloc_init((nrf_balloc_t const *)p_pool);
+    ret_code_t err_code = nrf_balloc_init(p_pool->p_chunk_pool);
+    uint32_t   i;
+
+    for (i = 0; (i < p_pool->class_cnt) && (err_code == NRF_SUCCESS); i++)
+    {
+        err_code = nrf_balloc_init(p_pool->pp_classes[i]);
+    }
+    return err_code;
+}
+
+/**
+ * @brief Function for allocating memobj as a single element of the size class.
+ *
+ * @param[in] p_pool     Pointer to the pool of the size class.
+ * @param[in] size       Data size of requested object.
+ *
+ * @return  Pointer to memory object or NULL if size class does not fit or is empty.
+ */
+static nrf_memobj_t * memobj_class_alloc(nrf_balloc_t const * p_pool, size_t size)
+{
+    uint32_t bsize = (uint32_t)NRF_BALLOC_ELEMENT_SIZE(p_pool) - sizeof(memobj_header_t);
+
+    if (size + sizeof(memobj_head_header_t) > bsize)
+    {
+        return NULL;
+    }
+
+    memobj_head_t * p_head = nrf_balloc_alloc(p_pool);
+    if (p_head == NULL)
+    {
+        return NULL;
+    }
+    p_head->head_header.data.fields.user_cnt = 0;
+    p_head->head_header.data.fields.chunk_cnt = 1;
+    p_head->head_header.data.fields.chunk_size = bsize;
+    p_head->header.p_next = (memobj_elem_t *)p_pool;
+
+    return (nrf_memobj_t *)p_head;
 }
 
 nrf_memobj_t * nrf_memobj_alloc(nrf_memobj_pool_t const * p_pool,
                                 size_t size)
 {
-    uint32_t bsize = (uint32_t)NRF_BALLOC_ELEMENT_SIZE((nrf_balloc_t const *)p_pool) - sizeof(memobj_header_t);
+    uint32_t i;
+
+    for (i = 0; i < p_pool->class_cnt; i++)
+    {
+        nrf_memobj_t * p_obj = memobj_class_alloc(p_pool->pp_classes[i], size);
+        if (p_obj)
+        {
+            return p_obj;
+        }
+    }
+
+    nrf_balloc_t const * p_chunk_pool = p_pool->p_chunk_pool;
+    uint32_t bsize = (uint32_t)NRF_BALLOC_ELEMENT_SIZE(p_chunk_pool) - sizeof(memobj_header_t);
     uint8_t num_of_chunks = (uint8_t)CEIL_DIV(size + sizeof(memobj_head_header_t), bsize);
 
-    memobj_head_t * p_head = nrf_balloc_alloc((nrf_balloc_t const *)p_pool);
+    memobj_head_t * p_head = nrf_balloc_alloc(p_chunk_pool);
     if (p_head == NULL)
     {
         return NULL;
@@ -102,18 +152,17 @@ nrf_memobj_t * nrf_memobj_alloc(nrf_memobj_pool_t const * p_pool,
 
     memobj_header_t * p_prev = (memobj_header_t *)p_head;
     memobj_header_t * p_curr;
-    uint32_t i;
     uint32_t chunk_less1 = (uint32_t)num_of_chunks - 1;
 
-    p_prev->p_next =  (memobj_elem_t *)p_pool;
+    p_prev->p_next =  (memobj_elem_t *)p_chunk_pool;
     for (i = 0; i < chunk_less1; i++)
     {
-        p_curr = (memobj_header_t *)nrf_balloc_alloc((nrf_balloc_t const *)p_pool);
+        p_curr = (memobj_header_t *)nrf_balloc_alloc(p_chunk_pool);
         if (p_curr)
         {
             (p_head->head_header.data.fields.chunk_cnt)++;
             p_prev->p_next = (memobj_elem_t *)p_curr;
-            p_curr->p_next = (memobj_elem_t *)p_pool;
+            p_curr->p_next = (memobj_elem_t *)p_chunk_pool;
             p_prev = p_curr;
         }
         else
@@ -175,6 +224,23 @@ static void memobj_op(nrf_memobj_t * p_obj,
 {
 
     memobj_head_t * p_head  = (memobj_head_t *)p_obj;
+
+    if (p_head->head_header.data.fields.chunk_cnt == 1)
+    {
+        // Contiguous object, no need to walk the chain.
+        ASSERT(offset + len + sizeof(memobj_head_header_t) <=
+               p_head->head_header.data.fields.chunk_size);
+        if (read)
+        {
+            memcpy(p_data, &p_head->data[offset], len);
+        }
+        else
+        {
+            memcpy(&p_head->data[offset], p_data, len);
+        }
+        return;
+    }
+
     uint32_t space_in_chunk = p_head->head_header.data.fields.chunk_size;
     memobj_elem_t * p_curr_chunk = (memobj_elem_t *)p_obj;
     uint32_t chunk_idx = (offset + sizeof(memobj_head_header_fields_t))/space_in_chunk;
@@ -229,3 +295,25 @@ void nrf_memobj_read(nrf_memobj_t * p_obj,
 {
     memobj_op(p_obj, p_data, len, offset, true);
 }
+
+void * nrf_memobj_span_get(nrf_memobj_t const * p_obj,
+                           uint32_t offset,
+                           uint32_t * p_len)
+{
+    memobj_head_t const * p_head = (memobj_head_t const *)p_obj;
+    uint32_t space_in_chunk = p_head->head_header.data.fields.chunk_size;
+    memobj_elem_t * p_curr_chunk = (memobj_elem_t *)p_obj;
+    uint32_t chunk_idx = (offset + sizeof(memobj_head_header_fields_t))/space_in_chunk;
+    uint32_t chunk_offset = (offset + sizeof(memobj_head_header_fields_t)) % space_in_chunk;
+
+    ASSERT(chunk_idx < p_head->head_header.data.fields.chunk_cnt);
+
+    while (chunk_idx > 0)
+    {
+        p_curr_chunk = p_curr_chunk->header.p_next;
+        chunk_idx--;
+    }
+
+    *p_len = space_in_chunk - chunk_offset;
+    return &p_curr_chunk->data[chunk_offset];
+}
@@ -74,9 +74,27 @@ extern "C" {
  *   |---------------------|     |---------------------|        |---------------------|
  *             head                     mid_element                  last_element
  *
- *
+ * Pool can also contain size classes (see @ref NRF_MEMOBJ_POOL_ARENA_DEF). Object which fits in
+ * a size class is allocated as a single contiguous element (head only) and can be accessed
+ * directly using @ref nrf_memobj_span_get. Chunks are used only for objects which do not fit in
+ * any size class or when all fitting size classes are exhausted.
+ */
+#define NRF_MEMOBJ_STD_HEADER_SIZE sizeof(void *)
+
+/**
+ * @brief Size of the header placed in the head element in addition to the standard header.
+ */
+#define NRF_MEMOBJ_HEAD_HEADER_SIZE sizeof(uint32_t)
+
+/**
+ * @brief Pool of memobj.
  */
-#define NRF_MEMOBJ_STD_HEADER_SIZE sizeof(uint32_t)
+typedef struct
+{
+    nrf_balloc_t const *         p_chunk_pool;  //!< Pool of chunks linked into an object.
+    nrf_balloc_t const * const * pp_classes;    //!< Size classes sorted by increasing size.
+    uint8_t                      class_cnt;     //!< Number of size classes.
+} nrf_memobj_pool_t;
 
 /**
  * @brief Macro for creating a nrf_memobj pool.
@@ -84,13 +102,54 @@ extern "C" {
  * Macro declares nrf_balloc object. Element in the pool contains user defined data part and
  * memobj header.
  */
-#define NRF_MEMOBJ_POOL_DEF(_name, _element_size, _pool_size) \
-    NRF_BALLOC_DEF(_name, ((_element_size)+NRF_MEMOBJ_STD_HEADER_SIZE), (_pool_size))
+#define NRF_MEMOBJ_POOL_DEF(_name, _element_size, _pool_size)                               \
+    NRF_BALLOC_DEF(CONCAT_2(_name, _chunks),                                                \
+                   ((_element_size)+NRF_MEMOBJ_STD_HEADER_SIZE), (_pool_size));             \
+    static const nrf_memobj_pool_t _name =                                                  \
+    {                                                                                       \
+        .p_chunk_pool = &CONCAT_2(_name, _chunks),                                          \
+        .pp_classes   = NULL,                                                               \
+        .class_cnt    = 0                                                                   \
+    }
 
 /**
- * @brief Pool of memobj.
+ * @brief Macro for creating a size class of contiguous memory objects.
+ *
+ * Macro declares nrf_balloc object. Every element in the pool holds a whole memory object of
+ * up to @p _size bytes and memobj headers.
+ *
+ * @param[in] _name   Name of the size class.
+ * @param[in] _size   Maximum size of an object in the size class.
+ * @param[in] _count  Number of objects in the size class.
+ */
+#define NRF_MEMOBJ_CLASS_DEF(_name, _size, _count)                                          \
+    STATIC_ASSERT(((_size) + NRF_MEMOBJ_HEAD_HEADER_SIZE) <= UINT16_MAX);                   \
+    NRF_BALLOC_DEF(_name,                                                                   \
+                   ((_size) + NRF_MEMOBJ_STD_HEADER_SIZE + NRF_MEMOBJ_HEAD_HEADER_SIZE),    \
+                   (_count))
+
+/**
+ * @brief Macro for creating a nrf_memobj pool with size classes.
+ *
+ * Objects are allocated from the smallest size class which fits them and has a free element.
+ * Chunks are used when no such size class exists.
+ *
+ * @param[in] _name          Name of the pool.
+ * @param[in] _element_size  Size of a chunk.
+ * @param[in] _pool_size     Number of chunks.
+ * @param[in] ...            Pointers to size classes created with @ref NRF_MEMOBJ_CLASS_DEF,
+ *                           sorted by increasing size.
  */
-typedef nrf_balloc_t nrf_memobj_pool_t;
+#define NRF_MEMOBJ_POOL_ARENA_DEF(_name, _element_size, _pool_size, ...)                    \
+    NRF_BALLOC_DEF(CONCAT_2(_name, _chunks),                                                \
+                   ((_element_size)+NRF_MEMOBJ_STD_HEADER_SIZE), (_pool_size));             \
+    static nrf_balloc_t const * const CONCAT_2(_name, _classes)[] = { __VA_ARGS__ };        \
+    static const nrf_memobj_pool_t _name =                                                  \
+    {                                                                                       \
+        .p_chunk_pool = &CONCAT_2(_name, _chunks),                                          \
+        .pp_classes   = CONCAT_2(_name, _classes),                                          \
+        .class_cnt    = ARRAY_SIZE(CONCAT_2(_name, _classes))                               \
+    }
 
 /**
  * @brief Memobj handle.
@@ -100,7 +159,7 @@ typedef void * nrf_memobj_t;
 /**
  * @brief Function for initializing the memobj pool instance.
  *
- * This function initializes the pool.
+ * This function initializes the pool and its size classes.
  *
  * @param[in] p_pool     Pointer to the memobj pool instance structure.
  *
@@ -111,10 +170,11 @@ ret_code_t nrf_memobj_pool_init(nrf_memobj_pool_t const * p_pool);
 /**
  * @brief Function for allocating memobj with requested size.
  *
- * Fixed length elements in the pool are linked together to provide amount of memory requested by
- * the user. If memory object is successfully allocated then user can use memory however it is
- * fragmented into multiple object so it has to be access through the API: @ref nrf_memobj_write,
- * @ref nrf_memobj_read.
+ * If the pool has a size class which fits the object, the object is allocated as a single
+ * contiguous element. Otherwise fixed length elements in the pool are linked together to provide
+ * amount of memory requested by the user. If memory object is successfully allocated then user
+ * can use memory however it may be fragmented into multiple object so it has to be access
+ * through the API: @ref nrf_memobj_write, @ref nrf_memobj_read, @ref nrf_memobj_span_get.
  *
  * This function initializes the pool.
  *
@@ -189,6 +249,26 @@ void nrf_memobj_read(nrf_memobj_t * p_obj,
                      uint32_t len,
                      uint32_t offset);
 
+/**
+ * @brief Function for getting direct access to the data of the memory object.
+ *
+ * Function returns pointer to the data at the given offset and the number of bytes which are
+ * stored contiguously from that point. The whole object is returned at once if it was allocated
+ * from a size class. Otherwise the span ends at the end of the chunk and the next span starts at
+ * @p offset + @p *p_len.
+ *
+ * @note The span can be longer than the object, as it is limited only by the element size.
+ *
+ * @param[in]  p_obj  Pointer to memory object.
+ * @param[in]  offset Offset.
+ * @param[out] p_len  Number of bytes which can be accessed using the returned pointer.
+ *
+ * @return Pointer to the data at the given offset.
+ */
+void * nrf_memobj_span_get(nrf_memobj_t const * p_obj,
+                           uint32_t offset,
+                           uint32_t * p_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,84 @@
 #define WR_OFFSET 0
 #define RD_OFFSET 1
 
+#define BUF_SIZE(_p_ringbuf) ((_p_ringbuf)->bufsize_mask + 1)
+
+/**
+ * @brief Function for splitting buffer area starting at the given index into segments.
+ *
+ * Area which wraps around the end of the buffer is split into two segments.
+ */
+static void segments_split(nrf_ringbuf_t const * p_ringbuf,
+                           uint32_t              idx,
+                           size_t                length,
+                           nrf_ringbuf_iovec_t * p_iov)
+{
+    uint32_t offset = idx & p_ringbuf->bufsize_mask;
+    uint32_t trail  = BUF_SIZE(p_ringbuf) - offset;
+
+    p_iov[0].p_data = &p_ringbuf->p_buffer[offset];
+    p_iov[0].length = length > trail ? trail : length;
+    p_iov[1].p_data = p_ringbuf->p_buffer;
+    p_iov[1].length = length - p_iov[0].length;
+}
+
+/**
+ * @brief Function for getting segments of the buffer area starting at the given index.
+ *
+ * In mirrored layout, area is a continuation of the span started at base index and it may extend
+ * into the mirror area. It is then limited to the end of the mirror area and returned as a single
+ * segment.
+ *
+ * @return Length of the area (can be smaller than requested in mirrored layout).
+ */
+static size_t segments_get(nrf_ringbuf_t const * p_ringbuf,
+                           uint32_t              base_idx,
+                           uint32_t              idx,
+                           size_t                length,
+                           nrf_ringbuf_iovec_t * p_iov)
+{
+    if (p_ringbuf->mirror_size == 0)
+    {
+        segments_split(p_ringbuf, idx, length, p_iov);
+        return length;
+    }
+
+    uint32_t offset     = (base_idx & p_ringbuf->bufsize_mask) + (idx - base_idx);
+    uint32_t contiguous = BUF_SIZE(p_ringbuf) + p_ringbuf->mirror_size - offset;
+
+    length = length > contiguous ? contiguous : length;
+    p_iov[0].p_data = &p_ringbuf->p_buffer[offset];
+    p_iov[0].length = length;
+    p_iov[1].p_data = p_ringbuf->p_buffer;
+    p_iov[1].length = 0;
+    return length;
+}
+
+/**
+ * @brief Function for synchronizing the mirror area after writing to the buffer.
+ *
+ * Data written to the mirror area is copied to the beginning of the buffer and data written to the
+ * beginning of the buffer is copied to the mirror area.
+ */
+static void mirror_update(nrf_ringbuf_t const * p_ringbuf, uint8_t const * p_data, size_t length)
+{
+    uint32_t size   = BUF_SIZE(p_ringbuf);
+    uint32_t offset = (uint32_t)(p_data - p_ringbuf->p_buffer);
+    uint32_t end    = offset + length;
+
+    if (end > size)
+    {
+        uint32_t start = offset > size ? offset : size;
+        memcpy(&p_ringbuf->p_buffer[start - size], &p_ringbuf->p_buffer[start], end - start);
+    }
+
+    if (offset < p_ringbuf->mirror_size)
+    {
+        uint32_t mirror_end = end < p_ringbuf->mirror_size ? end : p_ringbuf->mirror_size;
+        memcpy(&p_ringbuf->p_buffer[size + offset], &p_ringbuf->p_buffer[offset], mirror_end - offset);
+    }
+}
+
 void nrf_ringbuf_init(nrf_ringbuf_t const * p_ringbuf)
 {
     p_ringbuf->p_cb->wr_idx = 0;
@@ -54,11 +132,11 @@ void nrf_ringbuf_init(nrf_ringbuf_t const * p_ringbuf)
     p_ringbuf->p_cb->wr_flag   = 0;
 }
 
-ret_code_t nrf_ringbuf_alloc(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_data, size_t * p_length, bool start)
+static ret_code_t alloc_segments(nrf_ringbuf_t const * p_ringbuf,
+                                 nrf_ringbuf_iovec_t * p_iov,
+                                 size_t              * p_length,
+                                 bool                  start)
 {
-    ASSERT(pp_data);
-    ASSERT(p_length);
-
     if (start)
     {
         if (nrf_atomic_flag_set_fetch(&p_ringbuf->p_cb->wr_flag))
@@ -67,7 +145,9 @@ ret_code_t nrf_ringbuf_alloc(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_dat
         }
     }
 
-    if (p_ringbuf->p_cb->tmp_wr_idx - p_ringbuf->p_cb->rd_idx == p_ringbuf->bufsize_mask + 1)
+    uint32_t available = BUF_SIZE(p_ringbuf) -
+                         (p_ringbuf->p_cb->tmp_wr_idx - p_ringbuf->p_cb->rd_idx);
+    if (available == 0)
     {
         *p_length = 0;
         if (start)
@@ -77,16 +157,53 @@ ret_code_t nrf_ringbuf_alloc(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_dat
         return NRF_SUCCESS;
     }
 
-    uint32_t wr_idx = p_ringbuf->p_cb->tmp_wr_idx & p_ringbuf->bufsize_mask;
-    uint32_t rd_idx = p_ringbuf->p_cb->rd_idx & p_ringbuf->bufsize_mask;
-    uint32_t available = (wr_idx >= rd_idx) ? p_ringbuf->bufsize_mask + 1 - wr_idx :
-            p_ringbuf->p_cb->rd_idx -  p_ringbuf->p_cb->tmp_wr_idx;
-    *p_length = *p_length < available ? *p_length : available;
+    *p_length = segments_get(p_ringbuf,
+                             p_ringbuf->p_cb->wr_idx,
+                             p_ringbuf->p_cb->tmp_wr_idx,
+                             *p_length < available ? *p_length : available,
+                             p_iov);
+    return NRF_SUCCESS;
+}
 
-    *pp_data = &p_ringbuf->p_buffer[wr_idx];
-    p_ringbuf->p_cb->tmp_wr_idx += *p_length;
+ret_code_t nrf_ringbuf_alloc(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_data, size_t * p_length, bool start)
+{
+    ASSERT(pp_data);
+    ASSERT(p_length);
 
-    return NRF_SUCCESS;
+    nrf_ringbuf_iovec_t iov[NRF_RINGBUF_IOV_MAX];
+    ret_code_t          err_code = alloc_segments(p_ringbuf, iov, p_length, start);
+
+    if ((err_code == NRF_SUCCESS) && (*p_length > 0))
+    {
+        *pp_data  = iov[0].p_data;
+        *p_length = iov[0].length;
+        p_ringbuf->p_cb->tmp_wr_idx += *p_length;
+    }
+
+    return err_code;
+}
+
+ret_code_t nrf_ringbuf_alloc_iov(nrf_ringbuf_t const * p_ringbuf,
+                                 nrf_ringbuf_iovec_t * p_iov,
+                                 size_t              * p_length,
+                                 bool                  start)
+{
+    ASSERT(p_iov);
+    ASSERT(p_length);
+
+    ret_code_t err_code = alloc_segments(p_ringbuf, p_iov, p_length, start);
+
+    if (err_code == NRF_SUCCESS)
+    {
+        if (*p_length == 0)
+        {
+            p_iov[0].length = 0;
+            p_iov[1].length = 0;
+        }
+        p_ringbuf->p_cb->tmp_wr_idx += *p_length;
+    }
+
+    return err_code;
 }
 
 ret_code_t nrf_ringbuf_put(nrf_ringbuf_t const * p_ringbuf, size_t length)
@@ -98,6 +215,12 @@ ret_code_t nrf_ringbuf_put(nrf_ringbuf_t const * p_ringbuf, size_t length)
         return NRF_ERROR_NO_MEM;
     }
 
+    if (p_ringbuf->mirror_size)
+    {
+        uint32_t offset = p_ringbuf->p_cb->wr_idx & p_ringbuf->bufsize_mask;
+        mirror_update(p_ringbuf, &p_ringbuf->p_buffer[offset], length);
+    }
+
     p_ringbuf->p_cb->wr_idx    += length;
     p_ringbuf->p_cb->tmp_wr_idx = p_ringbuf->p_cb->wr_idx;
     if (nrf_atomic_flag_clear_fetch(&p_ringbuf->p_cb->wr_flag) == 0)
@@ -123,30 +246,32 @@ ret_code_t nrf_ringbuf_cpy_put(nrf_ringbuf_t const * p_ringbuf,
     uint32_t available = p_ringbuf->bufsize_mask + 1 -
                                 (p_ringbuf->p_cb->wr_idx -  p_ringbuf->p_cb->rd_idx);
     *p_length = available > *p_length ? *p_length : available;
-    size_t   length        = *p_length;
-    uint32_t masked_wr_idx = (p_ringbuf->p_cb->wr_idx & p_ringbuf->bufsize_mask);
-    uint32_t trail         = p_ringbuf->bufsize_mask + 1 - masked_wr_idx;
 
-    if (length > trail)
+    nrf_ringbuf_iovec_t iov[NRF_RINGBUF_IOV_MAX];
+    segments_split(p_ringbuf, p_ringbuf->p_cb->wr_idx, *p_length, iov);
+
+    memcpy(iov[0].p_data, p_data, iov[0].length);
+    memcpy(iov[1].p_data, p_data + iov[0].length, iov[1].length);
+
+    if (p_ringbuf->mirror_size)
     {
-        memcpy(&p_ringbuf->p_buffer[masked_wr_idx], p_data, trail);
-        length -= trail;
-        masked_wr_idx = 0;
-        p_data += trail;
+        mirror_update(p_ringbuf, iov[0].p_data, iov[0].length);
+        mirror_update(p_ringbuf, iov[1].p_data, iov[1].length);
     }
-    memcpy(&p_ringbuf->p_buffer[masked_wr_idx], p_data, length);
-    p_ringbuf->p_cb->wr_idx += *p_length;
+
+    p_ringbuf->p_cb->wr_idx    += *p_length;
+    p_ringbuf->p_cb->tmp_wr_idx = p_ringbuf->p_cb->wr_idx;
 
     UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_ringbuf->p_cb->wr_flag));
 
     return NRF_SUCCESS;
 }
 
-ret_code_t nrf_ringbuf_get(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_data, size_t * p_length, bool start)
+static ret_code_t get_segments(nrf_ringbuf_t const * p_ringbuf,
+                               nrf_ringbuf_iovec_t * p_iov,
+                               size_t              * p_length,
+                               bool                  start)
 {
-    ASSERT(pp_data);
-    ASSERT(p_length);
-
     if (start)
     {
         if (nrf_atomic_flag_set_fetch(&p_ringbuf->p_cb->rd_flag))
@@ -166,25 +291,53 @@ ret_code_t nrf_ringbuf_get(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_data,
         return NRF_SUCCESS;
     }
 
-    uint32_t masked_tmp_rd_idx = p_ringbuf->p_cb->tmp_rd_idx & p_ringbuf->bufsize_mask;
-    uint32_t masked_wr_idx     = p_ringbuf->p_cb->wr_idx & p_ringbuf->bufsize_mask;
+    *p_length = segments_get(p_ringbuf,
+                             p_ringbuf->p_cb->rd_idx,
+                             p_ringbuf->p_cb->tmp_rd_idx,
+                             *p_length < available ? *p_length : available,
+                             p_iov);
+    return NRF_SUCCESS;
+}
 
-    if ((masked_wr_idx > masked_tmp_rd_idx) && (available < *p_length))
+ret_code_t nrf_ringbuf_get(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_data, size_t * p_length, bool start)
+{
+    ASSERT(pp_data);
+    ASSERT(p_length);
+
+    nrf_ringbuf_iovec_t iov[NRF_RINGBUF_IOV_MAX];
+    ret_code_t          err_code = get_segments(p_ringbuf, iov, p_length, start);
+
+    if ((err_code == NRF_SUCCESS) && (*p_length > 0))
     {
-        *p_length = available;
+        *pp_data  = iov[0].p_data;
+        *p_length = iov[0].length;
+        p_ringbuf->p_cb->tmp_rd_idx += *p_length;
     }
-    else if (masked_wr_idx <= masked_tmp_rd_idx)
+
+    return err_code;
+}
+
+ret_code_t nrf_ringbuf_get_iov(nrf_ringbuf_t const * p_ringbuf,
+                               nrf_ringbuf_iovec_t * p_iov,
+                               size_t              * p_length,
+                               bool                  start)
+{
+    ASSERT(p_iov);
+    ASSERT(p_length);
+
+    ret_code_t err_code = get_segments(p_ringbuf, p_iov, p_length, start);
+
+    if (err_code == NRF_SUCCESS)
     {
-        uint32_t trail = p_ringbuf->bufsize_mask + 1 - masked_tmp_rd_idx;
-        if (*p_length > trail)
+        if (*p_length == 0)
         {
-            *p_length = trail;
+            p_iov[0].length = 0;
+            p_iov[1].length = 0;
         }
+        p_ringbuf->p_cb->tmp_rd_idx += *p_length;
     }
-    *pp_data = &p_ringbuf->p_buffer[masked_tmp_rd_idx];
-    p_ringbuf->p_cb->tmp_rd_idx += *p_length;
 
-    return NRF_SUCCESS;
+    return err_code;
 }
 
 ret_code_t nrf_ringbuf_cpy_get(nrf_ringbuf_t const * p_ringbuf,
@@ -201,21 +354,14 @@ ret_code_t nrf_ringbuf_cpy_get(nrf_ringbuf_t const * p_ringbuf,
 
     uint32_t available = p_ringbuf->p_cb->wr_idx -  p_ringbuf->p_cb->rd_idx;
     *p_length = available > *p_length ? *p_length : available;
-    size_t   length        = *p_length;
-    uint32_t masked_rd_idx = (p_ringbuf->p_cb->rd_idx & p_ringbuf->bufsize_mask);
-    uint32_t masked_wr_idx = (p_ringbuf->p_cb->wr_idx & p_ringbuf->bufsize_mask);
-    uint32_t trail         = (masked_wr_idx > masked_rd_idx) ? masked_wr_idx - masked_rd_idx :
-                                                      p_ringbuf->bufsize_mask + 1 - masked_rd_idx;
 
-    if (length > trail)
-    {
-        memcpy(&p_ringbuf->p_buffer[masked_rd_idx], p_data, trail);
-        length -= trail;
-        masked_rd_idx = 0;
-        p_data += trail;
-    }
-    memcpy(p_data, &p_ringbuf->p_buffer[masked_rd_idx], length);
-    p_ringbuf->p_cb->rd_idx += *p_length;
+    nrf_ringbuf_iovec_t iov[NRF_RINGBUF_IOV_MAX];
+    segments_split(p_ringbuf, p_ringbuf->p_cb->rd_idx, *p_length, iov);
+
+    memcpy(p_data, iov[0].p_data, iov[0].length);
+    memcpy(p_data + iov[0].length, iov[1].p_data, iov[1].length);
+    p_ringbuf->p_cb->rd_idx    += *p_length;
+    p_ringbuf->p_cb->tmp_rd_idx = p_ringbuf->p_cb->rd_idx;
 
     UNUSED_RETURN_VALUE(nrf_atomic_flag_clear(&p_ringbuf->p_cb->rd_flag));
 
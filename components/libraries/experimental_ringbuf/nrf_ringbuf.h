@@ -48,6 +48,8 @@
 */
 
 #include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
 #include "nrf_atomic.h"
 #include "sdk_errors.h"
 
@@ -75,8 +77,23 @@ typedef struct
     uint8_t           * p_buffer;     //!< Pointer to memory used by the ring buffer.
     uint32_t            bufsize_mask; //!< Buffer size mask (buffer size must be power of 2).
     nrf_ringbuf_cb_t  * p_cb;         //!< Pointer to instance control block.
+    uint32_t            mirror_size;  //!< Size of the mirror area following the buffer (0 if not mirrored).
 } nrf_ringbuf_t;
 
+/**
+ * @brief Ring buffer memory segment.
+ * */
+typedef struct
+{
+    uint8_t * p_data; //!< Pointer to the segment.
+    size_t    length; //!< Length of the segment.
+} nrf_ringbuf_iovec_t;
+
+/**
+ * @brief Maximum number of segments returned by @ref nrf_ringbuf_alloc_iov and @ref nrf_ringbuf_get_iov.
+ * */
+#define NRF_RINGBUF_IOV_MAX 2
+
 /**
  * @brief Macro for defining a ring buffer instance.
  *
@@ -93,6 +110,33 @@ typedef struct
             .p_cb         = &CONCAT_2(_name,_cb),                             \
     }
 
+/**
+ * @brief Macro for defining a ring buffer instance with mirrored layout.
+ *
+ * Buffer is followed by a mirror area which contains a copy of the beginning of the buffer. Data
+ * which wraps around the end of the buffer is accessible as a single contiguous span as long as
+ * it does not exceed the mirror area. Mirror is updated with memcpy on @ref nrf_ringbuf_put and
+ * @ref nrf_ringbuf_cpy_put, so it costs up to _mirror_size bytes of copying per buffer lap.
+ *
+ * In mirrored layout, all allocations made before @ref nrf_ringbuf_put form a single contiguous
+ * span. The same applies to getting data before @ref nrf_ringbuf_free.
+ *
+ * @param _name        Instance name.
+ * @param _size        Size of ring buffer (must be power of 2).
+ * @param _mirror_size Size of the mirror area (must not exceed _size).
+ * */
+#define NRF_RINGBUF_MIRRORED_DEF(_name, _size, _mirror_size)                  \
+    STATIC_ASSERT(IS_POWER_OF_TWO(_size));                                    \
+    STATIC_ASSERT((_mirror_size) <= (_size));                                 \
+    static uint8_t CONCAT_2(_name,_buf)[(_size) + (_mirror_size)];            \
+    static nrf_ringbuf_cb_t CONCAT_2(_name,_cb);                              \
+    static const nrf_ringbuf_t _name = {                                      \
+            .p_buffer = CONCAT_2(_name,_buf),                                 \
+            .bufsize_mask = _size - 1,                                        \
+            .p_cb         = &CONCAT_2(_name,_cb),                             \
+            .mirror_size  = _mirror_size,                                     \
+    }
+
 /**
  * @brief Initializes a ring buffer instance.
  *
@@ -121,6 +165,28 @@ void nrf_ringbuf_init(nrf_ringbuf_t const * p_ringbuf);
  * */
 ret_code_t nrf_ringbuf_alloc(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_data, size_t * p_length, bool start);
 
+/**
+ * @brief Function for allocating memory from a ring buffer as a list of segments.
+ *
+ * Function behaves like @ref nrf_ringbuf_alloc but allocation is not limited to the contiguous
+ * part. If allocated memory wraps around the end of the buffer, it is returned as two segments.
+ * Unused segments have zero length. In mirrored layout (see @ref NRF_RINGBUF_MIRRORED_DEF),
+ * memory is always returned as one segment.
+ *
+ * @param[in]      p_ringbuf Pointer to Ring buffer instance.
+ * @param[out]     p_iov     Array of @ref NRF_RINGBUF_IOV_MAX segments.
+ * @param[in, out] p_length  Pointer to length. Length is set to requested amount and filled
+ *                           by the function with actually allocated amount.
+ * @param[in]      start     Set to true if exclusive access should be controlled.
+ *
+ * @retval NRF_SUCCESS       Successful allocation (can be smaller amount than requested).
+ *         NRF_ERROR_BUSY    Ring buffer allocation process (alloc-put) is ongoing.
+ * */
+ret_code_t nrf_ringbuf_alloc_iov(nrf_ringbuf_t const * p_ringbuf,
+                                 nrf_ringbuf_iovec_t * p_iov,
+                                 size_t              * p_length,
+                                 bool                  start);
+
 /**
  * @brief Function for commiting data to a ring buffer.
  *
@@ -170,6 +236,28 @@ ret_code_t nrf_ringbuf_cpy_put(nrf_ringbuf_t const * p_ringbuf,
  */
 ret_code_t nrf_ringbuf_get(nrf_ringbuf_t const * p_ringbuf, uint8_t * * pp_data, size_t * p_length, bool start);
 
+/**
+ * Function for getting data from the ring buffer as a list of segments.
+ *
+ * Function behaves like @ref nrf_ringbuf_get but data is not limited to the contiguous part. If
+ * data wraps around the end of the buffer, it is returned as two segments. Unused segments have
+ * zero length. In mirrored layout (see @ref NRF_RINGBUF_MIRRORED_DEF), data is always returned as
+ * one segment.
+ *
+ * @param[in]      p_ringbuf Pointer to Ring buffer instance.
+ * @param[out]     p_iov     Array of @ref NRF_RINGBUF_IOV_MAX segments.
+ * @param[in, out] p_length  Pointer to length. Length is set to requested amount and filled
+ *                           by the function with actual amount.
+ * @param[in]      start     Set to true if exclusive access should be controlled.
+ *
+ * @retval NRF_SUCCESS            Successful getting (can be smaller amount than requested).
+ *         NRF_ERROR_BUSY         Ring buffer getting process (get-free) is ongoing.
+ */
+ret_code_t nrf_ringbuf_get_iov(nrf_ringbuf_t const * p_ringbuf,
+                               nrf_ringbuf_iovec_t * p_iov,
+                               size_t              * p_length,
+                               bool                  start);
+
 /**
  * @brief Function for freeing buffer back to a ring buffer.
  *
@@ -54,6 +54,8 @@
 #include "nrf_fstorage_sd.h"
 #elif (FDS_BACKEND == NRF_FSTORAGE_NVMC)
 #include "nrf_fstorage_nvmc.h"
+#elif (FDS_BACKEND == NRF_FSTORAGE_RAM)
+#include "nrf_fstorage_ram.h"
 #else
 #error Invalid FDS backend.
 #endif
@@ -76,6 +78,7 @@ static struct
 {
     bool volatile     initialized;
     nrf_atomic_flag_t initializing;
+    nrf_atomic_flag_t gc_auto_queued;   // Garbage collection was queued by the module itself.
 } m_flags;
 
 // The number of queued operations.
@@ -99,6 +102,11 @@ static fds_swap_page_t      m_swap_page;
 // Garbage collection data.
 static fds_gc_data_t        m_gc;
 
+#if (FDS_RECORD_INDEX_ENABLED)
+// Index of valid records, used to locate records without scanning flash.
+static fds_index_t          m_index;
+#endif
+
 
 static void event_send(fds_evt_t const * const p_evt)
 {
@@ -154,6 +162,13 @@ static void event_prepare(fds_op_t const * const p_op, fds_evt_t * const p_evt)
             p_evt->id = FDS_EVT_GC;
             break;
 
+        case FDS_OP_WRITE_BATCH:
+            p_evt->id                    = FDS_EVT_WRITE_BATCH;
+            p_evt->batch.first_record_id = p_op->batch.first_record_id;
+            p_evt->batch.count           = p_op->batch.count;
+            p_evt->batch.committed       = p_op->batch.committed;
+            break;
+
         default:
             // Should not happen.
             break;
@@ -276,16 +291,23 @@ static ret_code_t page_from_record(uint16_t * const p_page, uint32_t const * con
 // Scan a page to determine how many words have been written to it.
 // This information is used to set the page write offset during initialization.
 // Additionally, this function updates the latest record ID as it proceeds.
-// If an invalid record header is found, the can_gc argument is set to true.
+// If an invalid record header is found, the can_gc argument is set to true and the words
+// which garbage collection would reclaim are counted in the words_freeable argument.
 static void page_scan(uint32_t const *       p_addr,
                       uint16_t       * const words_written,
-                      bool           * const can_gc)
+                      bool           * const can_gc,
+                      uint16_t       * const words_freeable)
 {
     uint32_t const * const p_page_end = p_addr + FDS_PAGE_SIZE;
 
     p_addr         += FDS_PAGE_TAG_SIZE;
     *words_written  = FDS_PAGE_TAG_SIZE;
 
+    if (words_freeable != NULL)
+    {
+        *words_freeable = 0;
+    }
+
     fds_header_t const * p_header = (fds_header_t*)p_addr;
 
     while (header_has_next(p_header, p_page_end))
@@ -307,6 +329,13 @@ static void page_scan(uint32_t const *       p_addr,
                 *can_gc = true;
             }
 
+            if (words_freeable != NULL)
+            {
+                *words_freeable += (hdr == FDS_HEADER_CORRUPT) ?
+                                   (p_page_end - (uint32_t*)p_header) :
+                                   (FDS_HEADER_SIZE + p_header->length_words);
+            }
+
             if (hdr == FDS_HEADER_CORRUPT)
             {
                 // It could happen that a record has a corrupt header which would set a
@@ -455,6 +484,216 @@ static bool record_find_next(uint16_t page, uint32_t const ** p_record)
 }
 
 
+#if (FDS_RECORD_INDEX_ENABLED)
+
+// Compare an index entry with a file ID, record key, page and record address.
+// Returns a negative value if the entry sorts before the given values, zero if they are equal,
+// and a positive value if the entry sorts after them.
+static int32_t index_entry_cmp(fds_index_entry_t const * const p_entry,
+                               uint16_t                        file_id,
+                               uint16_t                        record_key,
+                               uint16_t                        page,
+                               uint32_t                const * p_record)
+{
+    if (p_entry->file_id != file_id)
+    {
+        return (p_entry->file_id < file_id) ? -1 : 1;
+    }
+
+    if (p_entry->record_key != record_key)
+    {
+        return (p_entry->record_key < record_key) ? -1 : 1;
+    }
+
+    if (p_entry->page != page)
+    {
+        return (p_entry->page < page) ? -1 : 1;
+    }
+
+    if (p_entry->p_record != p_record)
+    {
+        return (p_entry->p_record < p_record) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+
+// Find the position of the first entry which does not sort before the given values.
+// NOTE: Must be called from within a critical section.
+static uint16_t index_lower_bound(uint16_t         file_id,
+                                  uint16_t         record_key,
+                                  uint16_t         page,
+                                  uint32_t const * p_record)
+{
+    uint16_t lo = 0;
+    uint16_t hi = m_index.count;
+
+    while (lo < hi)
+    {
+        uint16_t const mid = lo + ((hi - lo) / 2);
+
+        if (index_entry_cmp(&m_index.entry[mid], file_id, record_key, page, p_record) < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+
+// Add a valid record to the index.
+// If the index is full, it is flagged as invalid and searches fall back to scanning flash.
+static void index_add(uint16_t page, uint32_t const * const p_record)
+{
+    fds_header_t const * const p_header = (fds_header_t*)p_record;
+
+    CRITICAL_SECTION_ENTER();
+    if (m_index.valid)
+    {
+        if (m_index.count < FDS_RECORD_INDEX_SIZE)
+        {
+            uint16_t const pos = index_lower_bound(p_header->file_id, p_header->record_key,
+                                                   page, p_record);
+
+            memmove(&m_index.entry[pos + 1], &m_index.entry[pos],
+                    (m_index.count - pos) * sizeof(fds_index_entry_t));
+
+            m_index.entry[pos].p_record   = p_record;
+            m_index.entry[pos].file_id    = p_header->file_id;
+            m_index.entry[pos].record_key = p_header->record_key;
+            m_index.entry[pos].page       = page;
+
+            m_index.count++;
+        }
+        else
+        {
+            m_index.valid = false;
+        }
+    }
+    CRITICAL_SECTION_EXIT();
+}
+
+
+// Remove a record from the index.
+// NOTE: The record header must still be valid.
+static void index_remove(uint16_t page, uint32_t const * const p_record)
+{
+    fds_header_t const * const p_header = (fds_header_t*)p_record;
+
+    CRITICAL_SECTION_ENTER();
+    uint16_t const pos = index_lower_bound(p_header->file_id, p_header->record_key,
+                                           page, p_record);
+
+    if ((pos < m_index.count) && (m_index.entry[pos].p_record == p_record))
+    {
+        m_index.count--;
+        memmove(&m_index.entry[pos], &m_index.entry[pos + 1],
+                (m_index.count - pos) * sizeof(fds_index_entry_t));
+    }
+    CRITICAL_SECTION_EXIT();
+}
+
+
+// Add all valid records stored on a page to the index.
+static void index_page_add(uint16_t page)
+{
+    uint32_t const * p_record = NULL;
+
+    while (record_find_next(page, &p_record))
+    {
+        index_add(page, p_record);
+    }
+}
+
+
+// Replace the index entries of a page whose records have been moved by garbage collection.
+static void index_page_update(uint16_t page)
+{
+    uint16_t kept = 0;
+
+    CRITICAL_SECTION_ENTER();
+    for (uint16_t i = 0; i < m_index.count; i++)
+    {
+        if (m_index.entry[i].page != page)
+        {
+            m_index.entry[kept++] = m_index.entry[i];
+        }
+    }
+    m_index.count = kept;
+    CRITICAL_SECTION_EXIT();
+
+    index_page_add(page);
+}
+
+
+// Build the index from scratch by scanning all data pages.
+static void index_rebuild(void)
+{
+    CRITICAL_SECTION_ENTER();
+    m_index.count = 0;
+    m_index.valid = true;
+    CRITICAL_SECTION_EXIT();
+
+    for (uint16_t page = 0; page < FDS_DATA_PAGES; page++)
+    {
+        if (m_pages[page].page_type == FDS_PAGE_DATA)
+        {
+            index_page_add(page);
+        }
+    }
+}
+
+
+// Search for a record with the given file ID and record key using the index.
+// Records are returned in the same order as when scanning flash, and the token is updated
+// in the same way, so that a search can be resumed regardless of the method used.
+static ret_code_t index_find(uint16_t                  file_id,
+                             uint16_t                  record_key,
+                             fds_record_desc_t * const p_desc,
+                             fds_find_token_t  * const p_token)
+{
+    ret_code_t ret = FDS_ERR_NOT_FOUND;
+    uint16_t   pos;
+
+    CRITICAL_SECTION_ENTER();
+    // Entries are sorted by file ID and record key first, then in flash order:
+    // the next match, if any, is the first entry past the token.
+    pos = index_lower_bound(file_id, record_key, p_token->page, p_token->p_addr);
+
+    if ((pos < m_index.count) && (m_index.entry[pos].p_record == p_token->p_addr))
+    {
+        pos++;
+    }
+
+    if (   (pos < m_index.count)
+        && (m_index.entry[pos].file_id    == file_id)
+        && (m_index.entry[pos].record_key == record_key))
+    {
+        fds_index_entry_t const * const p_entry = &m_index.entry[pos];
+
+        p_token->page        = p_entry->page;
+        p_token->p_addr      = p_entry->p_record;
+
+        p_desc->record_id    = ((fds_header_t*)p_entry->p_record)->record_id;
+        p_desc->p_record     = p_entry->p_record;
+        p_desc->gc_run_count = m_gc.run_count;
+
+        ret = FDS_SUCCESS;
+    }
+    CRITICAL_SECTION_EXIT();
+
+    return ret;
+}
+
+#endif // FDS_RECORD_INDEX_ENABLED
+
+
 // Find a record given its descriptor and retrive the page in which the record is stored.
 // NOTE: Do not pass NULL as an argument for p_page.
 static bool record_find_by_desc(fds_record_desc_t * const p_desc, uint16_t * const p_page)
@@ -511,6 +750,15 @@ static ret_code_t record_find(uint16_t          const * p_file_id,
         return FDS_ERR_NULL_ARG;
     }
 
+#if (FDS_RECORD_INDEX_ENABLED)
+    // Only searches by both file ID and record key use the index. Other searches scan flash
+    // and resume from the token.
+    if ((m_index.valid) && (p_file_id != NULL) && (p_record_key != NULL))
+    {
+        return index_find(*p_file_id, *p_record_key, p_desc, p_token);
+    }
+#endif
+
     // Begin (or resume) searching for a record.
     for (; p_token->page < FDS_DATA_PAGES; p_token->page++)
     {
@@ -697,7 +945,8 @@ static fds_init_opts_t pages_init(void)
 
                 // Scan the page to compute its write offset and determine whether or not the page
                 // can be garbage collected. Additionally, update the latest kwown record ID.
-                page_scan(p_page_addr, &m_pages[page].write_offset, &m_pages[page].can_gc);
+                page_scan(p_page_addr, &m_pages[page].write_offset,
+                          &m_pages[page].can_gc, &m_pages[page].words_freeable);
 
                 ret |= PAGE_DATA;
                 page++;
@@ -717,7 +966,7 @@ static fds_init_opts_t pages_init(void)
                 m_swap_page.p_addr = p_page_addr;
                 // If the swap is promoted, this offset should be kept, otherwise,
                 // it should be set to FDS_PAGE_TAG_SIZE.
-                page_scan(p_page_addr, &m_swap_page.write_offset, NULL);
+                page_scan(p_page_addr, &m_swap_page.write_offset, NULL, NULL);
 
                 ret |= (m_swap_page.write_offset == FDS_PAGE_TAG_SIZE) ?
                         PAGE_SWAP_CLEAN : PAGE_SWAP_DIRTY;
@@ -792,17 +1041,28 @@ static ret_code_t record_header_flag_dirty(uint32_t * const p_record, uint16_t p
     __ALIGN(4) static uint32_t const dirty_header = {0xFFFF0000};
 
     // Flag the record as dirty.
-    ret_code_t ret;
+    ret_code_t     ret;
+    uint16_t const record_words = FDS_HEADER_SIZE + ((fds_header_t const *)p_record)->length_words;
+
+#if (FDS_RECORD_INDEX_ENABLED)
+    // Remove the record from the index while its header can still be read.
+    index_remove(page_to_gc, p_record);
+#endif
 
     ret = nrf_fstorage_write(&m_fs, (uint32_t)p_record,
         &dirty_header, FDS_HEADER_SIZE_TL * sizeof(uint32_t), NULL);
 
     if (ret != NRF_SUCCESS)
     {
+#if (FDS_RECORD_INDEX_ENABLED)
+        // The record is still valid.
+        index_add(page_to_gc, p_record);
+#endif
         return FDS_ERR_BUSY;
     }
 
-    m_pages[page_to_gc].can_gc = true;
+    m_pages[page_to_gc].can_gc          = true;
+    m_pages[page_to_gc].words_freeable += record_words;
 
     return FDS_SUCCESS;
 }
@@ -901,11 +1161,12 @@ static bool crc_verify_success(uint16_t crc, uint16_t len_words, uint32_t const
 #endif
 
 
-static void gc_init(void)
+static void gc_init(uint16_t max_pages)
 {
     m_gc.run_count++;
-    m_gc.cur_page = 0;
-    m_gc.resume   = false;
+    m_gc.cur_page   = 0;
+    m_gc.pages_left = max_pages;
+    m_gc.resume     = false;
 
     // Setup which pages to GC. Defer checking for open records and the can_gc flag,
     // as other operations might change those while GC is running.
@@ -917,28 +1178,49 @@ static void gc_init(void)
 
 
 // Obtain the next page to be garbage collected.
+// Among the pages which can be garbage collected, pick the one with the most words to reclaim.
 // Returns true if there are pages left to garbage collect, returns false otherwise.
 static bool gc_page_next(uint16_t * const p_next_page)
 {
-    bool ret = false;
+    bool     ret           = false;
+    uint16_t most_freeable = 0;
+
+    if (m_gc.pages_left == 0)
+    {
+        // The maximum number of pages for this run has been garbage collected.
+        return false;
+    }
 
     for (uint16_t i = 0; i < FDS_DATA_PAGES; i++)
     {
-        if (m_gc.do_gc_page[i])
+        if (!m_gc.do_gc_page[i])
+        {
+            continue;
+        }
+
+        // Only GC pages with no open records and with some records which have been deleted.
+        if ((m_pages[i].records_open != 0) || (m_pages[i].can_gc == false))
         {
             // Do not attempt to GC this page again.
             m_gc.do_gc_page[i] = false;
+            continue;
+        }
 
-            // Only GC pages with no open records and with some records which have been deleted.
-            if ((m_pages[i].records_open == 0) && (m_pages[i].can_gc == true))
-            {
-                *p_next_page = i;
-                ret = true;
-                break;
-            }
+        if ((!ret) || (m_pages[i].words_freeable > most_freeable))
+        {
+            most_freeable = m_pages[i].words_freeable;
+            *p_next_page  = i;
+            ret           = true;
         }
     }
 
+    if (ret)
+    {
+        // Do not attempt to GC this page again.
+        m_gc.do_gc_page[*p_next_page] = false;
+        m_gc.pages_left--;
+    }
+
     return ret;
 }
 
@@ -1038,6 +1320,14 @@ static ret_code_t gc_next_page(void)
         m_gc.cur_page     = 0;
         m_gc.p_record_src = NULL;
 
+#if (FDS_RECORD_INDEX_ENABLED)
+        if (!m_index.valid)
+        {
+            // Try to rebuild the index now that space has been reclaimed.
+            index_rebuild();
+        }
+#endif
+
         return FDS_OP_COMPLETED;
     }
 
@@ -1067,15 +1357,19 @@ static void gc_swap_pages(void)
     // Keep the offset for this page, but reset it for the swap.
     m_pages[m_gc.cur_page].write_offset = m_swap_page.write_offset;
     m_swap_page.write_offset            = FDS_PAGE_TAG_SIZE;
+
+    // The page only contains valid records now.
+    m_pages[m_gc.cur_page].can_gc         = false;
+    m_pages[m_gc.cur_page].words_freeable = 0;
 }
 
 
-static void gc_state_advance(void)
+static void gc_state_advance(fds_op_t const * const p_op)
 {
     switch (m_gc.state)
     {
         case GC_BEGIN:
-            gc_init();
+            gc_init(p_op->gc.max_pages);
             m_gc.state = GC_NEXT_PAGE;
             break;
 
@@ -1088,6 +1382,10 @@ static void gc_state_advance(void)
         // A page was successfully erased. Prepare to promote the swap.
         case GC_ERASE_PAGE:
             gc_swap_pages();
+#if (FDS_RECORD_INDEX_ENABLED)
+            // The records on this page have been moved.
+            index_page_update(m_gc.cur_page);
+#endif
             m_gc.state = GC_PROMOTE_SWAP;
             break;
 
@@ -1147,6 +1445,9 @@ static ret_code_t init_execute(uint32_t prev_ret, fds_op_t * const p_op)
             }
             if (!write_reqd)
             {
+#if (FDS_RECORD_INDEX_ENABLED)
+                index_rebuild();
+#endif
                 m_flags.initialized  = true;
                 m_flags.initializing = false;
                 return FDS_OP_COMPLETED;
@@ -1180,7 +1481,8 @@ static ret_code_t init_execute(uint32_t prev_ret, fds_op_t * const p_op)
             m_pages[gc].write_offset = m_swap_page.write_offset;
             m_swap_page.write_offset = FDS_PAGE_TAG_SIZE;
 
-            m_pages[gc].page_type = FDS_PAGE_DATA;
+            m_pages[gc].page_type      = FDS_PAGE_DATA;
+            m_pages[gc].words_freeable = 0;
         } break;
 
         default:
@@ -1223,6 +1525,15 @@ static ret_code_t write_execute(uint32_t prev_ret, fds_op_t * const p_op)
     // Compute the address where to write data.
     p_write_addr = (uint32_t*)(p_page->p_addr + p_page->write_offset);
 
+#if (FDS_RECORD_INDEX_ENABLED)
+    // The header has been finalized: the new record is valid and can be indexed.
+    if (   (p_op->write.step == FDS_OP_WRITE_FLAG_DIRTY)
+        || ((p_op->write.step == FDS_OP_WRITE_DONE) && (p_op->op_code == FDS_OP_WRITE)))
+    {
+        index_add(p_op->write.page, p_write_addr);
+    }
+#endif
+
     // Execute the current step of the operation, and set one to be executed next.
     switch (p_op->write.step)
     {
@@ -1293,6 +1604,239 @@ static ret_code_t write_execute(uint32_t prev_ret, fds_op_t * const p_op)
 }
 
 
+// Fill in the header of the record currently being written by a batch operation.
+static void batch_header_prepare(fds_op_t const * const p_op, fds_header_t * const p_header)
+{
+    fds_record_t const * const p_record = &p_op->batch.p_records[p_op->batch.cur];
+    uint16_t                   crc      = 0;
+
+    p_header->record_key   = p_record->key;
+    p_header->length_words = (uint16_t)p_record->data.length_words;
+    p_header->file_id      = p_record->file_id;
+    p_header->record_id    = p_op->batch.first_record_id + p_op->batch.cur;
+
+#if (FDS_CRC_CHECK_ON_READ)
+    crc = crc16_compute((uint8_t*)p_header,            6, NULL);
+    crc = crc16_compute((uint8_t*)&p_header->record_id, 4, &crc);
+    crc = crc16_compute((uint8_t*)p_record->data.p_data,
+                        p_record->data.length_words * sizeof(uint32_t), &crc);
+#endif
+
+    p_header->crc16 = crc;
+}
+
+
+// Move on to the next record in a batch operation.
+// Once all records have been written, start over from the first to commit them.
+static void batch_record_next(fds_op_t * const p_op)
+{
+    p_op->batch.offset += FDS_HEADER_SIZE + p_op->batch.p_records[p_op->batch.cur].data.length_words;
+    p_op->batch.cur++;
+
+    if (p_op->batch.cur == p_op->batch.count)
+    {
+        p_op->batch.cur    = 0;
+        p_op->batch.offset = 0;
+        p_op->batch.step   = (p_op->batch.step == FDS_OP_BATCH_COMMIT) ?
+                              FDS_OP_BATCH_DONE : FDS_OP_BATCH_COMMIT;
+    }
+    else if (p_op->batch.step != FDS_OP_BATCH_COMMIT)
+    {
+        p_op->batch.step = FDS_OP_BATCH_WRITE_HEADER;
+    }
+}
+
+
+// Returns the number of records of a batch operation which have been committed.
+// The step is set before writing, so if the last write failed, it was for the previous record.
+static uint16_t batch_committed_count(fds_op_t const * const p_op, bool failed)
+{
+    uint16_t committed;
+
+    switch (p_op->batch.step)
+    {
+        case FDS_OP_BATCH_COMMIT:
+            committed = p_op->batch.cur;
+            break;
+
+        case FDS_OP_BATCH_DONE:
+            committed = p_op->batch.count;
+            break;
+
+        default:
+            return 0;
+    }
+
+    if (failed && (committed > 0))
+    {
+        committed--;
+    }
+
+    return committed;
+}
+
+
+// Ends a batch operation: records how many records have been committed for the event, indexes
+// them, and updates the page offsets. Records of an abandoned batch which were not committed
+// are left for garbage collection.
+static void batch_end(fds_page_t * const p_page, fds_op_t * const p_op, uint16_t committed)
+{
+    uint16_t words_written;
+    uint16_t words_committed = 0;
+
+    p_op->batch.committed = committed;
+
+    for (uint16_t i = 0; i < committed; i++)
+    {
+#if (FDS_RECORD_INDEX_ENABLED)
+        index_add(p_op->batch.page, p_page->p_addr + p_page->write_offset + words_committed);
+#endif
+        words_committed += FDS_HEADER_SIZE + p_op->batch.p_records[i].data.length_words;
+    }
+
+    // Records whose header has been written occupy space on the page, even if they are incomplete.
+    switch (p_op->batch.step)
+    {
+        case FDS_OP_BATCH_WRITE_HEADER:
+            words_written = p_op->batch.offset;
+            break;
+
+        case FDS_OP_BATCH_WRITE_ID:
+        case FDS_OP_BATCH_WRITE_DATA:
+            words_written = p_op->batch.offset + FDS_HEADER_SIZE
+                          + p_op->batch.p_records[p_op->batch.cur].data.length_words;
+            break;
+
+        default:
+            words_written = p_op->batch.length_words;
+            break;
+    }
+
+    p_page->write_offset   += words_written;
+    p_page->words_reserved -= p_op->batch.length_words;
+
+    if (words_written > words_committed)
+    {
+        p_page->can_gc          = true;
+        p_page->words_freeable += words_written - words_committed;
+    }
+}
+
+
+// Executes batch write operations.
+static ret_code_t batch_execute(uint32_t prev_ret, fds_op_t * const p_op)
+{
+    ret_code_t           ret;
+    fds_page_t   * const p_page   = &m_pages[p_op->batch.page];
+    uint32_t     * const p_base   = (uint32_t*)(p_page->p_addr + p_page->write_offset);
+    uint32_t     * const p_addr   = p_base + p_op->batch.offset;
+    fds_record_t const * p_record = &p_op->batch.p_records[p_op->batch.cur];
+
+    // The header of the record being written. It must persist across calls,
+    // since it is not buffered by fstorage.
+    static fds_header_t header;
+
+    if (prev_ret != NRF_SUCCESS)
+    {
+        // The previous operation has timed out, update offsets.
+        batch_end(p_page, p_op, batch_committed_count(p_op, true));
+        return FDS_ERR_OPERATION_TIMEOUT;
+    }
+
+    switch (p_op->batch.step)
+    {
+        case FDS_OP_BATCH_WRITE_HEADER:
+        {
+            batch_header_prepare(p_op, &header);
+
+            // Write the record ID next. The step is set before writing, since fstorage
+            // may report the result before nrf_fstorage_write() returns.
+            p_op->batch.step = FDS_OP_BATCH_WRITE_ID;
+
+            // Leave the file ID and CRC erased: the record is not valid until committed, and
+            // the word is programmed only once, when the record is committed.
+            ret = nrf_fstorage_write(&m_fs, (uint32_t)(p_addr + FDS_OFFSET_TL),
+                                     &header, FDS_HEADER_SIZE_TL * sizeof(uint32_t), NULL);
+
+            ret = (ret == NRF_SUCCESS) ? FDS_SUCCESS : FDS_ERR_BUSY;
+        } break;
+
+        case FDS_OP_BATCH_WRITE_ID:
+        {
+            // If this record has no data, move on to the next record directly.
+            if (p_record->data.length_words != 0)
+            {
+                p_op->batch.step = FDS_OP_BATCH_WRITE_DATA;
+            }
+            else
+            {
+                batch_record_next(p_op);
+            }
+
+            ret = nrf_fstorage_write(&m_fs, (uint32_t)(p_addr + FDS_OFFSET_ID),
+                                     &header.record_id, FDS_HEADER_SIZE_ID * sizeof(uint32_t), NULL);
+
+            ret = (ret == NRF_SUCCESS) ? FDS_SUCCESS : FDS_ERR_BUSY;
+        } break;
+
+        case FDS_OP_BATCH_WRITE_DATA:
+        {
+            batch_record_next(p_op);
+
+            ret = nrf_fstorage_write(&m_fs, (uint32_t)(p_addr + FDS_OFFSET_DATA),
+                                     p_record->data.p_data,
+                                     p_record->data.length_words * sizeof(uint32_t), NULL);
+
+            ret = (ret == NRF_SUCCESS) ? FDS_SUCCESS : FDS_ERR_BUSY;
+        } break;
+
+        case FDS_OP_BATCH_COMMIT:
+        {
+            batch_header_prepare(p_op, &header);
+            batch_record_next(p_op);
+
+            ret = nrf_fstorage_write(&m_fs, (uint32_t)(p_addr + FDS_OFFSET_IC),
+                                     &header.file_id, FDS_HEADER_SIZE_IC * sizeof(uint32_t), NULL);
+
+            ret = (ret == NRF_SUCCESS) ? FDS_SUCCESS : FDS_ERR_BUSY;
+        } break;
+
+        case FDS_OP_BATCH_DONE:
+        {
+            ret = FDS_OP_COMPLETED;
+
+#if (FDS_CRC_CHECK_ON_WRITE)
+            uint32_t const * p_rec = p_base;
+            for (uint16_t i = 0; i < p_op->batch.count; i++)
+            {
+                fds_header_t const * const p_header = (fds_header_t*)p_rec;
+
+                if (!crc_verify_success(p_header->crc16, p_header->length_words, p_rec))
+                {
+                    ret = FDS_ERR_CRC_CHECK_FAILED;
+                    break;
+                }
+
+                p_rec += FDS_HEADER_SIZE + p_header->length_words;
+            }
+#endif
+        } break;
+
+        default:
+            ret = FDS_ERR_INTERNAL;
+            break;
+    }
+
+    if (ret != FDS_OP_EXECUTING)
+    {
+        // There won't be another callback for this operation, so update the page offset now.
+        batch_end(p_page, p_op, batch_committed_count(p_op, ret == FDS_ERR_BUSY));
+    }
+
+    return ret;
+}
+
+
 static ret_code_t delete_execute(uint32_t prev_ret, fds_op_t * const p_op)
 {
     ret_code_t ret;
@@ -1332,12 +1876,18 @@ static ret_code_t delete_execute(uint32_t prev_ret, fds_op_t * const p_op)
 }
 
 
-static ret_code_t gc_execute(uint32_t prev_ret)
+static ret_code_t gc_execute(uint32_t prev_ret, fds_op_t * const p_op)
 {
     ret_code_t ret;
 
     if (prev_ret != NRF_SUCCESS)
     {
+        // The last step did not complete. The next garbage collection retries it.
+        m_gc.resume = true;
+        if (p_op->gc.is_auto)
+        {
+            (void) nrf_atomic_flag_clear(&m_flags.gc_auto_queued);
+        }
         return FDS_ERR_OPERATION_TIMEOUT;
     }
 
@@ -1347,7 +1897,7 @@ static ret_code_t gc_execute(uint32_t prev_ret)
     }
     else
     {
-        gc_state_advance();
+        gc_state_advance(p_op);
     }
 
     switch (m_gc.state)
@@ -1368,6 +1918,10 @@ static ret_code_t gc_execute(uint32_t prev_ret)
             ret = gc_page_erase();
             break;
 
+        case GC_DISCARD_SWAP:
+            ret = gc_swap_erase();
+            break;
+
         case GC_PROMOTE_SWAP:
             ret = gc_swap_promote();
             break;
@@ -1382,6 +1936,21 @@ static ret_code_t gc_execute(uint32_t prev_ret)
             break;
     }
 
+    if (ret != FDS_OP_EXECUTING)
+    {
+        if (ret != FDS_OP_COMPLETED)
+        {
+            // The step could not be started. The next garbage collection retries it.
+            m_gc.resume = true;
+        }
+
+        if (p_op->gc.is_auto)
+        {
+            // Allow garbage collection to be queued automatically again.
+            (void) nrf_atomic_flag_clear(&m_flags.gc_auto_queued);
+        }
+    }
+
     // Either FDS_OP_EXECUTING, FDS_OP_COMPLETED, FDS_ERR_BUSY or FDS_ERR_INTERNAL.
     return ret;
 }
@@ -1426,7 +1995,11 @@ static void queue_process(ret_code_t result)
                 break;
 
             case FDS_OP_GC:
-                result = gc_execute(result);
+                result = gc_execute(result, m_p_cur_op);
+                break;
+
+            case FDS_OP_WRITE_BATCH:
+                result = batch_execute(result, m_p_cur_op);
                 break;
 
             default:
@@ -1440,6 +2013,15 @@ static void queue_process(ret_code_t result)
             break;
         }
 
+#if (FDS_RECORD_INDEX_ENABLED)
+        if (result == FDS_ERR_OPERATION_TIMEOUT)
+        {
+            // The records affected by the operation are in an unknown state.
+            // Stop using the index until it is rebuilt by garbage collection.
+            m_index.valid = false;
+        }
+#endif
+
         // The operation has completed (either successfully or with an error).
         // - send an event to the user
         // - free the operation buffer
@@ -1455,8 +2037,13 @@ static void queue_process(ret_code_t result)
             .result = (result == FDS_OP_COMPLETED) ? FDS_SUCCESS : result,
         };
 
-        event_prepare(m_p_cur_op, &evt);
-        event_send(&evt);
+        // Garbage collection started by the module itself is not reported, users
+        // only receive FDS_EVT_GC for fds_gc() and fds_gc_incremental().
+        if ((m_p_cur_op->op_code != FDS_OP_GC) || (!m_p_cur_op->gc.is_auto))
+        {
+            event_prepare(m_p_cur_op, &evt);
+            event_send(&evt);
+        }
 
         // Zero the pointer to the current operation so that this function
         // will fetch a new one from the queue next time it is run.
@@ -1493,6 +2080,74 @@ static void fs_event_handler(nrf_fstorage_evt_t * p_evt)
 }
 
 
+// Enqueues garbage collection of at most max_pages pages.
+// No event is sent for garbage collection queued by the module itself (is_auto).
+static ret_code_t gc_enqueue(uint16_t max_pages, bool is_auto)
+{
+    fds_op_t * p_op;
+    nrf_atfifo_item_put_t iput_ctx;
+
+    p_op = queue_buf_get(&iput_ctx);
+    if (p_op == NULL)
+    {
+        return FDS_ERR_NO_SPACE_IN_QUEUES;
+    }
+
+    p_op->op_code      = FDS_OP_GC;
+    p_op->gc.max_pages = max_pages;
+    p_op->gc.is_auto   = is_auto;
+
+    queue_buf_store(&iput_ctx);
+
+    // A garbage collection which stopped partway is resumed by retrying its last step,
+    // see gc_execute(). Garbage collection still in progress continues as it would.
+    queue_start();
+
+    return FDS_SUCCESS;
+}
+
+
+#if (FDS_GC_AUTO_ENABLED)
+// Enqueues garbage collection if the flash space left for new records is running low,
+// or if there was not enough space to reserve for a record.
+static void gc_auto_run(bool no_space)
+{
+    uint32_t free_words = 0;
+    bool     can_gc     = false;
+
+    CRITICAL_SECTION_ENTER();
+    for (uint16_t page = 0; page < FDS_DATA_PAGES; page++)
+    {
+        if (m_pages[page].page_type == FDS_PAGE_DATA)
+        {
+            free_words += FDS_PAGE_SIZE - m_pages[page].write_offset - m_pages[page].words_reserved;
+            // Pages with open records are skipped by garbage collection.
+            can_gc     |= (m_pages[page].can_gc && (m_pages[page].records_open == 0));
+        }
+    }
+    CRITICAL_SECTION_EXIT();
+
+    if ((!can_gc) || ((!no_space) && (free_words >= FDS_GC_AUTO_THRESHOLD)))
+    {
+        // There is nothing to reclaim, or there is enough space left.
+        return;
+    }
+
+    if (nrf_atomic_flag_set_fetch(&m_flags.gc_auto_queued))
+    {
+        // Garbage collection has already been queued.
+        return;
+    }
+
+    if (gc_enqueue(FDS_GC_AUTO_PAGES, true) != FDS_SUCCESS)
+    {
+        // Try again the next time space is reserved.
+        (void) nrf_atomic_flag_clear(&m_flags.gc_auto_queued);
+    }
+}
+#endif
+
+
 // Enqueues write and update operations.
 static ret_code_t write_enqueue(fds_record_desc_t         * const p_desc,
                                 fds_record_t        const * const p_record,
@@ -1536,6 +2191,12 @@ static ret_code_t write_enqueue(fds_record_desc_t         * const p_desc,
 
         if (ret != FDS_SUCCESS)
         {
+#if (FDS_GC_AUTO_ENABLED)
+            if (ret == FDS_ERR_NO_SPACE_IN_FLASH)
+            {
+                gc_auto_run(true);
+            }
+#endif
             // There is either not enough space in flash (FDS_ERR_NO_SPACE_IN_FLASH) or
             // the record exceeds the size of virtual page (FDS_ERR_RECORD_TOO_LARGE).
             return ret;
@@ -1602,6 +2263,10 @@ static ret_code_t write_enqueue(fds_record_desc_t         * const p_desc,
     // Start processing the queue, if necessary.
     queue_start();
 
+#if (FDS_GC_AUTO_ENABLED)
+    gc_auto_run(false);
+#endif
+
     return FDS_SUCCESS;
 }
 
@@ -1628,6 +2293,9 @@ ret_code_t fds_register(fds_cb_t cb)
 
 static uint32_t flash_end_addr(void)
 {
+#if (FDS_BACKEND == NRF_FSTORAGE_RAM)
+    return nrf_fstorage_ram_end_addr();
+#else
     uint32_t const bootloader_addr = NRF_UICR->NRFFW[0];
     uint32_t const page_sz         = NRF_FICR->CODEPAGESIZE;
 #ifndef NRF52810_XXAA
@@ -1638,6 +2306,7 @@ static uint32_t flash_end_addr(void)
 #endif
 
     return (bootloader_addr != 0xFFFFFFFF) ? bootloader_addr : (code_sz * page_sz);
+#endif
 }
 
 
@@ -1657,6 +2326,8 @@ static ret_code_t flash_subsystem_init(void)
         return nrf_fstorage_init(&m_fs, &nrf_fstorage_sd, NULL);
     #elif (FDS_BACKEND == NRF_FSTORAGE_NVMC)
         return nrf_fstorage_init(&m_fs, &nrf_fstorage_nvmc, NULL);
+    #elif (FDS_BACKEND == NRF_FSTORAGE_RAM)
+        return nrf_fstorage_init(&m_fs, &nrf_fstorage_ram, NULL);
     #else
         #error Invalid FDS_BACKEND.
     #endif
@@ -1715,6 +2386,9 @@ ret_code_t fds_init(void)
         case ALREADY_INSTALLED:
         {
             // No initialization is necessary. Notify the application immediately.
+#if (FDS_RECORD_INDEX_ENABLED)
+            index_rebuild();
+#endif
             m_flags.initialized  = true;
             m_flags.initializing = false;
             event_send(&evt_success);
@@ -1871,6 +2545,13 @@ ret_code_t fds_reserve(fds_reserve_token_t * const p_tok, uint16_t length_words)
         p_tok->length_words = length_words;
     }
 
+#if (FDS_GC_AUTO_ENABLED)
+    if (ret != FDS_ERR_RECORD_TOO_LARGE)
+    {
+        gc_auto_run(ret == FDS_ERR_NO_SPACE_IN_FLASH);
+    }
+#endif
+
     return ret;
 }
 
@@ -1941,6 +2622,118 @@ ret_code_t fds_record_write_reserved(fds_record_desc_t         * const p_desc,
 }
 
 
+ret_code_t fds_record_write_batch(fds_record_desc_t       * const p_descs,
+                                  fds_record_t      const * const p_records,
+                                  uint16_t                        count)
+{
+    ret_code_t            ret;
+    uint16_t              page;
+    uint32_t              length_words = 0;
+    uint32_t              first_record_id;
+    fds_op_t            * p_op;
+    nrf_atfifo_item_put_t iput_ctx;
+
+    if (!m_flags.initialized)
+    {
+        return FDS_ERR_NOT_INITIALIZED;
+    }
+
+    if (p_records == NULL)
+    {
+        return FDS_ERR_NULL_ARG;
+    }
+
+    if (count == 0)
+    {
+        return FDS_ERR_INVALID_ARG;
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if ((p_records[i].file_id == FDS_FILE_ID_INVALID) ||
+            (p_records[i].key     == FDS_RECORD_KEY_DIRTY))
+        {
+            return FDS_ERR_INVALID_ARG;
+        }
+
+        if (!is_word_aligned(p_records[i].data.p_data))
+        {
+            return FDS_ERR_UNALIGNED_ADDR;
+        }
+
+        if (p_records[i].data.length_words >= FDS_PAGE_SIZE)
+        {
+            return FDS_ERR_RECORD_TOO_LARGE;
+        }
+
+        length_words += FDS_HEADER_SIZE + p_records[i].data.length_words;
+
+        if (length_words >= FDS_PAGE_SIZE)
+        {
+            return FDS_ERR_RECORD_TOO_LARGE;
+        }
+    }
+
+    // Reserve space for all records at once.
+    // write_space_reserve() accounts for the header of one record by itself.
+    ret = write_space_reserve((uint16_t)(length_words - FDS_HEADER_SIZE), &page);
+
+    if (ret != FDS_SUCCESS)
+    {
+#if (FDS_GC_AUTO_ENABLED)
+        if (ret == FDS_ERR_NO_SPACE_IN_FLASH)
+        {
+            gc_auto_run(true);
+        }
+#endif
+        return ret;
+    }
+
+    p_op = queue_buf_get(&iput_ctx);
+    if (p_op == NULL)
+    {
+        CRITICAL_SECTION_ENTER();
+        write_space_free((uint16_t)(length_words - FDS_HEADER_SIZE), page);
+        CRITICAL_SECTION_EXIT();
+        return FDS_ERR_NO_SPACE_IN_QUEUES;
+    }
+
+    // Allocate consecutive record IDs.
+    first_record_id = nrf_atomic_u32_add(&m_latest_rec_id, count) - count + 1;
+
+    p_op->op_code               = FDS_OP_WRITE_BATCH;
+    p_op->batch.step            = FDS_OP_BATCH_WRITE_HEADER;
+    p_op->batch.p_records       = p_records;
+    p_op->batch.first_record_id = first_record_id;
+    p_op->batch.count           = count;
+    p_op->batch.page            = page;
+    p_op->batch.length_words    = (uint16_t)length_words;
+
+    queue_buf_store(&iput_ctx);
+
+    // Initialize the record descriptors, if provided.
+    if (p_descs != NULL)
+    {
+        for (uint16_t i = 0; i < count; i++)
+        {
+            p_descs[i].p_record       = NULL;
+            p_descs[i].record_id      = first_record_id + i;
+            p_descs[i].record_is_open = false;
+            p_descs[i].gc_run_count   = m_gc.run_count;
+        }
+    }
+
+    // Start processing the queue, if necessary.
+    queue_start();
+
+#if (FDS_GC_AUTO_ENABLED)
+    gc_auto_run(false);
+#endif
+
+    return FDS_SUCCESS;
+}
+
+
 ret_code_t fds_record_update(fds_record_desc_t       * const p_desc,
                              fds_record_t      const * const p_record)
 {
@@ -2020,33 +2813,28 @@ ret_code_t fds_file_delete(uint16_t file_id)
 
 ret_code_t fds_gc(void)
 {
-    fds_op_t * p_op;
-    nrf_atfifo_item_put_t iput_ctx;
-
     if (!m_flags.initialized)
     {
         return FDS_ERR_NOT_INITIALIZED;
     }
 
-    p_op = queue_buf_get(&iput_ctx);
-    if (p_op == NULL)
-    {
-        return FDS_ERR_NO_SPACE_IN_QUEUES;
-    }
-
-    p_op->op_code = FDS_OP_GC;
+    return gc_enqueue(FDS_DATA_PAGES, false);
+}
 
-    queue_buf_store(&iput_ctx);
 
-    if (m_gc.state != GC_BEGIN)
+ret_code_t fds_gc_incremental(uint16_t max_pages)
+{
+    if (!m_flags.initialized)
     {
-        // Resume GC by retrying the last step.
-        m_gc.resume = true;
+        return FDS_ERR_NOT_INITIALIZED;
     }
 
-    queue_start();
+    if (max_pages == 0)
+    {
+        return FDS_ERR_INVALID_ARG;
+    }
 
-    return FDS_SUCCESS;
+    return gc_enqueue(max_pages, false);
 }
 
 
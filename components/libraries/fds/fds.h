@@ -192,7 +192,8 @@ typedef enum
     FDS_EVT_UPDATE,     //!< Event for @ref fds_record_update.
     FDS_EVT_DEL_RECORD, //!< Event for @ref fds_record_delete.
     FDS_EVT_DEL_FILE,   //!< Event for @ref fds_file_delete.
-    FDS_EVT_GC          //!< Event for @ref fds_gc.
+    FDS_EVT_GC,         //!< Event for @ref fds_gc and @ref fds_gc_incremental.
+    FDS_EVT_WRITE_BATCH //!< Event for @ref fds_record_write_batch.
 } fds_evt_id_t;
 
 
@@ -218,6 +219,12 @@ typedef struct
             uint16_t file_id;
             uint16_t record_key;
         } del; //!< Information for @ref FDS_EVT_DEL_RECORD and @ref FDS_EVT_DEL_FILE events.
+        struct
+        {
+            uint32_t first_record_id;   //!< The ID of the first record. The IDs of the other records follow it.
+            uint16_t count;             //!< The number of records in the batch.
+            uint16_t committed;         //!< The number of records which were written, starting from the first one. Equal to @c count if the operation succeeded.
+        } batch; //!< Information for @ref FDS_EVT_WRITE_BATCH events.
     };
 } fds_evt_t;
 
@@ -410,6 +417,47 @@ ret_code_t fds_record_write_reserved(fds_record_desc_t         * p_desc,
                                      fds_reserve_token_t const * p_token);
 
 
+/**@brief   Function for writing several records to flash in one operation.
+ *
+ * The records are stored next to each other on the same virtual page. Space for all of them is
+ * reserved at once, their headers and data are written first, and then all of them are made
+ * valid in a single pass. Compared to writing the records one by one, this requires fewer flash
+ * operations and only one event is sent, when all records have been written.
+ *
+ * The records are assigned consecutive record IDs, in the order in which they appear in
+ * @p p_records. The same restrictions apply to each record as for @ref fds_record_write.
+ * The array of records and their data are not buffered internally, and must be kept in memory
+ * until the @ref FDS_EVT_WRITE_BATCH event has been received.
+ *
+ * This function is asynchronous. Completion is reported through an @ref FDS_EVT_WRITE_BATCH
+ * event that is sent to the registered event handler function.
+ *
+ * @note    The batch is not atomic. If the operation fails, or if the device resets before
+ *          it completes, some of the records might have been written. If the operation fails,
+ *          the @c committed field of the @ref FDS_EVT_WRITE_BATCH event tells how many records,
+ *          starting from the first one, were written. Only their descriptors are valid.
+ *
+ * @param[out]  p_descs     Array of @p count descriptors of the records that were written.
+ *                          Pass NULL if you do not need the descriptors.
+ * @param[in]   p_records   Array of @p count records to be written to flash.
+ * @param[in]   count       The number of records to write.
+ *
+ * @retval  FDS_SUCCESS                 If the operation was queued successfully.
+ * @retval  FDS_ERR_NOT_INITIALIZED     If the module is not initialized.
+ * @retval  FDS_ERR_NULL_ARG            If @p p_records is NULL.
+ * @retval  FDS_ERR_INVALID_ARG         If @p count is zero, or if the file ID or the record key
+ *                                      of a record is invalid.
+ * @retval  FDS_ERR_UNALIGNED_ADDR      If the data of a record is not aligned to a 4 byte boundary.
+ * @retval  FDS_ERR_RECORD_TOO_LARGE    If the records do not fit in a virtual page.
+ * @retval  FDS_ERR_NO_SPACE_IN_QUEUES  If the operation queue is full.
+ * @retval  FDS_ERR_NO_SPACE_IN_FLASH   If there is not enough free space in flash to store the
+ *                                      records.
+ */
+ret_code_t fds_record_write_batch(fds_record_desc_t       * p_descs,
+                                  fds_record_t      const * p_records,
+                                  uint16_t                  count);
+
+
 /**@brief   Function for deleting a record.
  *
  * Deleted records cannot be located using @ref fds_record_find, @ref fds_record_find_by_key, or
@@ -636,6 +684,29 @@ ret_code_t fds_record_close(fds_record_desc_t * p_desc);
 ret_code_t fds_gc(void);
 
 
+/**@brief   Function for running garbage collection on a limited number of pages.
+ *
+ * This function works like @ref fds_gc, but it stops after garbage collecting at most
+ * @p max_pages virtual pages. Pages are garbage collected in order of the amount of flash space
+ * that can be reclaimed from them, starting with the page that has the most.
+ *
+ * Use this function to split garbage collection into shorter runs, for example by running it
+ * on one page at a time when the application is idle, instead of keeping the flash busy
+ * until all pages have been garbage collected.
+ *
+ * This function is asynchronous. Completion is reported through an @ref FDS_EVT_GC event
+ * that is sent to the registered event handler function.
+ *
+ * @param[in]   max_pages   The maximum number of pages to garbage collect.
+ *
+ * @retval  FDS_SUCCESS                 If the operation was queued successfully.
+ * @retval  FDS_ERR_NOT_INITIALIZED     If the module is not initialized.
+ * @retval  FDS_ERR_INVALID_ARG         If @p max_pages is zero.
+ * @retval  FDS_ERR_NO_SPACE_IN_QUEUES  If the operation queue is full.
+ */
+ret_code_t fds_gc_incremental(uint16_t max_pages);
+
+
 /**@brief   Function for obtaining a descriptor from a record ID.
  *
  * This function can be used to reconstruct a descriptor from a record ID, like the one that is
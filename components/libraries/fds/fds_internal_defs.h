@@ -78,6 +78,7 @@ extern "C" {
 
 #define NRF_FSTORAGE_NVMC       1
 #define NRF_FSTORAGE_SD         2
+#define NRF_FSTORAGE_RAM        3
 
 // The size of a physical page, in 4-byte words.
 #if defined(NRF51)
@@ -107,6 +108,26 @@ extern "C" {
     #error "FDS requires at least two virtual pages."
 #endif
 
+#ifndef FDS_RECORD_INDEX_ENABLED
+    #define FDS_RECORD_INDEX_ENABLED    0
+#endif
+
+#ifndef FDS_RECORD_INDEX_SIZE
+    #define FDS_RECORD_INDEX_SIZE       32
+#endif
+
+#ifndef FDS_GC_AUTO_ENABLED
+    #define FDS_GC_AUTO_ENABLED         0
+#endif
+
+#ifndef FDS_GC_AUTO_THRESHOLD
+    #define FDS_GC_AUTO_THRESHOLD       256
+#endif
+
+#ifndef FDS_GC_AUTO_PAGES
+    #define FDS_GC_AUTO_PAGES           1
+#endif
+
 
 // Page types.
 typedef enum
@@ -134,6 +155,7 @@ typedef struct
     uint16_t                words_reserved; // The amount of words reserved.
     uint32_t volatile       records_open;   // The number of open records.
     bool                    can_gc;         // Indicates that there are some records that have been deleted.
+    uint16_t                words_freeable; // The amount of words garbage collection would reclaim.
 } fds_page_t;
 
 
@@ -153,7 +175,8 @@ typedef enum
     FDS_OP_UPDATE,      // Update a record.
     FDS_OP_DEL_RECORD,  // Delete a record.
     FDS_OP_DEL_FILE,    // Delete a file.
-    FDS_OP_GC           // Run garbage collection.
+    FDS_OP_GC,          // Run garbage collection.
+    FDS_OP_WRITE_BATCH  // Write several records to flash.
 } fds_op_code_t;
 
 
@@ -186,6 +209,16 @@ typedef enum
 } fds_delete_step_t;
 
 
+typedef enum
+{
+    FDS_OP_BATCH_WRITE_HEADER,      // Write the record key and length of a record.
+    FDS_OP_BATCH_WRITE_ID,          // Write the record ID of a record.
+    FDS_OP_BATCH_WRITE_DATA,        // Write the data of a record.
+    FDS_OP_BATCH_COMMIT,            // Write the file ID and CRC of a record.
+    FDS_OP_BATCH_DONE,
+} fds_batch_step_t;
+
+
 #if defined(__CC_ARM)
     #pragma push
     #pragma anon_unions
@@ -219,6 +252,23 @@ typedef struct
             uint16_t          record_key;
             uint32_t          record_to_delete;
         } del;
+        struct
+        {
+            uint16_t          max_pages;        // The maximum number of pages to garbage collect.
+            bool              is_auto;          // Queued by the module itself, no event is sent.
+        } gc;
+        struct
+        {
+            fds_record_t const * p_records;     // The records to write.
+            uint32_t             first_record_id;
+            uint16_t             count;         // The number of records to write.
+            uint16_t             page;          // The page the flash space for this command was reserved.
+            uint16_t             length_words;  // The length of all records, including headers.
+            uint16_t             cur;           // The record currently being written.
+            uint16_t             offset;        // The offset of the current record from the page write offset.
+            uint16_t             committed;     // The number of records committed, once the operation has ended.
+            fds_batch_step_t     step;          // The current step the operation is at.
+        } batch;
     };
 } fds_op_t;
 
@@ -301,11 +351,38 @@ typedef struct
     uint16_t         cur_page;                   // The current page being garbage collected.
     uint32_t const * p_record_src;               // The current record being copied to swap.
     uint16_t         run_count;                  // Total number of times GC was run.
+    uint16_t         pages_left;                 // The number of pages left to GC in this run.
     bool             do_gc_page[FDS_DATA_PAGES]; // Controls which pages to garbage collect.
     bool             resume;                     // Whether or not GC should be resumed.
 } fds_gc_data_t;
 
 
+#if (FDS_RECORD_INDEX_ENABLED)
+
+// An entry in the RAM index of valid records.
+typedef struct
+{
+    uint32_t const * p_record;      // The address of the record header in flash.
+    uint16_t         file_id;       // The file ID of the record.
+    uint16_t         record_key;    // The record key.
+    uint16_t         page;          // The page on which the record is stored.
+} fds_index_entry_t;
+
+
+// Holds the RAM index of valid records.
+// Entries are sorted by file ID, record key, page and address; the last two keys make the order
+// of records with the same file ID and record key match the order in which they are found
+// when scanning flash, so that find tokens remain interchangeable between the two methods.
+typedef struct
+{
+    fds_index_entry_t entry[FDS_RECORD_INDEX_SIZE];
+    uint16_t          count;    // The number of entries in use.
+    bool              valid;    // Whether or not the index reflects the contents of flash.
+} fds_index_t;
+
+#endif // FDS_RECORD_INDEX_ENABLED
+
+
 // Macros to enable and disable application interrupts.
 #if defined (FDS_THREADS)
 
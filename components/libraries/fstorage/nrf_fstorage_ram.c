@@ -0,0 +1,368 @@
+/**
+ * Copyright (c) 2018, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "sdk_common.h"
+
+#if NRF_MODULE_ENABLED(NRF_FSTORAGE)
+
+#include "nrf_fstorage_ram.h"
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "nrf_atomic.h"
+
+
+#if   defined(NRF51)
+    #define RAM_ERASE_UNIT  1024
+#else
+    #define RAM_ERASE_UNIT  4096
+#endif
+
+STATIC_ASSERT((NRF_FSTORAGE_RAM_SIZE % RAM_ERASE_UNIT) == 0);
+
+
+static nrf_fstorage_info_t m_flash_info =
+{
+    .erase_unit   = RAM_ERASE_UNIT,
+    .program_unit = 4,
+    .rmap         = true,
+    .wmap         = false,
+};
+
+/* The emulated flash. */
+__ALIGN(RAM_ERASE_UNIT) static uint32_t m_flash[NRF_FSTORAGE_RAM_SIZE / sizeof(uint32_t)];
+
+/* The emulated flash was erased by the first initialization. */
+static bool m_flash_erased;
+
+/* An operation initiated by fstorage is ongoing. */
+static nrf_atomic_flag_t m_flash_operation_ongoing;
+
+/* Operations complete when nrf_fstorage_ram_process() is called. */
+static bool m_defer;
+
+/* Number of writes which did not change the content of the emulated flash. */
+static uint32_t m_rewrites;
+
+/* The operation held back until nrf_fstorage_ram_process() is called. */
+static struct
+{
+    nrf_fstorage_t const * p_fs;
+    bool                   erase;
+    uint32_t               addr;
+    void           const * p_src;
+    uint32_t               len;
+    void                 * p_param;
+} m_pending;
+
+
+/* Send event to the event handler. */
+static void event_send(nrf_fstorage_t        const * p_fs,
+                       nrf_fstorage_evt_id_t         evt_id,
+                       ret_code_t                    result,
+                       void const *                  p_src,
+                       uint32_t                      addr,
+                       uint32_t                      len,
+                       void                        * p_param)
+{
+    if (p_fs->evt_handler == NULL)
+    {
+        /* Nothing to do. */
+        return;
+    }
+
+    nrf_fstorage_evt_t evt =
+    {
+        .result  = result,
+        .id      = evt_id,
+        .addr    = addr,
+        .p_src   = p_src,
+        .len     = len,
+        .p_param = p_param,
+    };
+
+    p_fs->evt_handler(&evt);
+}
+
+
+uint32_t nrf_fstorage_ram_start_addr(void)
+{
+    return (uint32_t)(uintptr_t)m_flash;
+}
+
+
+uint32_t nrf_fstorage_ram_end_addr(void)
+{
+    return (uint32_t)(uintptr_t)m_flash + NRF_FSTORAGE_RAM_SIZE;
+}
+
+
+static ret_code_t init(nrf_fstorage_t * p_fs, void * p_param)
+{
+    UNUSED_PARAMETER(p_param);
+
+    /* Addresses are 32 bits wide. On a 64-bit host, link the program without PIE
+     * to place the emulated flash in the lower 4 GB of the address space. */
+    if ((uintptr_t)m_flash + NRF_FSTORAGE_RAM_SIZE > UINT32_MAX)
+    {
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    if ((p_fs->start_addr < nrf_fstorage_ram_start_addr()) ||
+        (p_fs->end_addr   > nrf_fstorage_ram_end_addr())   ||
+        (p_fs->start_addr > p_fs->end_addr))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    if (!m_flash_erased)
+    {
+        memset(m_flash, 0xFF, sizeof(m_flash));
+        m_flash_erased = true;
+    }
+
+    p_fs->p_flash_info = &m_flash_info;
+
+    return NRF_SUCCESS;
+}
+
+
+static ret_code_t uninit(nrf_fstorage_t * p_fs, void * p_param)
+{
+    UNUSED_PARAMETER(p_fs);
+    UNUSED_PARAMETER(p_param);
+
+    (void) nrf_atomic_flag_clear(&m_flash_operation_ongoing);
+
+    return NRF_SUCCESS;
+}
+
+
+static ret_code_t read(nrf_fstorage_t const * p_fs, uint32_t src, void * p_dest, uint32_t len)
+{
+    UNUSED_PARAMETER(p_fs);
+
+    memcpy(p_dest, (uint32_t*)(uintptr_t)src, len);
+
+    return NRF_SUCCESS;
+}
+
+
+/* Length of the pending operation in bytes. */
+static uint32_t pending_len(void)
+{
+    return m_pending.erase ? (m_pending.len * m_flash_info.erase_unit) : m_pending.len;
+}
+
+
+/* Execute the first len bytes of the pending operation, and send its event if requested. */
+static void pending_execute(uint32_t len, ret_code_t result, bool send)
+{
+    nrf_fstorage_t const * p_fs = m_pending.p_fs;
+
+    if (m_pending.erase)
+    {
+        memset((uint32_t*)(uintptr_t)m_pending.addr, 0xFF, len);
+    }
+    else
+    {
+        uint32_t       * p_dest  = (uint32_t*)(uintptr_t)m_pending.addr;
+        uint8_t  const * p_data  = (uint8_t const *)m_pending.p_src;
+        bool             changed = false;
+
+        /* Like flash, programming can only clear bits. The source buffer might not be aligned. */
+        for (uint32_t i = 0; i < (len / m_flash_info.program_unit); i++)
+        {
+            uint32_t word;
+            memcpy(&word, &p_data[i * sizeof(uint32_t)], sizeof(word));
+            changed   |= ((p_dest[i] & word) != p_dest[i]) || (p_dest[i] == 0xFFFFFFFF);
+            p_dest[i] &= word;
+        }
+
+        if ((!changed) && (len == m_pending.len))
+        {
+            m_rewrites++;
+        }
+    }
+
+    /* Clear the flag before sending the event, to allow API calls in the event context. */
+    (void) nrf_atomic_flag_clear(&m_flash_operation_ongoing);
+
+    if (send)
+    {
+        event_send(p_fs,
+                   m_pending.erase ? NRF_FSTORAGE_EVT_ERASE_RESULT : NRF_FSTORAGE_EVT_WRITE_RESULT,
+                   result, m_pending.p_src, m_pending.addr, m_pending.len, m_pending.p_param);
+    }
+}
+
+
+static ret_code_t write(nrf_fstorage_t const * p_fs,
+                        uint32_t               dest,
+                        void           const * p_src,
+                        uint32_t               len,
+                        void                 * p_param)
+{
+    if (nrf_atomic_flag_set_fetch(&m_flash_operation_ongoing))
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    m_pending.p_fs    = p_fs;
+    m_pending.erase   = false;
+    m_pending.addr    = dest;
+    m_pending.p_src   = p_src;
+    m_pending.len     = len;
+    m_pending.p_param = p_param;
+
+    if (!m_defer)
+    {
+        pending_execute(pending_len(), NRF_SUCCESS, true);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+static ret_code_t erase(nrf_fstorage_t const * p_fs,
+                        uint32_t               page_addr,
+                        uint32_t               len,
+                        void                 * p_param)
+{
+    if (nrf_atomic_flag_set_fetch(&m_flash_operation_ongoing))
+    {
+        return NRF_ERROR_BUSY;
+    }
+
+    m_pending.p_fs    = p_fs;
+    m_pending.erase   = true;
+    m_pending.addr    = page_addr;
+    m_pending.p_src   = NULL;
+    m_pending.len     = len;
+    m_pending.p_param = p_param;
+
+    if (!m_defer)
+    {
+        pending_execute(pending_len(), NRF_SUCCESS, true);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+void nrf_fstorage_ram_defer(bool defer)
+{
+    m_defer = defer;
+}
+
+
+bool nrf_fstorage_ram_process(void)
+{
+    if (!m_flash_operation_ongoing)
+    {
+        return false;
+    }
+
+    pending_execute(pending_len(), NRF_SUCCESS, true);
+
+    return true;
+}
+
+
+bool nrf_fstorage_ram_interrupt(uint32_t len, bool send_event)
+{
+    if (!m_flash_operation_ongoing)
+    {
+        return false;
+    }
+
+    pending_execute(MIN(len, pending_len()), NRF_ERROR_TIMEOUT, send_event);
+
+    return true;
+}
+
+
+uint32_t nrf_fstorage_ram_rewrites_get(void)
+{
+    return m_rewrites;
+}
+
+
+static uint8_t const * rmap(nrf_fstorage_t const * p_fs, uint32_t addr)
+{
+    UNUSED_PARAMETER(p_fs);
+
+    return (uint8_t*)(uintptr_t)addr;
+}
+
+
+static uint8_t * wmap(nrf_fstorage_t const * p_fs, uint32_t addr)
+{
+    UNUSED_PARAMETER(p_fs);
+    UNUSED_PARAMETER(addr);
+
+    /* Not supported. */
+    return NULL;
+}
+
+
+static bool is_busy(nrf_fstorage_t const * p_fs)
+{
+    UNUSED_PARAMETER(p_fs);
+
+    return m_flash_operation_ongoing;
+}
+
+
+/* The exported API. */
+nrf_fstorage_api_t nrf_fstorage_ram =
+{
+    .init    = init,
+    .uninit  = uninit,
+    .read    = read,
+    .write   = write,
+    .erase   = erase,
+    .rmap    = rmap,
+    .wmap    = wmap,
+    .is_busy = is_busy
+};
+
+
+#endif // NRF_FSTORAGE_ENABLED
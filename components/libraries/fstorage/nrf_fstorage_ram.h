@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2018, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * @file
+ *
+ * @defgroup nrf_fstorage_ram RAM implementation
+ * @ingroup nrf_fstorage
+ * @{
+ *
+ * @brief API implementation of fstorage that emulates flash memory in RAM.
+ *
+ * @details The emulated flash is a RAM area of @ref NRF_FSTORAGE_RAM_SIZE bytes, aligned to
+ *          the flash page size. Flash semantics are kept: erasing sets a page to 0xFF and
+ *          writing can only clear bits. Operations are executed synchronously, and the event
+ *          is sent before the API call returns, unless they are deferred with
+ *          @ref nrf_fstorage_ram_defer.
+ *
+ *          This implementation is meant for testing and benchmarking modules that use fstorage
+ *          without wearing out the flash, for example in a PC host build.
+ *          The content of the emulated flash persists through @ref nrf_fstorage_uninit,
+ *          but not through a reset.
+ */
+
+#ifndef NRF_FSTORAGE_RAM_H__
+#define NRF_FSTORAGE_RAM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_config.h"
+#include "nrf_fstorage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#ifndef NRF_FSTORAGE_RAM_SIZE
+#define NRF_FSTORAGE_RAM_SIZE 32768
+#endif
+
+
+/**@brief   API implementation that emulates flash memory in RAM.
+ *
+ * @details An fstorage instance with this API implementation can be initialized by providing
+ *          this structure as a parameter to @ref nrf_fstorage_init.
+ *          The boundaries of the instance must be within the emulated flash, see
+ *          @ref nrf_fstorage_ram_start_addr and @ref nrf_fstorage_ram_end_addr.
+ *          The structure is defined in @c nrf_fstorage_ram.c.
+ */
+extern nrf_fstorage_api_t nrf_fstorage_ram;
+
+
+/**@brief   Function for getting the address of the first byte of the emulated flash.
+ *
+ * @return  Address which can be used as the @c start_addr of an fstorage instance.
+ */
+uint32_t nrf_fstorage_ram_start_addr(void);
+
+
+/**@brief   Function for getting the address of the first byte after the emulated flash.
+ *
+ * @return  Address which can be used as the @c end_addr of an fstorage instance.
+ */
+uint32_t nrf_fstorage_ram_end_addr(void);
+
+
+/**@brief   Function for deferring the completion of flash operations.
+ *
+ * @details When operations are deferred, a write or erase operation is accepted, but it takes
+ *          effect, and its event is sent, only when @ref nrf_fstorage_ram_process is called.
+ *          Like with flash accessed through the SoftDevice, this lets other code run while
+ *          an operation is in progress. Only one operation can be in progress at a time.
+ *
+ * @param[in]   defer   Whether to defer operations or to execute them synchronously.
+ */
+void nrf_fstorage_ram_defer(bool defer);
+
+
+/**@brief   Function for completing the operation in progress.
+ *
+ * @retval  true    If an operation was completed and its event was sent.
+ * @retval  false   If no operation was in progress.
+ */
+bool nrf_fstorage_ram_process(void);
+
+
+/**@brief   Function for interrupting the operation in progress.
+ *
+ * @details This simulates a flash operation which times out, or which is cut short by a reset.
+ *          Only the beginning of the operation takes effect: the first @p len bytes of a write
+ *          are programmed, or the first @p len bytes of an erased area are erased.
+ *
+ * @param[in]   len         Number of bytes which take effect. A write takes effect in whole words.
+ * @param[in]   send_event  Whether to send the event of the operation, with the result
+ *                          NRF_ERROR_TIMEOUT. No event is sent when simulating a reset.
+ *
+ * @retval  true    If an operation was interrupted.
+ * @retval  false   If no operation was in progress.
+ */
+bool nrf_fstorage_ram_interrupt(uint32_t len, bool send_event);
+
+
+/**@brief   Function for getting the number of writes which did not change the emulated flash.
+ *
+ * @details A write changes nothing when it programs words which are not erased with the value
+ *          they already have, which happens when a write is repeated.
+ *
+ * @return  Number of such writes since the program started.
+ */
+uint32_t nrf_fstorage_ram_rewrites_get(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_FSTORAGE_RAM_H__
+/** @} */
@@ -429,7 +429,18 @@ NRF_LOG_MODULE_REGISTER();
 #define BLOCK_CAT_XXL                  6                                                            /**< Extra Extra Large category identifier. */
 
 #define BITMAP_SIZE                    32                                                           /**< Bitmap size for each word used to contain block information. */
-#define BLOCK_BITMAP_ARRAY_SIZE        CEIL_DIV(TOTAL_BLOCK_COUNT, BITMAP_SIZE)                     /**< Determines number of blocks needed for book keeping availability status of all blocks. */
+
+/**@brief Bitmap of each block category starts at a word boundary, so that a free block of the
+ *        category can be found by scanning the category words only.
+ */
+#define XXSMALL_BITMAP_START           0
+#define XSMALL_BITMAP_START            (XXSMALL_BITMAP_START + CEIL_DIV(MEMORY_MANAGER_XXSMALL_BLOCK_COUNT, BITMAP_SIZE))
+#define SMALL_BITMAP_START             (XSMALL_BITMAP_START  + CEIL_DIV(MEMORY_MANAGER_XSMALL_BLOCK_COUNT,  BITMAP_SIZE))
+#define MEDIUM_BITMAP_START            (SMALL_BITMAP_START   + CEIL_DIV(MEMORY_MANAGER_SMALL_BLOCK_COUNT,   BITMAP_SIZE))
+#define LARGE_BITMAP_START             (MEDIUM_BITMAP_START  + CEIL_DIV(MEMORY_MANAGER_MEDIUM_BLOCK_COUNT,  BITMAP_SIZE))
+#define XLARGE_BITMAP_START            (LARGE_BITMAP_START   + CEIL_DIV(MEMORY_MANAGER_LARGE_BLOCK_COUNT,   BITMAP_SIZE))
+#define XXLARGE_BITMAP_START           (XLARGE_BITMAP_START  + CEIL_DIV(MEMORY_MANAGER_XLARGE_BLOCK_COUNT,  BITMAP_SIZE))
+#define BLOCK_BITMAP_ARRAY_SIZE        (XXLARGE_BITMAP_START + CEIL_DIV(MEMORY_MANAGER_XXLARGE_BLOCK_COUNT, BITMAP_SIZE)) /**< Determines number of words needed for book keeping availability status of all blocks. */
 
 
 /**@brief Lookup table for maximum memory size per block category. */
@@ -480,8 +491,22 @@ static const uint32_t m_block_mem_start[BLOCK_CAT_COUNT] =
     XXLARGE_MEMORY_START
 };
 
+/**@brief Lookup table for the first bitmap word of each block category. */
+static const uint32_t m_block_bitmap_start[BLOCK_CAT_COUNT + 1] =
+{
+    XXSMALL_BITMAP_START,
+    XSMALL_BITMAP_START,
+    SMALL_BITMAP_START,
+    MEDIUM_BITMAP_START,
+    LARGE_BITMAP_START,
+    XLARGE_BITMAP_START,
+    XXLARGE_BITMAP_START,
+    BLOCK_BITMAP_ARRAY_SIZE
+};
+
 static uint8_t  m_memory[TOTAL_MEMORY_SIZE];                                                        /**< Memory managed by the module. */
 static uint32_t m_mem_pool[BLOCK_BITMAP_ARRAY_SIZE];                                                /**< Bitmap used for book-keeping availability of all blocks managed by the module.  */
+static uint32_t m_free_cat_mask;                                                                    /**< Bitmap of block categories which have at least one free block. */
 
 #ifdef MEM_MANAGER_ENABLE_DIAGNOSTICS
 
@@ -512,12 +537,6 @@ static uint32_t m_min_size[BLOCK_CAT_COUNT]  =
 /**@brief Table for book keeping largest size allocated in each block range. */
 static uint32_t m_max_size[BLOCK_CAT_COUNT];
 
-/**@brief Global pointing to minimum size holder for block type being allocated. */
-static uint32_t * p_min_size;
-
-/**@brief Global pointing to maximum size holder for block type being allocated. */
-static uint32_t * p_max_size;
-
 /**@brief Lookup table for count of block available in each block category. */
 static uint32_t m_block_count[BLOCK_CAT_COUNT] =
 {
@@ -543,34 +562,22 @@ static bool     m_module_initialized = false;
  * @details Function to get X and Y co-ordinates for the block identified by index.
  *          Here, X determines relevant word for the block. Y determines the actual bit in the word.
  *
- * @param[in]  index Identifies the block.
- * @param[out] p_x   Points to the word that contains the bit representing the block.
- * @param[out] p_y   Contains the bitnumber in the the word 'X' relevant to the block.
+ * @param[in]  block_cat   Category of the block.
+ * @param[in]  block_index Identifies the block.
+ * @param[out] p_x         Points to the word that contains the bit representing the block.
+ * @param[out] p_y         Contains the bitnumber in the the word 'X' relevant to the block.
  */
-static __INLINE void get_block_coordinates(uint32_t block_index, uint32_t * p_x, uint32_t * p_y)
+static __INLINE void get_block_coordinates(uint32_t   block_cat,
+                                           uint32_t   block_index,
+                                           uint32_t * p_x,
+                                           uint32_t * p_y)
 {
-    // Determine position of the block in the bitmap.
+    // Determine position of the block in the bitmap of its category.
     // X determines relevant word for the block. Y determines the actual bit in the word.
-    const uint32_t x = block_index / BITMAP_SIZE;
-    const uint32_t y = (block_index - x * BITMAP_SIZE);
+    const uint32_t offset = block_index - m_block_start[block_cat];
 
-    (*p_x) = x;
-    (*p_y) = y;
-}
-
-
-/**@brief Initializes the block by setting it to be free. */
-static void block_init (uint32_t block_index)
-{
-    uint32_t x;
-    uint32_t y;
-
-    // Determine position of the block in the bitmap.
-    // X determines relevant word for the block. Y determines the actual bit in the word.
-    get_block_coordinates(block_index, &x, &y);
-
-    // Set bit related to the block to indicate that the block is free.
-    SET_BIT(m_mem_pool[x], y);
+    (*p_x) = m_block_bitmap_start[block_cat] + (offset / BITMAP_SIZE);
+    (*p_y) = offset % BITMAP_SIZE;
 }
 
 
@@ -591,45 +598,80 @@ static __INLINE uint32_t get_block_cat(uint32_t size, uint32_t block_index)
 }
 
 
-/**@brief Function to get the size of the block number 'block_index'. */
-static __INLINE uint32_t get_block_size(uint32_t block_index)
+/**@brief Initializes the block by setting it to be free. */
+static void block_init(uint32_t block_cat, uint32_t block_index)
 {
-    const uint32_t block_cat = get_block_cat(0, block_index);
+    uint32_t x;
+    uint32_t y;
 
-    #ifdef MEM_MANAGER_ENABLE_DIAGNOSTICS
-        p_min_size = &m_min_size[block_cat];
-        p_max_size = &m_max_size[block_cat];
-    #endif // MEM_MANAGER_ENABLE_DIAGNOSTICS
+    get_block_coordinates(block_cat, block_index, &x, &y);
 
-    return m_block_size[block_cat];
+    // Set bit related to the block to indicate that the block is free.
+    SET_BIT(m_mem_pool[x], y);
+    SET_BIT(m_free_cat_mask, block_cat);
 }
 
 
-/**@brief Function to free the block identified by block number 'block_index'. */
-static bool is_block_free(uint32_t block_index)
+#ifdef MEM_MANAGER_ENABLE_DIAGNOSTICS
+
+/**@brief Function to check if the block identified by block number 'block_index' is free. */
+static bool is_block_free(uint32_t block_cat, uint32_t block_index)
 {
     uint32_t x;
     uint32_t y;
 
-    // Determine position of the block in the bitmap.
-    // X determines relevant word for the block. Y determines the actual bit in the word.
-    get_block_coordinates(block_index, &x, &y);
+    get_block_coordinates(block_cat, block_index, &x, &y);
 
     return IS_SET(m_mem_pool[x], y);
 }
 
+#endif // MEM_MANAGER_ENABLE_DIAGNOSTICS
 
-/**@brief Function to allocate the block identified by block number 'block_index'. */
-static void block_allocate(uint32_t block_index)
+
+/**@brief Function to allocate a free block of the category 'block_cat'.
+ *
+ * @details Category must have at least one free block. The first free block is located by
+ *          count leading zeros on the bit reversed bitmap word.
+ *
+ * @return Block number of the allocated block.
+ */
+static uint32_t block_allocate(uint32_t block_cat)
 {
-    uint32_t x;
+    uint32_t x = m_block_bitmap_start[block_cat];
     uint32_t y;
 
-    // Determine position of the block in the bitmap.
-    // X determines relevant word for the block. Y determines the actual bit in the word.
-    get_block_coordinates(block_index, &x, &y);
+    while (m_mem_pool[x] == 0)
+    {
+        x++;
+    }
+
+    ASSERT(x < m_block_bitmap_start[block_cat + 1]);
 
+    y = __CLZ(__RBIT(m_mem_pool[x]));
     CLR_BIT(m_mem_pool[x], y);
+
+    if (m_mem_pool[x] == 0)
+    {
+        // Check if it was the last free block of the category.
+        uint32_t word;
+
+        for (word = m_block_bitmap_start[block_cat];
+             word < m_block_bitmap_start[block_cat + 1];
+             word++)
+        {
+            if (m_mem_pool[word] != 0)
+            {
+                break;
+            }
+        }
+
+        if (word == m_block_bitmap_start[block_cat + 1])
+        {
+            CLR_BIT(m_free_cat_mask, block_cat);
+        }
+    }
+
+    return m_block_start[block_cat] + (x - m_block_bitmap_start[block_cat]) * BITMAP_SIZE + y;
 }
 
 
@@ -645,7 +687,7 @@ uint32_t nrf_mem_init(void)
 
     for (block_index = 0; block_index < TOTAL_BLOCK_COUNT; block_index++)
     {
-        block_init(block_index);
+        block_init(get_block_cat(0, block_index), block_index);
     }
 
 #if (MEM_MANAGER_DISABLE_API_PARAM_CHECK == 0)
@@ -678,40 +720,36 @@ uint32_t nrf_mem_reserve(uint8_t ** pp_buffer, uint32_t * p_size)
 
     MM_MUTEX_LOCK();
 
-    const uint32_t block_cat    = get_block_cat(requested_size, TOTAL_BLOCK_COUNT);
-    uint32_t       block_index  = m_block_start[block_cat];
-    uint32_t       memory_index = m_block_mem_start[block_cat];
-    uint32_t       err_code     = (NRF_ERROR_NO_MEM | NRF_ERROR_MEMORY_MANAGER_ERR_BASE);
+    const uint32_t block_cat = get_block_cat(requested_size, TOTAL_BLOCK_COUNT);
+    uint32_t       err_code  = (NRF_ERROR_NO_MEM | NRF_ERROR_MEMORY_MANAGER_ERR_BASE);
 
-    NRF_LOG_DEBUG("Start index for the pool = 0x%08lX, total block count 0x%08X",
-           block_index,
-           TOTAL_BLOCK_COUNT);
-
-    for (; block_index < TOTAL_BLOCK_COUNT; block_index++)
-    {
-        uint32_t block_size = get_block_size(block_index);
+    // Categories which can hold the requested size and have a free block. If the best fitting
+    // category is exhausted, the next one with a free block is used.
+    const uint32_t cat_mask  = m_free_cat_mask & ~((1UL << block_cat) - 1);
 
-        if (is_block_free(block_index) == true)
-        {
-            NRF_LOG_DEBUG("Reserving block 0x%08lX", block_index);
+    NRF_LOG_DEBUG("Block category %d, free category mask 0x%08lX",
+           block_cat,
+           m_free_cat_mask);
 
-            // Search succeeded, found free block.
-            err_code     = NRF_SUCCESS;
+    if (cat_mask != 0)
+    {
+        const uint32_t alloc_cat   = __CLZ(__RBIT(cat_mask));
+        const uint32_t block_index = block_allocate(alloc_cat);
+        const uint32_t block_size  = m_block_size[alloc_cat];
 
-            // Allocate block.
-            block_allocate(block_index);
+        NRF_LOG_DEBUG("Reserving block 0x%08lX", block_index);
 
-            (*pp_buffer) = &m_memory[memory_index];
-            (*p_size)    = block_size;
+        // Search succeeded, found free block.
+        err_code     = NRF_SUCCESS;
 
-            #ifdef MEM_MANAGER_ENABLE_DIAGNOSTICS
-                (*p_min_size) = MIN((*p_min_size), requested_size);
-                (*p_max_size) = MAX((*p_max_size), requested_size);
-            #endif // MEM_MANAGER_ENABLE_DIAGNOSTICS
+        (*pp_buffer) = &m_memory[m_block_mem_start[alloc_cat] +
+                                 (block_index - m_block_start[alloc_cat]) * block_size];
+        (*p_size)    = block_size;
 
-            break;
-        }
-        memory_index += block_size;
+        #ifdef MEM_MANAGER_ENABLE_DIAGNOSTICS
+            m_min_size[alloc_cat] = MIN(m_min_size[alloc_cat], requested_size);
+            m_max_size[alloc_cat] = MAX(m_max_size[alloc_cat], requested_size);
+        #endif // MEM_MANAGER_ENABLE_DIAGNOSTICS
     }
     if (err_code != NRF_SUCCESS)
     {
@@ -782,19 +820,26 @@ void nrf_free(void * p_mem)
 
     MM_MUTEX_LOCK();
 
-    uint32_t index;
-    uint32_t memory_index = 0;
+    const uint32_t memory_index = (uint32_t)((uint8_t *)p_mem - m_memory);
 
-    for (index = 0; index < TOTAL_BLOCK_COUNT; index++)
+    for (uint32_t block_cat = 0; block_cat < BLOCK_CAT_COUNT; block_cat++)
     {
-        if (&m_memory[memory_index] == p_mem)
+        const uint32_t block_count = m_block_end[block_cat] - m_block_start[block_cat];
+        const uint32_t offset      = memory_index - m_block_mem_start[block_cat];
+
+        if ((memory_index >= m_block_mem_start[block_cat]) &&
+            (offset < block_count * m_block_size[block_cat]))
         {
-            // Found a free block of memory, assign.
-            NRF_LOG_DEBUG("<< Freeing block %d.", index);
-            block_init(index);
+            if ((offset % m_block_size[block_cat]) == 0)
+            {
+                const uint32_t index = m_block_start[block_cat] + offset / m_block_size[block_cat];
+
+                // Found a free block of memory, assign.
+                NRF_LOG_DEBUG("<< Freeing block %d.", index);
+                block_init(block_cat, index);
+            }
             break;
         }
-        memory_index += get_block_size(index);
     }
 
     MM_MUTEX_UNLOCK();
@@ -841,7 +886,7 @@ void print_block_info(uint32_t block_cat, uint32_t * p_mem_in_use)
 
         for (; index < total_count; index++)
         {
-            if (is_block_free(index) == false)
+            if (is_block_free(block_cat, index) == false)
             {
                 num_of_blocks++;
                 in_use += m_block_size[block_cat];
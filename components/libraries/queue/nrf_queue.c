@@ -93,7 +93,8 @@ static void nrf_queue_status(nrf_cli_t const * p_cli, size_t argc, char **argv)
                         p_name, element_size,
                         100ul * util/size, util,size,
                         100ul * max_util/size, max_util,size,
-                        (p_instance->mode == NRF_QUEUE_MODE_OVERFLOW) ? "Overflow" : "No overflow");
+                        (p_instance->mode == NRF_QUEUE_MODE_OVERFLOW) ? "Overflow" :
+                        (p_instance->mode == NRF_QUEUE_MODE_SPSC)     ? "SPSC"     : "No overflow");
 
     }
 }
@@ -107,6 +108,36 @@ NRF_CLI_CREATE_STATIC_SUBCMD_SET(nrf_queue_commands)
 NRF_CLI_CMD_REGISTER(queue, &nrf_queue_commands, "Commands for BALLOC management", nrf_queue_status);
 #endif //NRF_QUEUE_CLI_CMDS
 
+/**@brief Macro for entering the region that protects the queue control block.
+ *
+ * Queues in @ref NRF_QUEUE_MODE_SPSC mode are not protected. The producer only moves the back index
+ * and the consumer only moves the front index, so interrupts are left enabled.
+ *
+ * @note There must be one @ref QUEUE_CRITICAL_REGION_EXIT for each QUEUE_CRITICAL_REGION_ENTER,
+ *       in the same scope.
+ */
+#define QUEUE_CRITICAL_REGION_ENTER(_p_queue)                                   \
+    {                                                                           \
+        uint8_t __QUEUE_CR_NESTED = 0;                                          \
+        bool    __QUEUE_CR_LOCKED = ((_p_queue)->mode != NRF_QUEUE_MODE_SPSC);  \
+        if (__QUEUE_CR_LOCKED)                                                  \
+        {                                                                       \
+            app_util_critical_region_enter(&__QUEUE_CR_NESTED);                 \
+        }
+
+/**@brief Macro for leaving the region entered with @ref QUEUE_CRITICAL_REGION_ENTER. */
+#define QUEUE_CRITICAL_REGION_EXIT()                                            \
+        if (__QUEUE_CR_LOCKED)                                                  \
+        {                                                                       \
+            app_util_critical_region_exit(__QUEUE_CR_NESTED);                   \
+        }                                                                       \
+    }
+
+/**@brief Macro for making sure that element data is written or read before the index that hands
+ *        the element over to the other side is updated.
+ */
+#define QUEUE_INDEX_PUBLISH_BARRIER()   __DMB()
+
 /**@brief Get next element index.
  *
  * @param[in]   p_queue     Pointer to the queue instance.
@@ -149,20 +180,13 @@ ret_code_t nrf_queue_push(nrf_queue_t const * p_queue, void const * p_element)
     ASSERT(p_queue != NULL);
     ASSERT(p_element != NULL);
 
-    CRITICAL_REGION_ENTER();
+    QUEUE_CRITICAL_REGION_ENTER(p_queue);
     bool is_full = nrf_queue_is_full(p_queue);
 
     if (!is_full || (p_queue->mode == NRF_QUEUE_MODE_OVERFLOW))
     {
         // Get write position.
         size_t write_pos = p_queue->p_cb->back;
-        p_queue->p_cb->back = nrf_queue_next_idx(p_queue, p_queue->p_cb->back);
-        if (is_full)
-        {
-            // Overwrite the oldest element.
-            NRF_LOG_INST_WARNING(p_queue->p_log, "Queue full. Overwriting oldest element.");
-            p_queue->p_cb->front = nrf_queue_next_idx(p_queue, p_queue->p_cb->front);
-        }
 
         // Write a new element.
         switch (p_queue->element_size)
@@ -190,6 +214,16 @@ ret_code_t nrf_queue_push(nrf_queue_t const * p_queue, void const * p_element)
                 break;
         }
 
+        // Hand the element over to the consumer.
+        QUEUE_INDEX_PUBLISH_BARRIER();
+        p_queue->p_cb->back = nrf_queue_next_idx(p_queue, write_pos);
+        if (is_full)
+        {
+            // Overwrite the oldest element.
+            NRF_LOG_INST_WARNING(p_queue->p_log, "Queue full. Overwriting oldest element.");
+            p_queue->p_cb->front = nrf_queue_next_idx(p_queue, p_queue->p_cb->front);
+        }
+
         // Update utilization.
         size_t utilization = queue_utilization_get(p_queue);
         if (p_queue->p_cb->max_utilization < utilization)
@@ -202,7 +236,7 @@ ret_code_t nrf_queue_push(nrf_queue_t const * p_queue, void const * p_element)
         status = NRF_ERROR_NO_MEM;
     }
 
-    CRITICAL_REGION_EXIT();
+    QUEUE_CRITICAL_REGION_EXIT();
 
     NRF_LOG_INST_DEBUG(p_queue->p_log, "pushed element 0x%08X, status:%d", p_element, status);
     return status;
@@ -217,19 +251,13 @@ ret_code_t nrf_queue_generic_pop(nrf_queue_t const * p_queue,
     ASSERT(p_queue      != NULL);
     ASSERT(p_element    != NULL);
 
-    CRITICAL_REGION_ENTER();
+    QUEUE_CRITICAL_REGION_ENTER(p_queue);
 
     if (!nrf_queue_is_empty(p_queue))
     {
         // Get read position.
         size_t read_pos = p_queue->p_cb->front;
 
-        // Update next read position.
-        if (!just_peek)
-        {
-            p_queue->p_cb->front = nrf_queue_next_idx(p_queue, p_queue->p_cb->front);
-        }
-
         // Read element.
         switch (p_queue->element_size)
         {
@@ -255,13 +283,20 @@ ret_code_t nrf_queue_generic_pop(nrf_queue_t const * p_queue,
                        p_queue->element_size);
                 break;
         }
+
+        // Update next read position. This frees the slot for the producer.
+        if (!just_peek)
+        {
+            QUEUE_INDEX_PUBLISH_BARRIER();
+            p_queue->p_cb->front = nrf_queue_next_idx(p_queue, read_pos);
+        }
     }
     else
     {
         status = NRF_ERROR_NOT_FOUND;
     }
 
-    CRITICAL_REGION_EXIT();
+    QUEUE_CRITICAL_REGION_EXIT();
     NRF_LOG_INST_DEBUG(p_queue->p_log, "%s element 0x%08X, status:%d",
                                          just_peek ? "peeked" : "popped", p_element, status);
     return status;
@@ -276,7 +311,7 @@ ret_code_t nrf_queue_generic_pop(nrf_queue_t const * p_queue,
  */
 static void queue_write(nrf_queue_t const * p_queue, void const * p_data, uint32_t element_count)
 {
-    size_t prev_available = nrf_queue_available_get(p_queue);
+    size_t prev_available = p_queue->size - queue_utilization_get(p_queue);
     size_t continuous     = p_queue->size + 1 - p_queue->p_cb->back;
     void * p_write_ptr    = (void *)((size_t)p_queue->p_buffer
                           + p_queue->p_cb->back * p_queue->element_size);
@@ -286,6 +321,7 @@ static void queue_write(nrf_queue_t const * p_queue, void const * p_data, uint32
                p_data,
                element_count * p_queue->element_size);
 
+        QUEUE_INDEX_PUBLISH_BARRIER();
         p_queue->p_cb->back = ((p_queue->p_cb->back + element_count) <= p_queue->size)
                             ? (p_queue->p_cb->back + element_count)
                             : 0;
@@ -302,6 +338,7 @@ static void queue_write(nrf_queue_t const * p_queue, void const * p_data, uint32
                (void const *)((size_t)p_data + first_write_length),
                elements_left * p_queue->element_size);
 
+        QUEUE_INDEX_PUBLISH_BARRIER();
         p_queue->p_cb->back = elements_left;
         if (prev_available < element_count)
         {
@@ -333,7 +370,7 @@ ret_code_t nrf_queue_write(nrf_queue_t const * p_queue,
         return NRF_SUCCESS;
     }
 
-    CRITICAL_REGION_ENTER();
+    QUEUE_CRITICAL_REGION_ENTER(p_queue);
 
     if ((nrf_queue_available_get(p_queue) >= element_count)
      || (p_queue->mode == NRF_QUEUE_MODE_OVERFLOW))
@@ -345,7 +382,7 @@ ret_code_t nrf_queue_write(nrf_queue_t const * p_queue,
         status = NRF_ERROR_NO_MEM;
     }
 
-    CRITICAL_REGION_EXIT();
+    QUEUE_CRITICAL_REGION_EXIT();
 
     NRF_LOG_INST_DEBUG(p_queue->p_log, "Write %d elements (start address: 0x%08X), status:%d",
                                        element_count, p_data, status);
@@ -367,7 +404,7 @@ size_t nrf_queue_in(nrf_queue_t const * p_queue,
         return 0;
     }
 
-    CRITICAL_REGION_ENTER();
+    QUEUE_CRITICAL_REGION_ENTER(p_queue);
 
     if (p_queue->mode == NRF_QUEUE_MODE_OVERFLOW)
     {
@@ -381,7 +418,7 @@ size_t nrf_queue_in(nrf_queue_t const * p_queue,
 
     queue_write(p_queue, p_data, element_count);
 
-    CRITICAL_REGION_EXIT();
+    QUEUE_CRITICAL_REGION_EXIT();
 
     NRF_LOG_INST_DEBUG(p_queue->p_log, "Put in %d elements (start address: 0x%08X), requested :%d",
                                        element_count, p_data, req_element_count);
@@ -410,6 +447,7 @@ static void queue_read(nrf_queue_t const * p_queue, void * p_data, uint32_t elem
                p_read_ptr,
                element_count * p_queue->element_size);
 
+        QUEUE_INDEX_PUBLISH_BARRIER();
         p_queue->p_cb->front = ((front + element_count) <= p_queue->size)
                              ? (front + element_count)
                              : 0;
@@ -426,6 +464,7 @@ static void queue_read(nrf_queue_t const * p_queue, void * p_data, uint32_t elem
                p_queue->p_buffer,
                elements_left * p_queue->element_size);
 
+        QUEUE_INDEX_PUBLISH_BARRIER();
         p_queue->p_cb->front = elements_left;
     }
 }
@@ -444,7 +483,7 @@ ret_code_t nrf_queue_read(nrf_queue_t const * p_queue,
         return NRF_SUCCESS;
     }
 
-    CRITICAL_REGION_ENTER();
+    QUEUE_CRITICAL_REGION_ENTER(p_queue);
 
     if (element_count <= queue_utilization_get(p_queue))
     {
@@ -455,7 +494,7 @@ ret_code_t nrf_queue_read(nrf_queue_t const * p_queue,
         status = NRF_ERROR_NOT_FOUND;
     }
 
-    CRITICAL_REGION_EXIT();
+    QUEUE_CRITICAL_REGION_EXIT();
 
     NRF_LOG_INST_DEBUG(p_queue->p_log, "Read %d elements (start address: 0x%08X), status :%d",
                                        element_count, p_data, status);
@@ -476,20 +515,102 @@ size_t nrf_queue_out(nrf_queue_t const * p_queue,
         return 0;
     }
 
-    CRITICAL_REGION_ENTER();
+    QUEUE_CRITICAL_REGION_ENTER(p_queue);
 
     size_t utilization = queue_utilization_get(p_queue);
     element_count      = MIN(element_count, utilization);
 
     queue_read(p_queue, p_data, element_count);
 
-    CRITICAL_REGION_EXIT();
+    QUEUE_CRITICAL_REGION_EXIT();
 
     NRF_LOG_INST_DEBUG(p_queue->p_log, "Out %d elements (start address: 0x%08X), requested :%d",
                                        element_count, p_data, req_element_count);
     return element_count;
 }
 
+size_t nrf_queue_write_span_get(nrf_queue_t const * p_queue, void ** pp_data)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(pp_data != NULL);
+    ASSERT(p_queue->mode == NRF_QUEUE_MODE_SPSC);
+
+    size_t back  = p_queue->p_cb->back;
+    size_t front = p_queue->p_cb->front;
+    size_t element_count;
+
+    if (back >= front)
+    {
+        // Free space runs to the end of the buffer. One slot is always kept empty, so the last
+        // slot cannot be used if the front is at the start of the buffer.
+        element_count = p_queue->size + 1 - back - ((front == 0) ? 1 : 0);
+    }
+    else
+    {
+        element_count = front - back - 1;
+    }
+
+    *pp_data = (void *)((size_t)p_queue->p_buffer + back * p_queue->element_size);
+
+    return element_count;
+}
+
+void nrf_queue_write_span_commit(nrf_queue_t const * p_queue, size_t element_count)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(p_queue->mode == NRF_QUEUE_MODE_SPSC);
+
+    size_t back = p_queue->p_cb->back;
+
+    ASSERT(element_count <= p_queue->size - queue_utilization_get(p_queue));
+    ASSERT(back + element_count <= p_queue->size + 1);
+
+    back = ((back + element_count) <= p_queue->size) ? (back + element_count) : 0;
+
+    QUEUE_INDEX_PUBLISH_BARRIER();
+    p_queue->p_cb->back = back;
+
+    size_t utilization = queue_utilization_get(p_queue);
+    if (p_queue->p_cb->max_utilization < utilization)
+    {
+        p_queue->p_cb->max_utilization = utilization;
+    }
+
+    NRF_LOG_INST_DEBUG(p_queue->p_log, "Committed %d elements", element_count);
+}
+
+size_t nrf_queue_read_span_get(nrf_queue_t const * p_queue, void ** pp_data)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(pp_data != NULL);
+    ASSERT(p_queue->mode == NRF_QUEUE_MODE_SPSC);
+
+    size_t front = p_queue->p_cb->front;
+    size_t back  = p_queue->p_cb->back;
+
+    *pp_data = (void *)((size_t)p_queue->p_buffer + front * p_queue->element_size);
+
+    return (front <= back) ? (back - front) : (p_queue->size + 1 - front);
+}
+
+void nrf_queue_read_span_release(nrf_queue_t const * p_queue, size_t element_count)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(p_queue->mode == NRF_QUEUE_MODE_SPSC);
+
+    size_t front = p_queue->p_cb->front;
+
+    ASSERT(element_count <= queue_utilization_get(p_queue));
+    ASSERT(front + element_count <= p_queue->size + 1);
+
+    front = ((front + element_count) <= p_queue->size) ? (front + element_count) : 0;
+
+    QUEUE_INDEX_PUBLISH_BARRIER();
+    p_queue->p_cb->front = front;
+
+    NRF_LOG_INST_DEBUG(p_queue->p_log, "Released %d elements", element_count);
+}
+
 void nrf_queue_reset(nrf_queue_t const * p_queue)
 {
     ASSERT(p_queue != NULL);
@@ -508,11 +629,11 @@ size_t nrf_queue_utilization_get(nrf_queue_t const * p_queue)
     size_t utilization;
     ASSERT(p_queue != NULL);
 
-    CRITICAL_REGION_ENTER();
+    QUEUE_CRITICAL_REGION_ENTER(p_queue);
 
     utilization = queue_utilization_get(p_queue);
 
-    CRITICAL_REGION_EXIT();
+    QUEUE_CRITICAL_REGION_EXIT();
 
     return utilization;
 }
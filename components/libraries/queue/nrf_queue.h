@@ -78,6 +78,8 @@ typedef enum
 {
     NRF_QUEUE_MODE_OVERFLOW,        //!< If the queue is full, new element will overwrite the oldest.
     NRF_QUEUE_MODE_NO_OVERFLOW,     //!< If the queue is full, new element will not be accepted.
+    NRF_QUEUE_MODE_SPSC,            //!< Single producer and single consumer, without disabling interrupts.
+                                    //!< If the queue is full, new element will not be accepted.
 } nrf_queue_mode_t;
 
 /**@brief Instance of the queue. */
@@ -103,6 +105,11 @@ typedef struct
  *
  * @note  This macro reserves memory for the given queue instance.
  *
+ * @note  In @ref NRF_QUEUE_MODE_SPSC mode, elements must be added from one context only (for
+ *        example, one interrupt handler) and removed from one context only. The producer only
+ *        updates the back index and the consumer only updates the front index, so no critical
+ *        region is needed. @ref nrf_queue_reset must not be called while the queue is in use.
+ *
  * @param[in]   _type       Type which is stored.
  * @param[in]   _name       Name of the queue.
  * @param[in]   _size       Size of the queue.
@@ -368,6 +375,58 @@ size_t nrf_queue_out(nrf_queue_t const * p_queue,
                     void               * p_data,
                     size_t               element_count);
 
+/**@brief Function for getting the contiguous free space at the back of the queue.
+ *
+ * Elements can be written in place to the returned memory and then added to the queue with
+ * @ref nrf_queue_write_span_commit. This avoids copying and updates the back index only once.
+ * The span does not wrap around the end of the buffer, so it can be smaller than
+ * @ref nrf_queue_available_get. Call again after committing to get the part at the start of the buffer.
+ *
+ * @note Only for queues in @ref NRF_QUEUE_MODE_SPSC mode. To be called by the producer.
+ *
+ * @param[in]   p_queue             Pointer to the nrf_queue_t instance.
+ * @param[out]  pp_data             Pointer to the first free element.
+ *
+ * @return      The number of elements that can be written to @p pp_data.
+ */
+size_t nrf_queue_write_span_get(nrf_queue_t const * p_queue, void ** pp_data);
+
+/**@brief Function for adding elements written in place to the queue.
+ *
+ * @note Only for queues in @ref NRF_QUEUE_MODE_SPSC mode. To be called by the producer.
+ *
+ * @param[in]   p_queue             Pointer to the nrf_queue_t instance.
+ * @param[in]   element_count       Number of elements written. Must not be larger than the value
+ *                                  returned by @ref nrf_queue_write_span_get.
+ */
+void nrf_queue_write_span_commit(nrf_queue_t const * p_queue, size_t element_count);
+
+/**@brief Function for getting the contiguous elements at the front of the queue.
+ *
+ * Elements can be processed in place and then removed from the queue with
+ * @ref nrf_queue_read_span_release. This avoids copying and updates the front index only once.
+ * The span does not wrap around the end of the buffer, so it can be smaller than
+ * @ref nrf_queue_utilization_get.
+ *
+ * @note Only for queues in @ref NRF_QUEUE_MODE_SPSC mode. To be called by the consumer.
+ *
+ * @param[in]   p_queue             Pointer to the nrf_queue_t instance.
+ * @param[out]  pp_data             Pointer to the oldest element.
+ *
+ * @return      The number of elements available at @p pp_data.
+ */
+size_t nrf_queue_read_span_get(nrf_queue_t const * p_queue, void ** pp_data);
+
+/**@brief Function for removing elements processed in place from the queue.
+ *
+ * @note Only for queues in @ref NRF_QUEUE_MODE_SPSC mode. To be called by the consumer.
+ *
+ * @param[in]   p_queue             Pointer to the nrf_queue_t instance.
+ * @param[in]   element_count       Number of elements to remove. Must not be larger than the value
+ *                                  returned by @ref nrf_queue_read_span_get.
+ */
+void nrf_queue_read_span_release(nrf_queue_t const * p_queue, size_t element_count);
+
 /**@brief Function for checking if the queue is full.
  *
  * @param[in]   p_queue     Pointer to the queue instance.
@@ -47,24 +47,63 @@
 #include "nrf_assert.h"
 #include "app_util_platform.h"
 
-/**@brief Structure for holding a scheduled event header. */
+#if (APP_SCHEDULER_PRIORITY_LEVELS < 1) || (APP_SCHEDULER_PRIORITY_LEVELS > 8)
+#error "APP_SCHEDULER_PRIORITY_LEVELS must be between 1 and 8."
+#endif
+
+/**@brief States of a queue slot. */
+typedef enum
+{
+    EVENT_STATE_RESERVED  = 0x5A5A, /**< Slot reserved, event data is being filled in. */
+    EVENT_STATE_COMMITTED = 0xC3C3, /**< Event is ready to be executed. */
+    EVENT_STATE_SKIP      = 0x9696, /**< Unused space at the end of the buffer. Execution continues at the start. */
+} event_state_t;
+
+/**@brief Structure for holding a scheduled event header.
+ *
+ * @details Every event occupies a slot in the queue buffer that consists of this header followed
+ *          by the event data, rounded up to a whole number of words.
+ */
 typedef struct
 {
     app_sched_event_handler_t handler;          /**< Pointer to event handler to receive the event. */
     uint16_t                  event_data_size;  /**< Size of event data. */
+    volatile uint16_t         state;            /**< Slot state, see @ref event_state_t. */
+#if APP_SCHEDULER_WITH_DEADLINE
+    uint32_t                  deadline;         /**< Timestamp by which the event must be executed, or 0 if none. */
+#endif
+#if APP_SCHEDULER_WITH_PROFILER
+    uint32_t                  timestamp;        /**< Timestamp of reserving the slot. */
+#endif
 } event_header_t;
 
 STATIC_ASSERT(sizeof(event_header_t) <= APP_SCHED_EVENT_HEADER_SIZE);
 
-static event_header_t * m_queue_event_headers;  /**< Array for holding the queue event headers. */
-static uint8_t        * m_queue_event_data;     /**< Array for holding the queue event data. */
-static volatile uint8_t m_queue_start_index;    /**< Index of queue entry at the start of the queue. */
-static volatile uint8_t m_queue_end_index;      /**< Index of queue entry at the end of the queue. */
-static uint16_t         m_queue_event_size;     /**< Maximum event size in queue. */
-static uint16_t         m_queue_size;           /**< Number of queue entries. */
+/**@brief Structure for holding the queue of one priority level. */
+typedef struct
+{
+    uint8_t         * p_buf;        /**< Buffer holding the queued event slots. */
+    uint32_t          buf_size;     /**< Size of the queue buffer, in bytes. */
+    volatile uint32_t start_offset; /**< Offset of the oldest slot. Only moved by the consumer. */
+    volatile uint32_t end_offset;   /**< Offset of the next slot to reserve. Only moved by producers. */
+} sched_queue_t;
+
+static sched_queue_t m_queues[APP_SCHEDULER_PRIORITY_LEVELS];   /**< Queues, highest priority first. */
+static uint16_t      m_queue_event_size;                        /**< Maximum event size in queue. */
+
+#if APP_SCHEDULER_WITH_DEADLINE || APP_SCHEDULER_WITH_PROFILER
+static app_sched_timestamp_func_t m_timestamp_func;  /**< Function for getting the current time. */
+#endif
+
+#if APP_SCHEDULER_WEIGHTED_DISPATCH
+static uint8_t m_dispatch_credits[APP_SCHEDULER_PRIORITY_LEVELS]; /**< Events left to execute from each level in the current round. */
+#endif
 
 #if APP_SCHEDULER_WITH_PROFILER
-static uint16_t m_max_queue_utilization;    /**< Maximum observed queue utilization. */
+static uint16_t                m_max_queue_utilization;   /**< Maximum observed queue utilization. */
+static uint16_t                m_events_reserved;         /**< Number of slots reserved so far. */
+static volatile uint16_t       m_events_executed;         /**< Number of events executed so far. */
+static app_sched_prio_stats_t  m_prio_stats[APP_SCHEDULER_PRIORITY_LEVELS]; /**< Statistics of each priority level. */
 #endif
 
 #if APP_SCHEDULER_WITH_PAUSE
@@ -72,41 +111,142 @@ static uint32_t m_scheduler_paused_counter = 0; /**< Counter storing the differe
                                                      and resuming the scheduler. */
 #endif
 
-/**@brief Function for incrementing a queue index, and handle wrap-around.
+/**@brief Function for getting the size of the slot that holds an event.
  *
- * @param[in]   index   Old index.
+ * @param[in]   event_data_size   Size of event data.
  *
- * @return      New (incremented) index.
+ * @return      Slot size, in bytes.
  */
-static __INLINE uint8_t next_index(uint8_t index)
+static __INLINE uint32_t slot_size_get(uint16_t event_data_size)
 {
-    return (index < m_queue_size) ? (index + 1) : 0;
+    return sizeof(event_header_t) + ALIGN_NUM(sizeof(uint32_t), event_data_size);
 }
 
 
-static __INLINE uint8_t app_sched_queue_full()
+/**@brief Function for getting the slot header at a given offset in a queue buffer. */
+static __INLINE event_header_t * slot_header_get(sched_queue_t const * p_queue, uint32_t offset)
 {
-  uint8_t tmp = m_queue_start_index;
-  return next_index(m_queue_end_index) == tmp;
+    return (event_header_t *)&p_queue->p_buf[offset];
 }
 
-/**@brief Macro for checking if a queue is full. */
-#define APP_SCHED_QUEUE_FULL() app_sched_queue_full()
 
+/**@brief Function for getting the current timestamp. */
+static __INLINE uint32_t timestamp_get(void)
+{
+#if APP_SCHEDULER_WITH_DEADLINE || APP_SCHEDULER_WITH_PROFILER
+    return (m_timestamp_func != NULL) ? m_timestamp_func() : 0;
+#else
+    return 0;
+#endif
+}
 
-static __INLINE uint8_t app_sched_queue_empty()
+
+/**@brief Function for reserving a slot in a queue buffer.
+ *
+ * @details Must be called from a critical region. The end offset never catches up with the start
+ *          offset, otherwise a full queue would look empty. If the slot does not fit in the space
+ *          left at the end of the buffer, that space is skipped and the slot is taken from the
+ *          start of the buffer.
+ *
+ * @param[in]   p_queue     Queue to reserve the slot in.
+ * @param[in]   slot_size   Size of the slot, in bytes.
+ * @param[out]  p_offset    Offset of the reserved slot.
+ *
+ * @retval      true        If the slot was reserved.
+ * @retval      false       If there is not enough free space.
+ */
+static bool slot_reserve(sched_queue_t * p_queue, uint32_t slot_size, uint32_t * p_offset)
 {
-  uint8_t tmp = m_queue_start_index;
-  return m_queue_end_index == tmp;
+    uint32_t start = p_queue->start_offset;
+    uint32_t end   = p_queue->end_offset;
+
+    if (end >= start)
+    {
+        uint32_t tail = p_queue->buf_size - end;
+
+        if ((tail > slot_size) || ((tail == slot_size) && (start != 0)))
+        {
+            *p_offset           = end;
+            p_queue->end_offset = (tail == slot_size) ? 0 : (end + slot_size);
+            return true;
+        }
+
+        if (slot_size < start)
+        {
+            // Skip the end of the buffer. If it is too small to hold a header, the consumer
+            // skips it anyway.
+            if (tail >= sizeof(event_header_t))
+            {
+                slot_header_get(p_queue, end)->state = EVENT_STATE_SKIP;
+            }
+            *p_offset           = 0;
+            p_queue->end_offset = slot_size;
+            return true;
+        }
+    }
+    else if ((start - end) > slot_size)
+    {
+        *p_offset           = end;
+        p_queue->end_offset = end + slot_size;
+        return true;
+    }
+
+    return false;
 }
 
-/**@brief Macro for checking if a queue is empty. */
-#define APP_SCHED_QUEUE_EMPTY() app_sched_queue_empty()
+
+/**@brief Function for getting the oldest event in a queue, if it is ready to be executed.
+ *
+ * @details Skipped space at the end of the buffer is consumed on the way. Must only be called
+ *          from the consumer (main) context.
+ *
+ * @param[in]   p_queue     Queue to check.
+ *
+ * @return      Header of the oldest event, or NULL if the queue is empty or the oldest event has
+ *              not been committed yet.
+ */
+static event_header_t * queue_head_get(sched_queue_t * p_queue)
+{
+    while (p_queue->start_offset != p_queue->end_offset)
+    {
+        uint32_t         offset = p_queue->start_offset;
+        event_header_t * p_header;
+
+        if ((p_queue->buf_size - offset) < sizeof(event_header_t))
+        {
+            // Too little space left at the end of the buffer to hold a slot.
+            p_queue->start_offset = 0;
+            continue;
+        }
+
+        p_header = slot_header_get(p_queue, offset);
+
+        if (p_header->state == EVENT_STATE_SKIP)
+        {
+            p_queue->start_offset = 0;
+            continue;
+        }
+
+        // An event that is still being filled in will be executed when app_sched_execute() is
+        // called again after it has been committed.
+        return (p_header->state == EVENT_STATE_COMMITTED) ? p_header : NULL;
+    }
+
+    return NULL;
+}
 
 
 uint32_t app_sched_init(uint16_t event_size, uint16_t queue_size, void * p_event_buffer)
 {
-    uint16_t data_start_index = (queue_size + 1) * sizeof(event_header_t);
+    return app_sched_buf_init(event_size, p_event_buffer, APP_SCHED_BUF_SIZE(event_size, queue_size));
+}
+
+
+uint32_t app_sched_buf_init(uint16_t max_event_size, void * p_event_buffer, uint32_t buf_size)
+{
+    // The buffer is split evenly between the priority levels.
+    uint32_t queue_buf_size = (buf_size / APP_SCHEDULER_PRIORITY_LEVELS)
+                            & ~(sizeof(uint32_t) - 1);
 
     // Check that buffer is correctly aligned
     if (!is_word_aligned(p_event_buffer))
@@ -114,39 +254,75 @@ uint32_t app_sched_init(uint16_t event_size, uint16_t queue_size, void * p_event
         return NRF_ERROR_INVALID_PARAM;
     }
 
+    // Check that at least one event of maximum size fits in every queue.
+    if (queue_buf_size < 2 * APP_SCHED_EVENT_SLOT_SIZE(max_event_size))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
     // Initialize event scheduler
-    m_queue_event_headers = p_event_buffer;
-    m_queue_event_data    = &((uint8_t *)p_event_buffer)[data_start_index];
-    m_queue_end_index     = 0;
-    m_queue_start_index   = 0;
-    m_queue_event_size    = event_size;
-    m_queue_size          = queue_size;
+    for (uint32_t i = 0; i < APP_SCHEDULER_PRIORITY_LEVELS; i++)
+    {
+        m_queues[i].p_buf        = &((uint8_t *)p_event_buffer)[i * queue_buf_size];
+        m_queues[i].buf_size     = queue_buf_size;
+        m_queues[i].start_offset = 0;
+        m_queues[i].end_offset   = 0;
+    }
+    m_queue_event_size = max_event_size;
+
+#if APP_SCHEDULER_WEIGHTED_DISPATCH
+    memset(m_dispatch_credits, 0, sizeof(m_dispatch_credits));
+#endif
 
 #if APP_SCHEDULER_WITH_PROFILER
     m_max_queue_utilization = 0;
+    m_events_reserved       = 0;
+    m_events_executed       = 0;
+    memset(m_prio_stats, 0, sizeof(m_prio_stats));
 #endif
 
     return NRF_SUCCESS;
 }
 
 
+#if APP_SCHEDULER_WITH_DEADLINE || APP_SCHEDULER_WITH_PROFILER
+void app_sched_timestamp_func_set(app_sched_timestamp_func_t timestamp_func)
+{
+    m_timestamp_func = timestamp_func;
+}
+#endif
+
+
 uint16_t app_sched_queue_space_get()
 {
-    uint16_t start = m_queue_start_index;
-    uint16_t end   = m_queue_end_index;
-    uint16_t free_space = m_queue_size - ((end >= start) ?
-                           (end - start) : (m_queue_size + 1 - start + end));
-    return free_space;
+    sched_queue_t const * p_queue   = &m_queues[APP_SCHED_PRIORITY_DEFAULT];
+    uint32_t              start     = p_queue->start_offset;
+    uint32_t              end       = p_queue->end_offset;
+    uint32_t              slot_size = slot_size_get(m_queue_event_size);
+    uint32_t              free_space;
+
+    // Count the events of maximum size that can still be reserved. A slot must never end exactly
+    // at the start offset.
+    if (end >= start)
+    {
+        uint32_t tail = p_queue->buf_size - end;
+
+        free_space  = ((start == 0) ? (tail - 1) : tail) / slot_size;
+        free_space += (start > 0) ? ((start - 1) / slot_size) : 0;
+    }
+    else
+    {
+        free_space = (start - end - 1) / slot_size;
+    }
+
+    return (uint16_t)MIN(free_space, UINT16_MAX);
 }
 
 
 #if APP_SCHEDULER_WITH_PROFILER
 static void queue_utilization_check(void)
 {
-    uint16_t start = m_queue_start_index;
-    uint16_t end   = m_queue_end_index;
-    uint16_t queue_utilization = (end >= start) ? (end - start) :
-        (m_queue_size + 1 - start + end);
+    uint16_t queue_utilization = (uint16_t)(m_events_reserved - m_events_executed);
 
     if (queue_utilization > m_max_queue_utilization)
     {
@@ -158,68 +334,177 @@ uint16_t app_sched_queue_utilization_get(void)
 {
     return m_max_queue_utilization;
 }
+
+void app_sched_prio_stats_get(uint8_t priority, app_sched_prio_stats_t * p_stats)
+{
+    ASSERT(priority < APP_SCHEDULER_PRIORITY_LEVELS);
+    ASSERT(p_stats != NULL);
+
+    *p_stats = m_prio_stats[priority];
+}
+
+void app_sched_prio_stats_reset(void)
+{
+    memset(m_prio_stats, 0, sizeof(m_prio_stats));
+}
+
+/**@brief Function for updating the statistics of a priority level with an executed event. */
+static void prio_stats_update(uint8_t priority, event_header_t const * p_header, uint32_t now)
+{
+    app_sched_prio_stats_t * p_stats = &m_prio_stats[priority];
+    uint32_t                 latency = now - p_header->timestamp;
+
+    p_stats->executed++;
+    p_stats->latency_total += latency;
+    if (latency > p_stats->latency_max)
+    {
+        p_stats->latency_max = latency;
+    }
+
+#if APP_SCHEDULER_WITH_DEADLINE
+    if ((p_header->deadline != 0) && ((int32_t)(now - p_header->deadline) > 0))
+    {
+        p_stats->deadline_missed++;
+    }
+#endif
+}
 #endif // APP_SCHEDULER_WITH_PROFILER
 
 
-uint32_t app_sched_event_put(void const              * p_event_data,
-                             uint16_t                  event_data_size,
-                             app_sched_event_handler_t handler)
+uint32_t app_sched_event_reserve_ext(uint16_t                       event_data_size,
+                                     app_sched_event_handler_t      handler,
+                                     app_sched_event_attr_t const * p_attr,
+                                     void                        ** pp_event_data)
 {
-    uint32_t err_code;
+    uint8_t         priority = APP_SCHED_PRIORITY_DEFAULT;
+    sched_queue_t * p_queue;
+    uint32_t        offset;
+    bool            reserved;
 
-    if (event_data_size <= m_queue_event_size)
+    if (pp_event_data == NULL)
     {
-        uint16_t event_index = 0xFFFF;
+        return NRF_ERROR_NULL;
+    }
 
-        CRITICAL_REGION_ENTER();
+    if (event_data_size > m_queue_event_size)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
 
-        if (!APP_SCHED_QUEUE_FULL())
+    if (p_attr != NULL)
+    {
+        if (p_attr->priority >= APP_SCHEDULER_PRIORITY_LEVELS)
         {
-            event_index       = m_queue_end_index;
-            m_queue_end_index = next_index(m_queue_end_index);
-
-        #if APP_SCHEDULER_WITH_PROFILER
-            // This function call must be protected with critical region because
-            // it modifies 'm_max_queue_utilization'.
-            queue_utilization_check();
-        #endif
+            return NRF_ERROR_INVALID_PARAM;
         }
+        priority = p_attr->priority;
+    }
+    p_queue = &m_queues[priority];
 
-        CRITICAL_REGION_EXIT();
+    CRITICAL_REGION_ENTER();
 
-        if (event_index != 0xFFFF)
+    reserved = slot_reserve(p_queue, slot_size_get(event_data_size), &offset);
+    if (reserved)
+    {
+        // The header must be valid before leaving the critical region, so that the consumer
+        // stops at this slot until it is committed.
+        event_header_t * p_header = slot_header_get(p_queue, offset);
+
+        p_header->state           = EVENT_STATE_RESERVED;
+        p_header->handler         = handler;
+        p_header->event_data_size = event_data_size;
+
+    #if APP_SCHEDULER_WITH_DEADLINE
+        p_header->deadline = 0;
+        if ((p_attr != NULL) && (p_attr->deadline != 0))
         {
-            // NOTE: This can be done outside the critical region since the event consumer will
-            //       always be called from the main loop, and will thus never interrupt this code.
-            m_queue_event_headers[event_index].handler = handler;
-            if ((p_event_data != NULL) && (event_data_size > 0))
+            // 0 means no deadline, so a deadline that happens to fall on 0 is moved by one tick.
+            p_header->deadline = timestamp_get() + p_attr->deadline;
+            if (p_header->deadline == 0)
             {
-                memcpy(&m_queue_event_data[event_index * m_queue_event_size],
-                       p_event_data,
-                       event_data_size);
-                m_queue_event_headers[event_index].event_data_size = event_data_size;
+                p_header->deadline = 1;
             }
-            else
-            {
-                m_queue_event_headers[event_index].event_data_size = 0;
-            }
-
-            err_code = NRF_SUCCESS;
-        }
-        else
-        {
-            err_code = NRF_ERROR_NO_MEM;
         }
+    #endif
+
+    #if APP_SCHEDULER_WITH_PROFILER
+        p_header->timestamp = timestamp_get();
+
+        // This function call must be protected with critical region because
+        // it modifies 'm_max_queue_utilization'.
+        m_events_reserved++;
+        queue_utilization_check();
+    #endif
     }
-    else
+
+    CRITICAL_REGION_EXIT();
+
+    if (!reserved)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    *pp_event_data = &p_queue->p_buf[offset + sizeof(event_header_t)];
+    return NRF_SUCCESS;
+}
+
+
+uint32_t app_sched_event_reserve(uint16_t                  event_data_size,
+                                 app_sched_event_handler_t handler,
+                                 void                   ** pp_event_data)
+{
+    return app_sched_event_reserve_ext(event_data_size, handler, NULL, pp_event_data);
+}
+
+
+void app_sched_event_commit(void * p_event_data)
+{
+    event_header_t * p_header =
+        (event_header_t *)((uint8_t *)p_event_data - sizeof(event_header_t));
+
+    ASSERT(p_header->state == EVENT_STATE_RESERVED);
+
+    // Event data must be in place before the consumer sees the slot as committed.
+    __DMB();
+    p_header->state = EVENT_STATE_COMMITTED;
+}
+
+
+uint32_t app_sched_event_put_ext(void const                   * p_event_data,
+                                 uint16_t                       event_data_size,
+                                 app_sched_event_handler_t      handler,
+                                 app_sched_event_attr_t const * p_attr)
+{
+    uint32_t err_code;
+    void   * p_slot_data;
+
+    if ((p_event_data == NULL) || (event_data_size == 0))
+    {
+        event_data_size = 0;
+    }
+
+    err_code = app_sched_event_reserve_ext(event_data_size, handler, p_attr, &p_slot_data);
+    if (err_code == NRF_SUCCESS)
     {
-        err_code = NRF_ERROR_INVALID_LENGTH;
+        if (event_data_size > 0)
+        {
+            memcpy(p_slot_data, p_event_data, event_data_size);
+        }
+        app_sched_event_commit(p_slot_data);
     }
 
     return err_code;
 }
 
 
+uint32_t app_sched_event_put(void const              * p_event_data,
+                             uint16_t                  event_data_size,
+                             app_sched_event_handler_t handler)
+{
+    return app_sched_event_put_ext(p_event_data, event_data_size, handler, NULL);
+}
+
+
 #if APP_SCHEDULER_WITH_PAUSE
 void app_sched_pause(void)
 {
@@ -260,29 +545,130 @@ static __INLINE bool is_app_sched_paused(void)
 }
 
 
+/**@brief Function for selecting the priority level to execute the next event from.
+ *
+ * @details An event whose deadline has passed is executed first, regardless of its priority. If
+ *          several deadlines have passed, the most overdue event goes first. Otherwise, the
+ *          highest priority level with a ready event is selected. With weighted dispatch, each
+ *          level may only execute a limited number of events in a row while lower levels have
+ *          events waiting: 1 for the lowest level, doubled for each level above it.
+ *
+ * @param[out]  pp_header   Header of the event to execute.
+ * @param[in]   now         Current timestamp.
+ *
+ * @return      Selected priority level, or APP_SCHEDULER_PRIORITY_LEVELS if no event is ready.
+ */
+static uint8_t next_priority_get(event_header_t ** pp_header, uint32_t now)
+{
+    event_header_t * p_heads[APP_SCHEDULER_PRIORITY_LEVELS];
+    uint8_t          priority;
+
+    for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+    {
+        p_heads[priority] = queue_head_get(&m_queues[priority]);
+    }
+
+#if APP_SCHEDULER_WITH_DEADLINE
+    uint8_t overdue_priority = APP_SCHEDULER_PRIORITY_LEVELS;
+    int32_t overdue_max      = -1;
+
+    for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+    {
+        if ((p_heads[priority] != NULL) && (p_heads[priority]->deadline != 0))
+        {
+            int32_t overdue = (int32_t)(now - p_heads[priority]->deadline);
+            if (overdue > overdue_max)
+            {
+                overdue_max      = overdue;
+                overdue_priority = priority;
+            }
+        }
+    }
+
+    if (overdue_priority < APP_SCHEDULER_PRIORITY_LEVELS)
+    {
+    #if APP_SCHEDULER_WEIGHTED_DISPATCH
+        if (m_dispatch_credits[overdue_priority] > 0)
+        {
+            m_dispatch_credits[overdue_priority]--;
+        }
+    #endif
+        *pp_header = p_heads[overdue_priority];
+        return overdue_priority;
+    }
+#else
+    UNUSED_PARAMETER(now);
+#endif
+
+#if APP_SCHEDULER_WEIGHTED_DISPATCH
+    for (uint32_t round = 0; round < 2; round++)
+    {
+        for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+        {
+            if ((p_heads[priority] != NULL) && (m_dispatch_credits[priority] > 0))
+            {
+                m_dispatch_credits[priority]--;
+                *pp_header = p_heads[priority];
+                return priority;
+            }
+        }
+
+        // Every level with ready events has used up its share. Start a new round.
+        for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+        {
+            m_dispatch_credits[priority] = (uint8_t)(1u << ((APP_SCHEDULER_PRIORITY_LEVELS - 1) - priority));
+        }
+    }
+#else
+    for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+    {
+        if (p_heads[priority] != NULL)
+        {
+            *pp_header = p_heads[priority];
+            return priority;
+        }
+    }
+#endif
+
+    return APP_SCHEDULER_PRIORITY_LEVELS;
+}
+
+
 void app_sched_execute(void)
 {
-    while (!is_app_sched_paused() && !APP_SCHED_QUEUE_EMPTY())
+    while (!is_app_sched_paused())
     {
         // Since this function is only called from the main loop, there is no
         // need for a critical region here, however a special care must be taken
-        // regarding update of the queue start index (see the end of the loop).
-        uint16_t event_index = m_queue_start_index;
+        // regarding update of the queue start offset (see the end of the loop).
+        event_header_t * p_header;
+        uint32_t         now      = timestamp_get();
+        uint8_t          priority = next_priority_get(&p_header, now);
+
+        if (priority == APP_SCHEDULER_PRIORITY_LEVELS)
+        {
+            break;
+        }
 
-        void * p_event_data;
-        uint16_t event_data_size;
-        app_sched_event_handler_t event_handler;
+        sched_queue_t * p_queue = &m_queues[priority];
+        uint32_t        offset  = p_queue->start_offset;
 
-        p_event_data = &m_queue_event_data[event_index * m_queue_event_size];
-        event_data_size = m_queue_event_headers[event_index].event_data_size;
-        event_handler   = m_queue_event_headers[event_index].handler;
+    #if APP_SCHEDULER_WITH_PROFILER
+        prio_stats_update(priority, p_header, now);
+    #endif
 
-        event_handler(p_event_data, event_data_size);
+        p_header->handler(&p_queue->p_buf[offset + sizeof(event_header_t)],
+                          p_header->event_data_size);
 
-        // Event processed, now it is safe to move the queue start index,
-        // so the queue entry occupied by this event can be used to store
+        // Event processed, now it is safe to move the queue start offset,
+        // so the space occupied by this event can be used to store
         // a next one.
-        m_queue_start_index = next_index(m_queue_start_index);
+        offset += slot_size_get(p_header->event_data_size);
+        p_queue->start_offset = (offset < p_queue->buf_size) ? offset : 0;
+
+    #if APP_SCHEDULER_WITH_PROFILER
+        m_events_executed++;
+    #endif
     }
 }
 #endif //NRF_MODULE_ENABLED(APP_SCHEDULER)
@@ -65,6 +65,14 @@
  *     with the appropriate data and event handler. This will insert an event into the
  *     scheduler's queue. The app_sched_execute() function will pull this event and call its
  *     handler in the main context.
+ *   - Alternatively, call app_sched_event_reserve() to get space for an event of the exact size,
+ *     fill in the event data in place, and call app_sched_event_commit(). This avoids copying
+ *     the event data.
+ *
+ * Events are stored in a ring buffer, and every event only takes up the space of its own data
+ * plus a header. A buffer sized with @ref APP_SCHED_BUF_SIZE holds at least QUEUE_SIZE events
+ * of maximum size, and more if events are smaller. Use @ref APP_SCHED_INIT_BUF to size the buffer
+ * in bytes instead, for example when most events are much smaller than the largest one.
  *
  * @if (PERIPHERAL)
  * For an example usage of the scheduler, see the implementations of
@@ -86,9 +94,43 @@
 extern "C" {
 #endif
 
-#define APP_SCHED_EVENT_HEADER_SIZE 8       /**< Size of app_scheduler.event_header_t (only for use inside APP_SCHED_BUF_SIZE()). */
+#ifndef APP_SCHEDULER_PRIORITY_LEVELS
+#define APP_SCHEDULER_PRIORITY_LEVELS 1
+#endif
+
+#ifndef APP_SCHEDULER_WEIGHTED_DISPATCH
+#define APP_SCHEDULER_WEIGHTED_DISPATCH 0
+#endif
+
+#ifndef APP_SCHEDULER_WITH_DEADLINE
+#define APP_SCHEDULER_WITH_DEADLINE 0
+#endif
+
+#ifndef APP_SCHEDULER_WITH_PROFILER
+#define APP_SCHEDULER_WITH_PROFILER 0
+#endif
+
+#define APP_SCHED_EVENT_HEADER_SIZE ALIGN_NUM(sizeof(void *),                                       \
+                                              sizeof(void *) + 4                                   \
+                                              + (APP_SCHEDULER_WITH_DEADLINE ? 4 : 0)              \
+                                              + (APP_SCHEDULER_WITH_PROFILER ? 4 : 0)) /**< Size of app_scheduler.event_header_t (only for use inside APP_SCHED_BUF_SIZE()). */
+
+#define APP_SCHED_PRIORITY_HIGHEST  0                                   /**< Highest event priority. */
+#define APP_SCHED_PRIORITY_LOWEST   (APP_SCHEDULER_PRIORITY_LEVELS - 1) /**< Lowest event priority. */
+#define APP_SCHED_PRIORITY_DEFAULT  APP_SCHED_PRIORITY_HIGHEST          /**< Priority of events scheduled without attributes. */
+
+/**@brief Compute number of bytes taken up by one event in the scheduler buffer.
+ *
+ * @param[in] EVENT_SIZE   Size of the event data.
+ *
+ * @return    Size of the event in the scheduler buffer (in bytes).
+ */
+#define APP_SCHED_EVENT_SLOT_SIZE(EVENT_SIZE)                                                      \
+            (ALIGN_NUM(sizeof(uint32_t), (EVENT_SIZE)) + APP_SCHED_EVENT_HEADER_SIZE)
 
 /**@brief Compute number of bytes required to hold the scheduler buffer.
+ *
+ * @details With several priority levels, every level gets a queue of this size.
  *
  * @param[in] EVENT_SIZE   Maximum size of events to be passed through the scheduler.
  * @param[in] QUEUE_SIZE   Number of entries in scheduler queue (i.e. the maximum number of events
@@ -97,11 +139,40 @@ extern "C" {
  * @return    Required scheduler buffer size (in bytes).
  */
 #define APP_SCHED_BUF_SIZE(EVENT_SIZE, QUEUE_SIZE)                                                 \
-            (((EVENT_SIZE) + APP_SCHED_EVENT_HEADER_SIZE) * ((QUEUE_SIZE) + 1))
+            (APP_SCHED_EVENT_SLOT_SIZE(EVENT_SIZE) * ((QUEUE_SIZE) + 1)                            \
+             * APP_SCHEDULER_PRIORITY_LEVELS)
 
 /**@brief Scheduler event handler type. */
 typedef void (*app_sched_event_handler_t)(void * p_event_data, uint16_t event_size);
 
+/**@brief Function for getting the current time, used for deadlines and latency statistics.
+ *
+ * @details Any free-running counter can be used, for example @ref app_timer_cnt_get.
+ *          Wrap-around of the 32-bit value is handled.
+ */
+typedef uint32_t (*app_sched_timestamp_func_t)(void);
+
+/**@brief Scheduling attributes of an event. */
+typedef struct
+{
+    uint8_t  priority;  /**< Priority level, from @ref APP_SCHED_PRIORITY_HIGHEST to @ref APP_SCHED_PRIORITY_LOWEST. */
+    uint32_t deadline;  /**< Time (in timestamp ticks, from scheduling) after which the event is executed ahead of
+                             events of higher priority. 0 for no deadline. Requires @ref APP_SCHEDULER_WITH_DEADLINE. */
+} app_sched_event_attr_t;
+
+/**@brief Statistics of one priority level.
+ *
+ * @details Latency is the time from scheduling an event to the start of its handler, in
+ *          timestamp ticks.
+ */
+typedef struct
+{
+    uint32_t executed;          /**< Number of events executed. */
+    uint32_t latency_max;       /**< Longest latency. */
+    uint64_t latency_total;     /**< Sum of the latencies of all executed events. */
+    uint32_t deadline_missed;   /**< Number of events executed after their deadline. */
+} app_sched_prio_stats_t;
+
 /**@brief Macro for initializing the event scheduler.
  *
  * @details It will also handle dimensioning and allocation of the memory buffer required by the
@@ -123,6 +194,27 @@ typedef void (*app_sched_event_handler_t)(void * p_event_data, uint16_t event_si
         APP_ERROR_CHECK(ERR_CODE);                                                                 \
     } while (0)
 
+/**@brief Macro for initializing the event scheduler with a buffer of a given size.
+ *
+ * @details It will also handle allocation of the memory buffer required by the scheduler, making
+ *          sure the buffer is correctly aligned.
+ *
+ * @param[in] EVENT_SIZE   Maximum size of events to be passed through the scheduler.
+ * @param[in] BUF_SIZE     Size of the scheduler buffer (in bytes), at least
+ *                         APP_SCHED_BUF_SIZE(EVENT_SIZE, 1). Every queued event takes up
+ *                         APP_SCHED_EVENT_SLOT_SIZE() of its own size.
+ *
+ * @note Since this macro allocates a buffer, it must only be called once (it is OK to call it
+ *       several times as long as it is from the same location, e.g. to do a reinitialization).
+ */
+#define APP_SCHED_INIT_BUF(EVENT_SIZE, BUF_SIZE)                                                   \
+    do                                                                                             \
+    {                                                                                              \
+        static uint32_t APP_SCHED_BUF[CEIL_DIV((BUF_SIZE), sizeof(uint32_t))];                     \
+        uint32_t ERR_CODE = app_sched_buf_init((EVENT_SIZE), APP_SCHED_BUF, sizeof(APP_SCHED_BUF));\
+        APP_ERROR_CHECK(ERR_CODE);                                                                 \
+    } while (0)
+
 /**@brief Function for initializing the Scheduler.
  *
  * @details It must be called before entering the main loop.
@@ -143,10 +235,47 @@ typedef void (*app_sched_event_handler_t)(void * p_event_data, uint16_t event_si
  */
 uint32_t app_sched_init(uint16_t max_event_size, uint16_t queue_size, void * p_evt_buffer);
 
+/**@brief Function for initializing the Scheduler with a buffer of a given size.
+ *
+ * @details It must be called before entering the main loop.
+ *
+ * @param[in]   max_event_size   Maximum size of events to be passed through the scheduler.
+ * @param[in]   p_evt_buffer     Pointer to memory buffer for holding the scheduler queue. The
+ *                               buffer must be aligned to a 4 byte boundary.
+ * @param[in]   buf_size         Size of the buffer (in bytes).
+ *
+ * @note Normally initialization should be done using the APP_SCHED_INIT_BUF() macro, as that will
+ *       both allocate the scheduler buffer, and also align the buffer correctly.
+ *
+ * @retval      NRF_SUCCESS               Successful initialization.
+ * @retval      NRF_ERROR_INVALID_PARAM   Invalid parameter (buffer not aligned to a 4 byte
+ *                                        boundary).
+ * @retval      NRF_ERROR_INVALID_LENGTH  Buffer size is not a multiple of 4 or is too small to
+ *                                        hold one event of maximum size.
+ */
+uint32_t app_sched_buf_init(uint16_t max_event_size, void * p_evt_buffer, uint32_t buf_size);
+
+/**@brief Function for setting the timestamp source.
+ *
+ * @details Deadlines are ignored and latencies are not measured until this function is called.
+ *
+ * @note @ref APP_SCHEDULER_WITH_DEADLINE or @ref APP_SCHEDULER_WITH_PROFILER must be enabled to use
+ *       this functionality.
+ *
+ * @param[in]   timestamp_func   Function for getting the current time.
+ */
+void app_sched_timestamp_func_set(app_sched_timestamp_func_t timestamp_func);
+
 /**@brief Function for executing all scheduled events.
  *
  * @details This function must be called from within the main loop. It will execute all events
  *          scheduled since the last time it was called.
+ *
+ *          With several priority levels (@ref APP_SCHEDULER_PRIORITY_LEVELS), events of a higher
+ *          priority are executed first. Events of the same priority are executed in the order in
+ *          which they were scheduled. With @ref APP_SCHEDULER_WEIGHTED_DISPATCH, lower levels
+ *          get a share of the execution time even while higher levels are busy. An event whose
+ *          deadline has passed is executed before all other events.
  */
 void app_sched_execute(void);
 
@@ -164,6 +293,72 @@ uint32_t app_sched_event_put(void const *              p_event_data,
                              uint16_t                  event_size,
                              app_sched_event_handler_t handler);
 
+/**@brief Function for scheduling an event with given attributes.
+ *
+ * @param[in]   p_event_data   Pointer to event data to be scheduled.
+ * @param[in]   event_size     Size of event data to be scheduled.
+ * @param[in]   handler        Event handler to receive the event.
+ * @param[in]   p_attr         Scheduling attributes, or NULL for the default priority and no
+ *                             deadline.
+ *
+ * @retval      NRF_SUCCESS               Event was scheduled.
+ * @retval      NRF_ERROR_INVALID_PARAM   Invalid priority.
+ * @retval      NRF_ERROR_INVALID_LENGTH  @p event_size is larger than the maximum event size.
+ * @retval      NRF_ERROR_NO_MEM          Not enough free space in the queue of the priority.
+ */
+uint32_t app_sched_event_put_ext(void const                   * p_event_data,
+                                 uint16_t                       event_size,
+                                 app_sched_event_handler_t      handler,
+                                 app_sched_event_attr_t const * p_attr);
+
+/**@brief Function for reserving space for an event in the queue.
+ *
+ * @details The event data is filled in directly in the queue, and then the event is passed to
+ *          the scheduler with @ref app_sched_event_commit. Only the space needed for
+ *          @p event_size is taken up. Events are executed in the order in which they were
+ *          reserved. An event that is reserved but not committed holds back the execution of all
+ *          events reserved after it, so it must be committed as soon as possible.
+ *
+ * @param[in]   event_size     Size of event data to be scheduled.
+ * @param[in]   handler        Event handler to receive the event.
+ * @param[out]  pp_event_data  Pointer to the word-aligned space for event data.
+ *
+ * @retval      NRF_SUCCESS               Space was reserved.
+ * @retval      NRF_ERROR_NULL            @p pp_event_data was NULL.
+ * @retval      NRF_ERROR_INVALID_LENGTH  @p event_size is larger than the maximum event size.
+ * @retval      NRF_ERROR_NO_MEM          Not enough free space in the queue.
+ */
+uint32_t app_sched_event_reserve(uint16_t                  event_size,
+                                 app_sched_event_handler_t handler,
+                                 void                   ** pp_event_data);
+
+/**@brief Function for reserving space for an event with given attributes.
+ *
+ * @details See @ref app_sched_event_reserve. The deadline starts counting at this call.
+ *
+ * @param[in]   event_size     Size of event data to be scheduled.
+ * @param[in]   handler        Event handler to receive the event.
+ * @param[in]   p_attr         Scheduling attributes, or NULL for the default priority and no
+ *                             deadline.
+ * @param[out]  pp_event_data  Pointer to the word-aligned space for event data.
+ *
+ * @retval      NRF_SUCCESS               Space was reserved.
+ * @retval      NRF_ERROR_NULL            @p pp_event_data was NULL.
+ * @retval      NRF_ERROR_INVALID_PARAM   Invalid priority.
+ * @retval      NRF_ERROR_INVALID_LENGTH  @p event_size is larger than the maximum event size.
+ * @retval      NRF_ERROR_NO_MEM          Not enough free space in the queue of the priority.
+ */
+uint32_t app_sched_event_reserve_ext(uint16_t                       event_size,
+                                     app_sched_event_handler_t      handler,
+                                     app_sched_event_attr_t const * p_attr,
+                                     void                        ** pp_event_data);
+
+/**@brief Function for scheduling an event reserved with @ref app_sched_event_reserve.
+ *
+ * @param[in]   p_event_data   Pointer returned by @ref app_sched_event_reserve.
+ */
+void app_sched_event_commit(void * p_event_data);
+
 /**@brief Function for getting the maximum observed queue utilization.
  *
  * Function for tuning the module and determining QUEUE_SIZE value and thus module RAM usage.
@@ -174,12 +369,28 @@ uint32_t app_sched_event_put(void const *              p_event_data,
  */
 uint16_t app_sched_queue_utilization_get(void);
 
+/**@brief Function for getting the statistics of a priority level.
+ *
+ * @note @ref APP_SCHEDULER_WITH_PROFILER must be enabled to use this functionality. Latencies are
+ *       only measured after @ref app_sched_timestamp_func_set has been called.
+ *
+ * @param[in]   priority   Priority level.
+ * @param[out]  p_stats    Statistics of the priority level.
+ */
+void app_sched_prio_stats_get(uint8_t priority, app_sched_prio_stats_t * p_stats);
+
+/**@brief Function for resetting the statistics of all priority levels.
+ *
+ * @note @ref APP_SCHEDULER_WITH_PROFILER must be enabled to use this functionality.
+ */
+void app_sched_prio_stats_reset(void);
+
 /**@brief Function for getting the current amount of free space in the queue.
  *
  * @details The real amount of free space may be less if entries are being added from an interrupt.
  *          To get the sxact value, this function should be called from the critical section.
  *
- * @return Amount of free space in the queue.
+ * @return Number of events of maximum size that still fit in the queue of the default priority.
  */
 uint16_t app_sched_queue_space_get(void);
 
@@ -66,6 +66,46 @@ static const uint32_t k[64] = {
 };
 
 
+#ifndef SHA256_UNROLL_FULL
+#define SHA256_UNROLL_FULL 0 /**< Unroll all 64 rounds instead of 8 at a time. Faster, but about 4 times larger. */
+#endif
+
+/* The message schedule is kept as a rolling window of 16 words. Word i of the schedule replaces
+ * word i - 16 in place once it has been used.
+ */
+#define W(i)     (m[(i) & 15])
+#define SCHED(i) (W(i) += SIG1(W((i) - 2)) + W((i) - 7) + SIG0(W((i) - 15)))
+
+/* One round, without moving the working variables around. Instead, the caller rotates the
+ * argument order: the variable passed as 'd' becomes the new 'e' and 'h' becomes the new 'a'.
+ */
+#define ROUND(a,b,c,d,e,f,g,h,i,w)                              \
+    do {                                                        \
+        uint32_t t1 = (h) + EP1(e) + CH(e,f,g) + k[i] + (w);    \
+        (d) += t1;                                              \
+        (h)  = t1 + EP0(a) + MAJ(a,b,c);                        \
+    } while (0)
+
+#define ROUNDS8(i, WORD)                                        \
+    do {                                                        \
+        ROUND(a,b,c,d,e,f,g,h,(i) + 0, WORD((i) + 0));          \
+        ROUND(h,a,b,c,d,e,f,g,(i) + 1, WORD((i) + 1));          \
+        ROUND(g,h,a,b,c,d,e,f,(i) + 2, WORD((i) + 2));          \
+        ROUND(f,g,h,a,b,c,d,e,(i) + 3, WORD((i) + 3));          \
+        ROUND(e,f,g,h,a,b,c,d,(i) + 4, WORD((i) + 4));          \
+        ROUND(d,e,f,g,h,a,b,c,(i) + 5, WORD((i) + 5));          \
+        ROUND(c,d,e,f,g,h,a,b,(i) + 6, WORD((i) + 6));          \
+        ROUND(b,c,d,e,f,g,h,a,(i) + 7, WORD((i) + 7));          \
+    } while (0)
+
+
+/**@brief Function for loading a big-endian 32-bit word. */
+__STATIC_INLINE uint32_t be32_load(const uint8_t * p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+
 /**@brief Function for calculating the hash of a 64-byte section of data.
  *
  * @param[in,out] ctx   Hash instance.
@@ -73,12 +113,22 @@ static const uint32_t k[64] = {
  */
 void sha256_transform(sha256_context_t *ctx, const uint8_t * data)
 {
-    uint32_t a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
+    uint32_t a, b, c, d, e, f, g, h, i, m[16];
 
-    for (i = 0, j = 0; i < 16; ++i, j += 4)
-        m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
-    for ( ; i < 64; ++i)
-        m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+#ifdef __CORTEX_M
+    // Word-aligned input (for example, an image in flash) is loaded a word at a time.
+    if (((uintptr_t)data & 0x3) == 0)
+    {
+        const uint32_t * p_words = (const uint32_t *)data;
+        for (i = 0; i < 16; ++i)
+            m[i] = __REV(p_words[i]);
+    }
+    else
+#endif
+    {
+        for (i = 0; i < 16; ++i)
+            m[i] = be32_load(&data[i * 4]);
+    }
 
     a = ctx->state[0];
     b = ctx->state[1];
@@ -89,18 +139,21 @@ void sha256_transform(sha256_context_t *ctx, const uint8_t * data)
     g = ctx->state[6];
     h = ctx->state[7];
 
-    for (i = 0; i < 64; ++i) {
-        t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-        t2 = EP0(a) + MAJ(a,b,c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + t1;
-        d = c;
-        c = b;
-        b = a;
-        a = t1 + t2;
-    }
+#if SHA256_UNROLL_FULL
+    ROUNDS8(0,  W);
+    ROUNDS8(8,  W);
+    ROUNDS8(16, SCHED);
+    ROUNDS8(24, SCHED);
+    ROUNDS8(32, SCHED);
+    ROUNDS8(40, SCHED);
+    ROUNDS8(48, SCHED);
+    ROUNDS8(56, SCHED);
+#else
+    for (i = 0; i < 16; i += 8)
+        ROUNDS8(i, W);
+    for ( ; i < 64; i += 8)
+        ROUNDS8(i, SCHED);
+#endif
 
     ctx->state[0] += a;
     ctx->state[1] += b;
@@ -140,16 +193,39 @@ ret_code_t sha256_update(sha256_context_t *ctx, const uint8_t * data, size_t len
         return NRF_ERROR_NULL;
     }
 
-    uint32_t i;
+    // Top up a partially filled block first.
+    if (ctx->datalen > 0)
+    {
+        size_t chunk = MIN(len, 64 - ctx->datalen);
+
+        memcpy(&ctx->data[ctx->datalen], data, chunk);
+        ctx->datalen += chunk;
+        data         += chunk;
+        len          -= chunk;
 
-    for (i = 0; i < len; ++i) {
-        ctx->data[ctx->datalen] = data[i];
-        ctx->datalen++;
-        if (ctx->datalen == 64) {
-            sha256_transform(ctx, ctx->data);
-            ctx->bitlen += 512;
-            ctx->datalen = 0;
+        if (ctx->datalen < 64)
+        {
+            return NRF_SUCCESS;
         }
+
+        sha256_transform(ctx, ctx->data);
+        ctx->bitlen += 512;
+        ctx->datalen = 0;
+    }
+
+    // Hash whole blocks directly from the input, without copying them into the context.
+    while (len >= 64)
+    {
+        sha256_transform(ctx, data);
+        ctx->bitlen += 512;
+        data        += 64;
+        len         -= 64;
+    }
+
+    if (len > 0)
+    {
+        memcpy(ctx->data, data, len);
+        ctx->datalen = len;
     }
 
     return NRF_SUCCESS;
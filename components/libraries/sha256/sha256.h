@@ -92,6 +92,9 @@ ret_code_t sha256_init(sha256_context_t *ctx);
  * @details This function can be called multiple times in sequence. This is equivalent to calling
  *          the function once on a concatenation of the data from the different calls.
  *
+ *          Whole 64-byte blocks are hashed directly from @p data, so large memory-mapped regions
+ *          such as an image in flash are not copied. Word-aligned data is read fastest.
+ *
  * @param[in,out] ctx   Hash instance.
  * @param[in]     data  Data to be hashed.
  * @param[in]     len   Length of the data to be hashed.
@@ -53,6 +53,220 @@
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
 
+#if NRF_SORTLIST_CONFIG_PAIRING_HEAP
+/**
+ * @brief Function for linking two heaps.
+ *
+ * Root which is lower becomes the first child of the other root. Sibling pointers of the returned
+ * root are not modified.
+ */
+static nrf_sortlist_item_t * heap_link(nrf_sortlist_t const * p_list,
+                                       nrf_sortlist_item_t *  p_item0,
+                                       nrf_sortlist_item_t *  p_item1)
+{
+    nrf_sortlist_item_t * p_root;
+    nrf_sortlist_item_t * p_child;
+
+    if (p_list->compare_func(p_item0, p_item1))
+    {
+        p_root  = p_item0;
+        p_child = p_item1;
+    }
+    else
+    {
+        p_root  = p_item1;
+        p_child = p_item0;
+    }
+
+    p_child->p_next = p_root->p_child;
+    p_child->p_prev = p_root;
+    if (p_root->p_child != NULL)
+    {
+        p_root->p_child->p_prev = p_child;
+    }
+    p_root->p_child = p_child;
+
+    return p_root;
+}
+
+/**
+ * @brief Function for merging list of siblings into one heap (two-pass pairing).
+ *
+ * @param p_first First sibling.
+ *
+ * @return Root of the merged heap.
+ */
+static nrf_sortlist_item_t * heap_merge_pairs(nrf_sortlist_t const * p_list,
+                                              nrf_sortlist_item_t *  p_first)
+{
+    nrf_sortlist_item_t * p_pairs = NULL;
+    nrf_sortlist_item_t * p_root;
+
+    /* First pass: link pairs from left to right. Results are chained in reverse order. */
+    while (p_first != NULL)
+    {
+        nrf_sortlist_item_t * p_item0 = p_first;
+        nrf_sortlist_item_t * p_item1 = p_first->p_next;
+
+        if (p_item1 == NULL)
+        {
+            p_first = NULL;
+        }
+        else
+        {
+            p_first = p_item1->p_next;
+            p_item0 = heap_link(p_list, p_item0, p_item1);
+        }
+        p_item0->p_next = p_pairs;
+        p_pairs = p_item0;
+    }
+
+    /* Second pass: link pairs from right to left into one heap. */
+    p_root  = p_pairs;
+    p_pairs = p_pairs->p_next;
+    while (p_pairs != NULL)
+    {
+        nrf_sortlist_item_t * p_next = p_pairs->p_next;
+        p_root = heap_link(p_list, p_root, p_pairs);
+        p_pairs = p_next;
+    }
+
+    p_root->p_next = NULL;
+    p_root->p_prev = NULL;
+    return p_root;
+}
+
+/**
+ * @brief Function for removing the root of the heap.
+ *
+ * @return New root.
+ */
+static nrf_sortlist_item_t * heap_root_remove(nrf_sortlist_t const * p_list,
+                                              nrf_sortlist_item_t *  p_root)
+{
+    nrf_sortlist_item_t * p_child = p_root->p_child;
+
+    p_root->p_child = NULL;
+    p_root->p_prev  = NULL;
+    p_root->p_next  = NULL;
+
+    return (p_child != NULL) ? heap_merge_pairs(p_list, p_child) : NULL;
+}
+
+void nrf_sortlist_add(nrf_sortlist_t const * p_list, nrf_sortlist_item_t * p_item)
+{
+    ASSERT(p_list);
+    ASSERT(p_item);
+
+    nrf_sortlist_item_t * p_head = p_list->p_cb->p_head;
+
+    p_item->p_next  = NULL;
+    p_item->p_prev  = NULL;
+    p_item->p_child = NULL;
+
+    p_list->p_cb->p_head = (p_head != NULL) ? heap_link(p_list, p_head, p_item) : p_item;
+
+    NRF_LOG_INFO("List:%s, adding element:%08X, head:%08X",
+                                  p_list->p_name, p_item, p_list->p_cb->p_head);
+}
+
+nrf_sortlist_item_t * nrf_sortlist_pop(nrf_sortlist_t const * p_list)
+{
+    ASSERT(p_list);
+    nrf_sortlist_item_t * ret = p_list->p_cb->p_head;
+    if (ret != NULL)
+    {
+        p_list->p_cb->p_head = heap_root_remove(p_list, ret);
+    }
+    NRF_LOG_INFO("List:%s, poping element:%08X", p_list->p_name, ret);
+    return ret;
+}
+
+nrf_sortlist_item_t const * nrf_sortlist_peek(nrf_sortlist_t const * p_list)
+{
+    ASSERT(p_list);
+    return p_list->p_cb->p_head;
+}
+
+nrf_sortlist_item_t const * nrf_sortlist_next(nrf_sortlist_item_t const * p_item)
+{
+    ASSERT(p_item);
+
+    /* Pre-order traversal: children first, then siblings of the item and of its ancestors. */
+    if (p_item->p_child != NULL)
+    {
+        return p_item->p_child;
+    }
+
+    return nrf_sortlist_next_skip(p_item);
+}
+
+nrf_sortlist_item_t const * nrf_sortlist_next_skip(nrf_sortlist_item_t const * p_item)
+{
+    ASSERT(p_item);
+
+    while (p_item != NULL)
+    {
+        if (p_item->p_next != NULL)
+        {
+            return p_item->p_next;
+        }
+
+        /* Find parent: previous pointer of the first child. */
+        while ((p_item->p_prev != NULL) && (p_item->p_prev->p_child != p_item))
+        {
+            p_item = p_item->p_prev;
+        }
+        p_item = p_item->p_prev;
+    }
+    return NULL;
+}
+
+bool nrf_sortlist_remove(nrf_sortlist_t const * p_list, nrf_sortlist_item_t * p_item)
+{
+    ASSERT(p_list);
+    ASSERT(p_item);
+    bool ret = true;
+
+    if (p_item == p_list->p_cb->p_head)
+    {
+        p_list->p_cb->p_head = heap_root_remove(p_list, p_item);
+    }
+    else if (p_item->p_prev != NULL)
+    {
+        /* Detach subtree of the item and link the rest of it back to the heap. */
+        if (p_item->p_prev->p_child == p_item)
+        {
+            p_item->p_prev->p_child = p_item->p_next;
+        }
+        else
+        {
+            p_item->p_prev->p_next = p_item->p_next;
+        }
+        if (p_item->p_next != NULL)
+        {
+            p_item->p_next->p_prev = p_item->p_prev;
+        }
+
+        nrf_sortlist_item_t * p_sub = heap_root_remove(p_list, p_item);
+        if (p_sub != NULL)
+        {
+            p_sub = heap_link(p_list, p_list->p_cb->p_head, p_sub);
+            p_sub->p_prev = NULL;
+            p_sub->p_next = NULL;
+            p_list->p_cb->p_head = p_sub;
+        }
+    }
+    else
+    {
+        ret = false;
+    }
+
+    NRF_LOG_INFO("List:%s, removing element:%08X %s",
+                                  p_list->p_name, p_item, ret ? "succeeded" : "not found");
+    return ret;
+}
+#else
 void nrf_sortlist_add(nrf_sortlist_t const * p_list, nrf_sortlist_item_t * p_item)
 {
     ASSERT(p_list);
@@ -100,6 +314,13 @@ nrf_sortlist_item_t const * nrf_sortlist_next(nrf_sortlist_item_t const * p_item
     return p_item->p_next;
 }
 
+nrf_sortlist_item_t const * nrf_sortlist_next_skip(nrf_sortlist_item_t const * p_item)
+{
+    ASSERT(p_item);
+    UNUSED_PARAMETER(p_item);
+    return NULL;
+}
+
 bool nrf_sortlist_remove(nrf_sortlist_t const * p_list, nrf_sortlist_item_t * p_item)
 {
     ASSERT(p_list);
@@ -123,4 +344,5 @@ bool nrf_sortlist_remove(nrf_sortlist_t const * p_list, nrf_sortlist_item_t * p_
                                   p_list->p_name, p_item, ret ? "succeeded" : "not found");
     return ret;
 }
+#endif // NRF_SORTLIST_CONFIG_PAIRING_HEAP
 #endif //NRF_SORTLIST_ENABLED
@@ -44,6 +44,10 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifndef NRF_SORTLIST_CONFIG_PAIRING_HEAP
+#define NRF_SORTLIST_CONFIG_PAIRING_HEAP 0
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -52,6 +56,11 @@ extern "C" {
  * @{
  * @ingroup app_common
  * @brief Module for storing items in the ordered list.
+ *
+ * If @ref NRF_SORTLIST_CONFIG_PAIRING_HEAP is enabled, items are stored in a pairing heap instead
+ * of a sorted linked list. Adding is then O(1) and removing and popping is amortized O(log n), but
+ * only the list head is ordered. Items which are not in the list must be zero initialized or
+ * previously popped or removed from the list.
  */
 
 /**
@@ -74,7 +83,11 @@ typedef bool (*nrf_sortlist_compare_func_t)(nrf_sortlist_item_t * p_item0, nrf_s
  */
 struct nrf_sortlist_item_s
 {
-    nrf_sortlist_item_t * p_next;             /* Pointer to the next item in the list. */
+    nrf_sortlist_item_t * p_next;             /* Pointer to the next item in the list (next sibling in the heap). */
+#if NRF_SORTLIST_CONFIG_PAIRING_HEAP
+    nrf_sortlist_item_t * p_prev;             /* Pointer to the previous sibling or to the parent of the first child. */
+    nrf_sortlist_item_t * p_child;            /* Pointer to the first child. */
+#endif
 };
 
 /**
@@ -152,12 +165,32 @@ nrf_sortlist_item_t const * nrf_sortlist_peek(nrf_sortlist_t const * p_list);
 /**
  * @brief Function for iterating over the list.
  *
+ * Items following @p p_item are never lower than it. If @ref NRF_SORTLIST_CONFIG_PAIRING_HEAP is
+ * enabled, items are not visited in sorted order: an item is only guaranteed to be visited after
+ * all items on its path from the list head, which are not higher than it. Use
+ * @ref nrf_sortlist_next_skip to stop iterating over items which are not lower than a given one
+ * without missing any lower item.
+ *
  * @param p_item   Item in the list.
  *
  * @return Pointer to the next item in the list.
  */
 nrf_sortlist_item_t const * nrf_sortlist_next(nrf_sortlist_item_t const * p_item);
 
+/**
+ * @brief Function for iterating over the list, skipping items which follow the given item.
+ *
+ * Items skipped are those which @ref nrf_sortlist_next would visit only through @p p_item, so
+ * none of them is lower than @p p_item. In the sorted list it is the rest of the list. In the
+ * pairing heap it is the subtree of @p p_item, and iteration continues with other items, which
+ * may be lower.
+ *
+ * @param p_item   Item in the list.
+ *
+ * @return Pointer to the next item which is not skipped or NULL if there is none.
+ */
+nrf_sortlist_item_t const * nrf_sortlist_next_skip(nrf_sortlist_item_t const * p_item);
+
 /**
  * @brief Function for removing an item from the queue.
  *
@@ -131,14 +131,25 @@ extern "C" {
 typedef void (*app_timer_timeout_handler_t)(void * p_context);
 
 #ifdef APP_TIMER_V2
+#ifndef APP_TIMER_CONFIG_USE_WHEEL
+#define APP_TIMER_CONFIG_USE_WHEEL 0
+#endif
+
 /**
  * @brief app_timer control block
  */
-typedef struct
+typedef struct app_timer_t
 {
+#if APP_TIMER_CONFIG_USE_WHEEL
+    struct app_timer_t *        p_wheel_next;  /**< Next timer in the same timing wheel slot. */
+    struct app_timer_t **       pp_wheel_prev; /**< Link pointing to this timer, NULL if the timer is not in the wheel. */
+    uint8_t                     wheel_slot;    /**< Index of the timing wheel slot holding the timer. */
+#else
     nrf_sortlist_item_t         list_item;     /**< Token used by sortlist. */
+#endif
     volatile uint32_t           end_val;       /**< RTC counter value when timer expires. */
     uint32_t                    repeat_period; /**< Repeat period (0 if single shot mode). */
+    uint32_t                    slack;         /**< Number of ticks the expiry may be delayed by. */
     app_timer_timeout_handler_t handler;       /**< User handler. */
     void *                      p_context;     /**< User context. */
     NRF_LOG_INSTANCE_PTR_DECLARE(p_log)        /**< Pointer to instance of the logger object (Conditionally compiled). */
@@ -241,6 +252,35 @@ ret_code_t app_timer_create(app_timer_id_t const *      p_timer_id,
  */
 ret_code_t app_timer_start(app_timer_id_t timer_id, uint32_t timeout_ticks, void * p_context);
 
+#ifdef APP_TIMER_V2
+/**@brief Function for starting a timer with a tolerance window.
+ *
+ * @details The timer expires at any moment between @p timeout_ticks and
+ *          @p timeout_ticks + @p slack_ticks from the start. Expiries of timers whose windows
+ *          overlap are merged into a single RTC interrupt, which lets the CPU sleep longer when
+ *          several timers do not require exact timing. In repeated mode, the window applies to
+ *          every period and the period is counted from the nominal expiry, so it does not drift.
+ *
+ * @param[in]       timer_id      Timer identifier.
+ * @param[in]       timeout_ticks Number of ticks (of RTC1, including prescaling) to time-out event
+ *                                (minimum 5 ticks).
+ * @param[in]       slack_ticks   Number of ticks the time-out event may be delayed by.
+ * @param[in]       p_context     General purpose pointer. Will be passed to the time-out handler when
+ *                                the timer expires.
+ *
+ * @retval     NRF_SUCCESS               If the timer was successfully started.
+ * @retval     NRF_ERROR_INVALID_PARAM   If a parameter was invalid.
+ * @retval     NRF_ERROR_NO_MEM          If the timer operations queue was full.
+ *
+ * @note When calling this method on a timer that is already running, the second start operation
+ *       is ignored.
+ */
+ret_code_t app_timer_start_with_slack(app_timer_id_t timer_id,
+                                      uint32_t       timeout_ticks,
+                                      uint32_t       slack_ticks,
+                                      void *         p_context);
+#endif
+
 /**@brief Function for stopping the specified timer.
  *
  * @param[in]  timer_id                  Timer identifier.
@@ -288,6 +328,27 @@ uint32_t app_timer_cnt_diff_compute(uint32_t   ticks_to,
  */
 uint8_t app_timer_op_queue_utilization_get(void);
 
+#ifdef APP_TIMER_V2
+/**@brief Timer expiry statistics. */
+typedef struct
+{
+    uint32_t rtc_wakeups;   /**< Number of RTC interrupts in which at least one timer expired. */
+    uint32_t expirations;   /**< Number of timer expirations. */
+    uint32_t wakeups_saved; /**< Number of expirations delayed within the slack window into an RTC interrupt of an earlier expiring timer. */
+} app_timer_stats_t;
+
+/**@brief Function for getting timer expiry statistics.
+ *
+ * The ratio of @ref app_timer_stats_t::wakeups_saved to @ref app_timer_stats_t::expirations shows
+ * how well the timers are coalesced, see @ref app_timer_start_with_slack.
+ *
+ * @note APP_TIMER_WITH_PROFILER must be enabled to use this functionality.
+ *
+ * @param[out] p_stats Statistics.
+ */
+void app_timer_stats_get(app_timer_stats_t * p_stats);
+#endif
+
 /**
  * @brief Function for pausing RTC activity which drives app_timer.
  *
@@ -39,8 +39,10 @@
  */
 #include "app_timer.h"
 #include "nrf_atfifo.h"
+#if !APP_TIMER_CONFIG_USE_WHEEL
 #include "nrf_sortlist.h"
-#include "nrf_delay.h"
+#endif
+#include "app_util_platform.h"
 #if APP_TIMER_CONFIG_USE_SCHEDULER
 #include "app_scheduler.h"
 #endif
@@ -87,12 +89,362 @@ typedef struct
     app_timer_t *        p_timer; /**< Timer instance. */
 } timer_req_t;
 
+#if !APP_TIMER_CONFIG_USE_WHEEL
 static app_timer_t * volatile mp_active_timer; /**< Timer currently handled by RTC driver. */
+static uint32_t               m_active_cc;     /**< Compare value configured for the active timer. */
+#endif
 static bool                   m_global_active; /**< Flag used to globally disable all timers. */
 
+#if APP_TIMER_WITH_PROFILER
+static app_timer_stats_t      m_stats;         /**< Timer expiry statistics. */
+static uint32_t               m_stats_base;    /**< RTC counter value at the beginning of the interrupt. */
+static int32_t                m_stats_first;   /**< Earliest end value (relative to m_stats_base) expired in the interrupt. */
+static uint32_t               m_stats_first_cnt; /**< Number of expirations with the earliest end value in the interrupt. */
+#endif
+
 /* Request FIFO instance. */
 NRF_ATFIFO_DEF(m_req_fifo, timer_req_t, APP_TIMER_CONFIG_OP_QUEUE_SIZE);
 
+#if APP_TIMER_CONFIG_USE_WHEEL
+/**
+ * Hierarchical timing wheel. Each level splits the 24 bit RTC counter into a digit of
+ * APP_TIMER_WHEEL_SLOT_BITS bits. A timer is kept in the level of the most significant digit
+ * in which its end value differs from the wheel time, so starting and stopping a timer takes
+ * constant time. When the wheel time reaches a slot of a higher level, its timers are moved
+ * (cascaded) to the lower levels.
+ */
+#define APP_TIMER_WHEEL_SLOT_BITS 5
+#define APP_TIMER_WHEEL_SLOTS     (1UL << APP_TIMER_WHEEL_SLOT_BITS)
+#define APP_TIMER_WHEEL_LEVELS    5    /**< Number of levels needed to cover the 24 bit counter. */
+#define APP_TIMER_WHEEL_TOP_LEVEL (APP_TIMER_WHEEL_LEVELS - 1)
+
+STATIC_ASSERT((APP_TIMER_WHEEL_SLOT_BITS * APP_TIMER_WHEEL_LEVELS) >= 24);
+STATIC_ASSERT((APP_TIMER_WHEEL_SLOTS * APP_TIMER_WHEEL_LEVELS) <= 256);
+
+static app_timer_t * m_wheel[APP_TIMER_WHEEL_LEVELS * APP_TIMER_WHEEL_SLOTS]; /**< Lists of timers in the wheel slots. */
+static uint32_t      m_wheel_bitmap[APP_TIMER_WHEEL_LEVELS];                   /**< Non-empty slots of each level. */
+static uint32_t      m_wheel_time;                                             /**< RTC counter value up to which the wheel has been processed. */
+
+static bool timer_expire(app_timer_t * p_timer);
+
+/**
+ * @brief Function for computing the number of ticks from @p from to @p to (modulo counter range).
+ */
+__STATIC_INLINE uint32_t wheel_ticks_diff(uint32_t to, uint32_t from)
+{
+    return (to - from) & RTC_COUNTER_COUNTER_Msk;
+}
+
+/**
+ * @brief Function for getting the slot index of @p ticks at the given wheel level.
+ */
+__STATIC_INLINE uint32_t wheel_digit_get(uint32_t ticks, uint32_t level)
+{
+    return (ticks >> (level * APP_TIMER_WHEEL_SLOT_BITS)) & (APP_TIMER_WHEEL_SLOTS - 1);
+}
+
+/**
+ * @brief Function for finding the first non-empty slot starting from @p first.
+ *
+ * @return Slot index or APP_TIMER_WHEEL_SLOTS if there is no such slot.
+ */
+static uint32_t wheel_slot_find(uint32_t bitmap, uint32_t first)
+{
+    if (first >= APP_TIMER_WHEEL_SLOTS)
+    {
+        return APP_TIMER_WHEEL_SLOTS;
+    }
+
+    bitmap &= ~((1UL << first) - 1);
+    if (bitmap == 0)
+    {
+        return APP_TIMER_WHEEL_SLOTS;
+    }
+    return __CLZ(__RBIT(bitmap));
+}
+
+/**
+ * @brief Function for adding a timer to the wheel.
+ *
+ * A timer whose end value has already passed is put into the current slot and expires on the
+ * next wheel advance.
+ */
+static void wheel_insert(app_timer_t * p_timer)
+{
+    uint32_t end_val = p_timer->end_val & RTC_COUNTER_COUNTER_Msk;
+    uint32_t level   = 0;
+    uint32_t diff;
+    uint32_t slot;
+
+    if (wheel_ticks_diff(end_val, m_wheel_time) > APP_TIMER_RTC_MAX_VALUE)
+    {
+        end_val = m_wheel_time;
+    }
+    p_timer->end_val = end_val;
+
+    diff = end_val ^ m_wheel_time;
+    if (diff != 0)
+    {
+        level = (31 - __CLZ(diff)) / APP_TIMER_WHEEL_SLOT_BITS;
+        if (wheel_digit_get(end_val, level) < wheel_digit_get(m_wheel_time, level))
+        {
+            // Timeout wraps around the counter range. Keep the timer in the top level until
+            // the wheel time wraps as well.
+            level = APP_TIMER_WHEEL_TOP_LEVEL;
+        }
+    }
+
+    slot = wheel_digit_get(end_val, level);
+    p_timer->wheel_slot    = (uint8_t)(level * APP_TIMER_WHEEL_SLOTS + slot);
+    p_timer->p_wheel_next  = m_wheel[p_timer->wheel_slot];
+    p_timer->pp_wheel_prev = &m_wheel[p_timer->wheel_slot];
+    if (p_timer->p_wheel_next)
+    {
+        p_timer->p_wheel_next->pp_wheel_prev = &p_timer->p_wheel_next;
+    }
+    m_wheel[p_timer->wheel_slot] = p_timer;
+    m_wheel_bitmap[level] |= (1UL << slot);
+}
+
+/**
+ * @brief Function for removing a timer from the wheel.
+ *
+ * @return True if the timer was in the wheel.
+ */
+static bool wheel_remove(app_timer_t * p_timer)
+{
+    uint32_t idx = p_timer->wheel_slot;
+
+    if (p_timer->pp_wheel_prev == NULL)
+    {
+        return false;
+    }
+
+    *p_timer->pp_wheel_prev = p_timer->p_wheel_next;
+    if (p_timer->p_wheel_next)
+    {
+        p_timer->p_wheel_next->pp_wheel_prev = p_timer->pp_wheel_prev;
+    }
+    p_timer->pp_wheel_prev = NULL;
+
+    if (m_wheel[idx] == NULL)
+    {
+        m_wheel_bitmap[idx / APP_TIMER_WHEEL_SLOTS] &= ~(1UL << (idx % APP_TIMER_WHEEL_SLOTS));
+    }
+    return true;
+}
+
+/**
+ * @brief Function for taking the whole list of timers out of a wheel slot.
+ */
+static app_timer_t * wheel_slot_detach(uint32_t level, uint32_t slot)
+{
+    uint32_t      idx     = level * APP_TIMER_WHEEL_SLOTS + slot;
+    app_timer_t * p_timer = m_wheel[idx];
+
+    m_wheel[idx] = NULL;
+    m_wheel_bitmap[level] &= ~(1UL << slot);
+
+    return p_timer;
+}
+
+/**
+ * @brief Function for finding the next non-empty slot in wheel order.
+ *
+ * Lower levels always hold earlier timers than higher levels. Only the top level holds slots
+ * behind the current wheel time (timers wrapping around the counter range).
+ *
+ * @return True if a slot was found.
+ */
+static bool wheel_slot_next(uint32_t * p_level, uint32_t * p_slot)
+{
+    for (uint32_t level = 0; level < APP_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint32_t current = wheel_digit_get(m_wheel_time, level);
+        uint32_t slot    = wheel_slot_find(m_wheel_bitmap[level],
+                                           (level == 0) ? current : (current + 1));
+
+        if ((slot == APP_TIMER_WHEEL_SLOTS) && (level == APP_TIMER_WHEEL_TOP_LEVEL))
+        {
+            slot = wheel_slot_find(m_wheel_bitmap[level], 0);
+        }
+
+        if (slot != APP_TIMER_WHEEL_SLOTS)
+        {
+            *p_level = level;
+            *p_slot  = slot;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Function for getting the RTC counter value at which the wheel reaches given slot.
+ */
+static uint32_t wheel_slot_ticks_get(uint32_t level, uint32_t slot)
+{
+    uint32_t shift = level * APP_TIMER_WHEEL_SLOT_BITS;
+    uint32_t upper = (shift + APP_TIMER_WHEEL_SLOT_BITS < 32) ?
+                     (m_wheel_time & ~((1UL << (shift + APP_TIMER_WHEEL_SLOT_BITS)) - 1)) : 0;
+
+    return (upper | (slot << shift)) & RTC_COUNTER_COUNTER_Msk;
+}
+
+/**
+ * @brief Function for getting the timer which expires first.
+ *
+ * Only the timers from the first non-empty slot are compared.
+ */
+static app_timer_t * wheel_first_get(void)
+{
+    uint32_t      level;
+    uint32_t      slot;
+    app_timer_t * p_first = NULL;
+
+    if (wheel_slot_next(&level, &slot))
+    {
+        app_timer_t * p_timer = m_wheel[level * APP_TIMER_WHEEL_SLOTS + slot];
+
+        p_first = p_timer;
+        while (p_timer)
+        {
+            if (wheel_ticks_diff(p_timer->end_val, m_wheel_time) <
+                wheel_ticks_diff(p_first->end_val, m_wheel_time))
+            {
+                p_first = p_timer;
+            }
+            p_timer = p_timer->p_wheel_next;
+        }
+    }
+    return p_first;
+}
+
+/**
+ * @brief Function for getting the RTC counter value at which timers are to be expired.
+ *
+ * The latest moment which is still within the window of every timer expiring by then is taken,
+ * so timers with overlapping windows expire in a single RTC interrupt.
+ *
+ * @param p_first Timer which expires first.
+ */
+static uint32_t wheel_cc_get(app_timer_t const * p_first)
+{
+    uint32_t cc_diff = wheel_ticks_diff(p_first->end_val, m_wheel_time) + p_first->slack;
+
+    for (uint32_t level = 0; level < APP_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint32_t bitmap = m_wheel_bitmap[level];
+
+        while (bitmap)
+        {
+            uint32_t            slot    = __CLZ(__RBIT(bitmap));
+            app_timer_t const * p_timer = m_wheel[level * APP_TIMER_WHEEL_SLOTS + slot];
+
+            bitmap &= bitmap - 1;
+            if (wheel_ticks_diff(wheel_slot_ticks_get(level, slot), m_wheel_time) > cc_diff)
+            {
+                continue;
+            }
+
+            for (; p_timer != NULL; p_timer = p_timer->p_wheel_next)
+            {
+                uint32_t end_diff = wheel_ticks_diff(p_timer->end_val, m_wheel_time);
+
+                if ((end_diff <= cc_diff) && (end_diff + p_timer->slack < cc_diff))
+                {
+                    cc_diff = end_diff + p_timer->slack;
+                }
+            }
+        }
+    }
+
+    return (m_wheel_time + cc_diff) & RTC_COUNTER_COUNTER_Msk;
+}
+
+/**
+ * @brief Function for moving the wheel time forward.
+ *
+ * All timers which expire up to @p target are expired in a single pass. Timers from higher
+ * level slots which are passed are cascaded to the lower levels on the way.
+ *
+ * @param target RTC counter value. Ignored if it is behind the wheel time and the wheel is not
+ *               empty.
+ */
+static void wheel_advance(uint32_t target)
+{
+    uint32_t target_diff = wheel_ticks_diff(target, m_wheel_time);
+    uint32_t level;
+    uint32_t slot;
+
+    if (target_diff > APP_TIMER_RTC_MAX_VALUE)
+    {
+        if (!wheel_slot_next(&level, &slot))
+        {
+            // Empty wheel may have been idle for longer than the counter range.
+            m_wheel_time = target & RTC_COUNTER_COUNTER_Msk;
+        }
+        return;
+    }
+
+    while (wheel_slot_next(&level, &slot))
+    {
+        uint32_t      slot_ticks = wheel_slot_ticks_get(level, slot);
+        uint32_t      slot_diff  = wheel_ticks_diff(slot_ticks, m_wheel_time);
+        app_timer_t * p_timer;
+
+        if (slot_diff > target_diff)
+        {
+            break;
+        }
+
+        target_diff -= slot_diff;
+        m_wheel_time = slot_ticks;
+
+        p_timer = wheel_slot_detach(level, slot);
+        while (p_timer)
+        {
+            app_timer_t * p_next = p_timer->p_wheel_next;
+
+            p_timer->pp_wheel_prev = NULL;
+            if (level == 0)
+            {
+                UNUSED_RETURN_VALUE(timer_expire(p_timer));
+            }
+            else
+            {
+                wheel_insert(p_timer);
+            }
+            p_timer = p_next;
+        }
+    }
+
+    m_wheel_time = (m_wheel_time + target_diff) & RTC_COUNTER_COUNTER_Msk;
+}
+
+/**
+ * @brief Function for deactivating all timers in the wheel.
+ */
+static void wheel_stop_all(void)
+{
+    for (uint32_t level = 0; level < APP_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint32_t slot;
+
+        while ((slot = wheel_slot_find(m_wheel_bitmap[level], 0)) != APP_TIMER_WHEEL_SLOTS)
+        {
+            app_timer_t * p_timer = wheel_slot_detach(level, slot);
+
+            while (p_timer)
+            {
+                p_timer->active        = false;
+                p_timer->pp_wheel_prev = NULL;
+                p_timer                = p_timer->p_wheel_next;
+            }
+        }
+    }
+}
+#else
 /* Sortlist instance. */
 static bool compare_func(nrf_sortlist_item_t * p_item0, nrf_sortlist_item_t *p_item1);
 NRF_SORTLIST_DEF(m_app_timer_sortlist, compare_func); /**< Sortlist used for storing queued timers. */
@@ -109,6 +461,7 @@ static inline bool compare_func(nrf_sortlist_item_t * p_item0, nrf_sortlist_item
     uint32_t p1_end = p1->end_val;
     return (p0_end <= p1_end) ? true : false;
 }
+#endif // APP_TIMER_CONFIG_USE_WHEEL
 
 #if APP_TIMER_CONFIG_USE_SCHEDULER
 static void scheduled_timeout_handler(void * p_event_data, uint16_t event_size)
@@ -120,6 +473,32 @@ static void scheduled_timeout_handler(void * p_event_data, uint16_t event_size)
 }
 #endif
 
+#if APP_TIMER_WITH_PROFILER
+/**
+ * @brief Function for recording the end value of a timer expiring in the current RTC interrupt.
+ *
+ * Only timers which end after the earliest timer expired in the same interrupt were pulled in by
+ * their slack window. Timers ending at the same time would share the interrupt anyway.
+ *
+ * @param end_val End value of the expiring timer.
+ */
+static void stats_expiry_record(uint32_t end_val)
+{
+    // Sign extended 24 bit distance, end value may be masked or not (overflow pending).
+    int32_t end_diff = (int32_t)((end_val - m_stats_base) << 8) >> 8;
+
+    if ((m_stats_first_cnt == 0) || (end_diff < m_stats_first))
+    {
+        m_stats_first     = end_diff;
+        m_stats_first_cnt = 1;
+    }
+    else if (end_diff == m_stats_first)
+    {
+        m_stats_first_cnt++;
+    }
+}
+#endif
+
 /**
  * @brief Function called on timer expiration
  *
@@ -147,11 +526,19 @@ static bool timer_expire(app_timer_t * p_timer)
         APP_ERROR_CHECK(err_code);
 #else
         p_timer->handler(p_timer->p_context);
+#endif
+#if APP_TIMER_WITH_PROFILER
+        m_stats.expirations++;
+        stats_expiry_record(p_timer->end_val);
 #endif
         if (p_timer->repeat_period && p_timer->active)
         {
             p_timer->end_val += p_timer->repeat_period;
+#if APP_TIMER_CONFIG_USE_WHEEL
+            wheel_insert(p_timer);
+#else
             nrf_sortlist_add(&m_app_timer_sortlist, &p_timer->list_item);
+#endif
             ret = true;
         }
         else
@@ -162,6 +549,43 @@ static bool timer_expire(app_timer_t * p_timer)
     return ret;
 }
 
+#if APP_TIMER_CONFIG_USE_WHEEL
+/**
+ * @brief Function updates RTC.
+ *
+ * Function is called at the end of RTC interrupt. It configures RTC to the first timer in the
+ * wheel (delayed within the slack windows to coalesce expiries) or stops RTC if there is no
+ * active timers. If the compare value is too close to be configured, all timers due by then
+ * expire immediately.
+ */
+static void rtc_update(drv_rtc_t const * const  p_instance)
+{
+    app_timer_t * p_next;
+
+    while ((p_next = wheel_first_get()) != NULL)
+    {
+        uint32_t   cc  = wheel_cc_get(p_next);
+        ret_code_t ret = drv_rtc_windowed_compare_set(p_instance, 0, cc, APP_TIMER_SAFE_WINDOW);
+        if (ret == NRF_SUCCESS)
+        {
+            if (!APP_TIMER_KEEPS_RTC_ACTIVE)
+            {
+                drv_rtc_start(p_instance);
+            }
+            return;
+        }
+
+        ASSERT(ret == NRF_ERROR_TIMEOUT);
+        NRF_LOG_INST_DEBUG(p_next->p_log, "Timer expired before scheduled to RTC.");
+        wheel_advance(cc);
+    }
+
+    if (!APP_TIMER_KEEPS_RTC_ACTIVE)
+    {
+        drv_rtc_stop(p_instance);
+    }
+}
+#else
 /**
  * @brief Function is configuring RTC driver to trigger timeout interrupt for given timer.
  *
@@ -169,17 +593,18 @@ static bool timer_expire(app_timer_t * p_timer)
  * expires and function indicates that RTC was not configured.
  *
  * @param          p_timer Timer instance.
+ * @param          cc      Compare value, within the slack window of the timer.
  * @param [in,out] p_rerun Flag indicating that sortlist reevaluation is required.
  *
  * @return True if RTC was successfully configured, false if timer already expired and RTC was not
  *         configured.
  *
  */
-static bool rtc_schedule(app_timer_t * p_timer, bool * p_rerun)
+static bool rtc_schedule(app_timer_t * p_timer, uint32_t cc, bool * p_rerun)
 {
     ret_code_t ret = NRF_SUCCESS;
     *p_rerun = false;
-    ret = drv_rtc_windowed_compare_set(&m_rtc_inst, 0, p_timer->end_val, APP_TIMER_SAFE_WINDOW);
+    ret = drv_rtc_windowed_compare_set(&m_rtc_inst, 0, cc, APP_TIMER_SAFE_WINDOW);
 
     if (ret == NRF_SUCCESS)
     {
@@ -213,6 +638,47 @@ static inline app_timer_t * sortlist_next(app_timer_t * p_item)
     nrf_sortlist_item_t const * p_next_item = nrf_sortlist_next(&p_item->list_item);
     return p_next_item ? CONTAINER_OF(p_next_item, app_timer_t, list_item) : NULL;
 }
+
+static inline app_timer_t * sortlist_next_skip(app_timer_t * p_item)
+{
+    nrf_sortlist_item_t const * p_next_item = nrf_sortlist_next_skip(&p_item->list_item);
+    return p_next_item ? CONTAINER_OF(p_next_item, app_timer_t, list_item) : NULL;
+}
+
+/**
+ * @brief Function for getting the RTC counter value at which timers are to be expired.
+ *
+ * Compare value is delayed up to the latest moment which is still within the window of every timer
+ * expiring by then, so timers with overlapping windows expire in a single RTC interrupt.
+ *
+ * Sortlist does not guarantee that timers are visited in the order of expiration (see
+ * @ref nrf_sortlist_next), only that no timer skipped with @ref nrf_sortlist_next_skip expires
+ * earlier than the timer it was skipped after. Compare value never drops below the window end of a
+ * timer expiring by the final compare value, so every such timer is visited and the result does
+ * not depend on the order.
+ *
+ * @param cc Initial compare value (end of the window of the timer taken out of the list).
+ */
+static uint32_t sortlist_cc_get(uint32_t cc)
+{
+    app_timer_t * p_next = sortlist_peek();
+
+    while (p_next)
+    {
+        if (p_next->end_val > cc)
+        {
+            p_next = sortlist_next_skip(p_next);
+            continue;
+        }
+
+        if (p_next->end_val + p_next->slack < cc)
+        {
+            cc = p_next->end_val + p_next->slack;
+        }
+        p_next = sortlist_next(p_next);
+    }
+    return cc;
+}
 /**
  * @brief Function for deactivating all timers which are in the sorted list (active timers).
  */
@@ -240,22 +706,33 @@ static void on_overflow_evt(void)
     if (mp_active_timer)
     {
         uint32_t end_val = mp_active_timer->end_val;
-        mp_active_timer->end_val = end_val & RTC_COUNTER_COUNTER_Msk;
+        if (end_val <= RTC_COUNTER_COUNTER_Msk)
+        {
+            //Timer delayed within its slack window past the overflow is already due.
+            app_timer_t * p_timer = mp_active_timer;
+            mp_active_timer = NULL;
+            UNUSED_RETURN_VALUE(timer_expire(p_timer));
+        }
+        else
+        {
+            mp_active_timer->end_val = end_val & RTC_COUNTER_COUNTER_Msk;
+            m_active_cc &= RTC_COUNTER_COUNTER_Msk;
+        }
     }
 
     app_timer_t *     p_next;
     p_next = sortlist_peek();
+    while (p_next && (p_next->end_val <= RTC_COUNTER_COUNTER_Msk))
+    {
+        //If overflow occurs then all timers with value lower than max value expires immediately.
+        UNUSED_RETURN_VALUE(sortlist_pop());
+        UNUSED_RETURN_VALUE(timer_expire(p_next));
+        p_next = sortlist_peek();
+    }
+
     while (p_next)
     {
-        if (p_next->end_val <= RTC_COUNTER_COUNTER_Msk)
-        {
-            //If overflow occurs then all timers with value lower than max value expires immediately.
-            UNUSED_RETURN_VALUE(timer_expire(p_next));
-        }
-        else
-        {
-            p_next->end_val &= RTC_COUNTER_COUNTER_Msk;
-        }
+        p_next->end_val &= RTC_COUNTER_COUNTER_Msk;
         p_next = sortlist_next(p_next);
     }
 }
@@ -275,6 +752,16 @@ static void on_compare_evt(void)
     {
         NRF_LOG_WARNING("Compare event but no active timer (already stopped?)");
     }
+
+    // Expire timers coalesced with the active one.
+    uint32_t      counter = drv_rtc_counter_get(&m_rtc_inst);
+    app_timer_t * p_next  = sortlist_peek();
+    while (p_next && (p_next->end_val <= counter))
+    {
+        UNUSED_RETURN_VALUE(sortlist_pop());
+        UNUSED_RETURN_VALUE(timer_expire(p_next));
+        p_next = sortlist_peek();
+    }
 }
 
 /**
@@ -292,17 +779,15 @@ static void rtc_update(drv_rtc_t const * const  p_instance)
         bool rtc_reconf = false;
         if (p_next) //Candidate for active timer
         {
-            uint32_t next_end_val   = p_next->end_val;
-            uint32_t active_end_val = mp_active_timer->end_val;
+            uint32_t next_end_val = p_next->end_val;
             if (mp_active_timer == NULL)
             {
                 //There is no active timer so candidate will become active timer.
                 rtc_reconf = true;
             }
-            else if (mp_active_timer &&
-                    (active_end_val > next_end_val))
+            else if (m_active_cc > sortlist_cc_get(next_end_val + p_next->slack))
             {
-                //Candidate has shorter timeout than current active timer. Candidate will replace active timer.
+                //Candidate window ends before current compare value. Candidate will replace active timer.
                 //Active timer is put back into sorted list.
                 rtc_reconf = true;
                 if (mp_active_timer->active)
@@ -314,16 +799,19 @@ static void rtc_update(drv_rtc_t const * const  p_instance)
 
             if (rtc_reconf)
             {
-                bool rerun;
+                bool     rerun;
+                uint32_t cc;
                 p_next = sortlist_pop();
-                NRF_LOG_INST_DEBUG(p_next->p_log, "Activating timer (CC:%d).", next_end_val);
-                if (rtc_schedule(p_next, &rerun))
+                cc     = sortlist_cc_get(p_next->end_val + p_next->slack);
+                NRF_LOG_INST_DEBUG(p_next->p_log, "Activating timer (CC:%d).", cc);
+                if (rtc_schedule(p_next, cc, &rerun))
                 {
                     if (!APP_TIMER_KEEPS_RTC_ACTIVE && (mp_active_timer == NULL))
                     {
                         drv_rtc_start(p_instance);
                     }
                     mp_active_timer = p_next;
+                    m_active_cc     = cc;
 
                     if (rerun == false)
                     {
@@ -353,6 +841,7 @@ static void rtc_update(drv_rtc_t const * const  p_instance)
         }
     }
 }
+#endif // APP_TIMER_CONFIG_USE_WHEEL
 
 /**
  * @brief Function for processing user requests.
@@ -372,26 +861,38 @@ static void timer_req_process(drv_rtc_t const * const  p_instance)
                 if (!p_req->p_timer->active)
                 {
                     p_req->p_timer->active = true;
+#if APP_TIMER_CONFIG_USE_WHEEL
+                    wheel_insert(p_req->p_timer);
+#else
                     if (p_req->p_timer->end_val - drv_rtc_counter_get(p_instance) > APP_TIMER_RTC_MAX_VALUE)
                     {
                         //A little trick to handle case when timer was scheduled just before overflow.
                         p_req->p_timer->end_val &= RTC_COUNTER_COUNTER_Msk;
                     }
                     nrf_sortlist_add(&m_app_timer_sortlist, &(p_req->p_timer->list_item));
+#endif
                     NRF_LOG_INST_DEBUG(p_req->p_timer->p_log,"Start request (CC:%d).",
                                                                            p_req->p_timer->end_val);
                 }
                 break;
             case TIMER_REQ_STOP:
+#if APP_TIMER_CONFIG_USE_WHEEL
+                UNUSED_RETURN_VALUE(wheel_remove(p_req->p_timer));
+#else
                 if (p_req->p_timer == mp_active_timer)
                 {
                     mp_active_timer = NULL;
                 }
                 UNUSED_RETURN_VALUE(nrf_sortlist_remove(&m_app_timer_sortlist, &(p_req->p_timer->list_item)));
+#endif
                 NRF_LOG_INST_DEBUG(p_req->p_timer->p_log,"Stop request.");
                 break;
             case TIMER_REQ_STOP_ALL:
+#if APP_TIMER_CONFIG_USE_WHEEL
+                wheel_stop_all();
+#else
                 sorted_list_stop_all();
+#endif
                 m_global_active = true;
                 NRF_LOG_INFO("Stop all request.");
                 break;
@@ -405,6 +906,16 @@ static void timer_req_process(drv_rtc_t const * const  p_instance)
 
 static void rtc_irq(drv_rtc_t const * const  p_instance)
 {
+#if APP_TIMER_WITH_PROFILER
+    uint32_t expirations = m_stats.expirations;
+    m_stats_base      = drv_rtc_counter_get(p_instance);
+    m_stats_first_cnt = 0;
+#endif
+#if APP_TIMER_CONFIG_USE_WHEEL
+    // All timers due until now are expired at once, no matter which event triggered interrupt.
+    UNUSED_RETURN_VALUE(drv_rtc_compare_pending(p_instance, 0));
+    wheel_advance(drv_rtc_counter_get(p_instance));
+#else
     if (drv_rtc_overflow_pending(p_instance))
     {
         on_overflow_evt();
@@ -413,8 +924,16 @@ static void rtc_irq(drv_rtc_t const * const  p_instance)
     {
         on_compare_evt();
     }
+#endif
     timer_req_process(p_instance);
     rtc_update(p_instance);
+#if APP_TIMER_WITH_PROFILER
+    if (m_stats.expirations != expirations)
+    {
+        m_stats.rtc_wakeups++;
+        m_stats.wakeups_saved += m_stats.expirations - expirations - m_stats_first_cnt;
+    }
+#endif
 }
 
 /**
@@ -474,7 +993,12 @@ ret_code_t app_timer_init(void)
     {
         return err_code;
     }
+#if APP_TIMER_CONFIG_USE_WHEEL
+    // Wheel works on the counter modulo its range, overflow does not need handling.
+    m_wheel_time = drv_rtc_counter_get(&m_rtc_inst);
+#else
     drv_rtc_overflow_enable(&m_rtc_inst, true);
+#endif
     if (APP_TIMER_KEEPS_RTC_ACTIVE)
     {
         drv_rtc_start(&m_rtc_inst);
@@ -503,16 +1027,26 @@ ret_code_t app_timer_create(app_timer_id_t const *      p_timer_id,
 }
 
 ret_code_t app_timer_start(app_timer_t * p_timer, uint32_t timeout_ticks, void * p_context)
+{
+    return app_timer_start_with_slack(p_timer, timeout_ticks, 0, p_context);
+}
+
+ret_code_t app_timer_start_with_slack(app_timer_t * p_timer,
+                                      uint32_t      timeout_ticks,
+                                      uint32_t      slack_ticks,
+                                      void *        p_context)
 {
     ASSERT(p_timer);
     app_timer_t * p_t = (app_timer_t *) p_timer;
 
-    if (timeout_ticks > APP_TIMER_RTC_MAX_VALUE)
+    if ((timeout_ticks > APP_TIMER_RTC_MAX_VALUE) ||
+        (slack_ticks > APP_TIMER_RTC_MAX_VALUE - timeout_ticks))
     {
         return NRF_ERROR_INVALID_PARAM;
     }
     p_t->p_context = p_context;
-    p_t->end_val = drv_rtc_counter_get(&m_rtc_inst) + timeout_ticks;
+    p_t->slack     = slack_ticks;
+    p_t->end_val   = drv_rtc_counter_get(&m_rtc_inst) + timeout_ticks;
 
     if (p_t->repeat_period)
     {
@@ -546,6 +1080,16 @@ uint8_t app_timer_op_queue_utilization_get(void)
     return 0;
 }
 
+#if APP_TIMER_WITH_PROFILER
+void app_timer_stats_get(app_timer_stats_t * p_stats)
+{
+    ASSERT(p_stats);
+    CRITICAL_REGION_ENTER();
+    *p_stats = m_stats;
+    CRITICAL_REGION_EXIT();
+}
+#endif
+
 uint32_t app_timer_cnt_diff_compute(uint32_t   ticks_to,
                                     uint32_t   ticks_from)
 {
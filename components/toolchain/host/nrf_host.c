@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2018, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <pthread.h>
+#include <signal.h>
+#include "nrf_host.h"
+
+/* Offset of the exception numbers of the interrupts, as on the core. */
+#define IRQ_VECTOR_OFFSET   16
+
+/* Exclusive monitor, one per thread like one per core. */
+__thread uint32_t volatile * nrf_host_excl_addr;
+__thread uint32_t            nrf_host_excl_value;
+
+__thread uint32_t nrf_host_ipsr;
+
+/* Lock taken while the owning thread has "interrupts disabled". */
+static pthread_mutex_t m_irq_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread bool   m_irq_masked;
+
+/* Signals of the emulated interrupts, blocked together with the lock when any is connected. */
+static sigset_t        m_irq_sigset;
+static volatile bool   m_irq_connected;
+static __thread bool   m_irq_blocked;
+static __thread sigset_t m_irq_saved_sigset;
+
+/* Emulated interrupts. A signal number of 0 means that the interrupt is not connected. */
+static uint32_t        m_irq_priority[NRF_HOST_IRQ_COUNT];
+static int             m_irq_signo[NRF_HOST_IRQ_COUNT];
+static void         (* m_irq_handler[NRF_HOST_IRQ_COUNT])(void);
+
+
+void __disable_irq(void)
+{
+    /* Like setting PRIMASK, masking again does nothing. The signals are blocked first, so a
+     * handler never runs while its thread holds the lock. */
+    if (!m_irq_masked)
+    {
+        if (m_irq_connected)
+        {
+            (void)pthread_sigmask(SIG_BLOCK, &m_irq_sigset, &m_irq_saved_sigset);
+            m_irq_blocked = true;
+        }
+        (void)pthread_mutex_lock(&m_irq_lock);
+        m_irq_masked = true;
+    }
+}
+
+
+void __enable_irq(void)
+{
+    if (m_irq_masked)
+    {
+        m_irq_masked = false;
+        (void)pthread_mutex_unlock(&m_irq_lock);
+        if (m_irq_blocked)
+        {
+            m_irq_blocked = false;
+            (void)pthread_sigmask(SIG_SETMASK, &m_irq_saved_sigset, NULL);
+        }
+    }
+}
+
+
+uint32_t __get_PRIMASK(void)
+{
+    return m_irq_masked ? 1 : 0;
+}
+
+
+void __set_PRIMASK(uint32_t primask)
+{
+    if (primask != 0)
+    {
+        __disable_irq();
+    }
+    else
+    {
+        __enable_irq();
+    }
+}
+
+
+void NVIC_SetPriority(IRQn_Type irqn, uint32_t priority)
+{
+    m_irq_priority[irqn] = priority;
+}
+
+
+uint32_t NVIC_GetPriority(IRQn_Type irqn)
+{
+    return m_irq_priority[irqn];
+}
+
+
+/* Runs the handler of the interrupt triggered by the signal, like the core enters an exception. */
+static void irq_signal_handler(int signo)
+{
+    uint32_t ipsr = nrf_host_ipsr;
+
+    for (IRQn_Type irqn = 0; irqn < NRF_HOST_IRQ_COUNT; irqn++)
+    {
+        if (m_irq_signo[irqn] == signo)
+        {
+            nrf_host_ipsr = IRQ_VECTOR_OFFSET + irqn;
+            m_irq_handler[irqn]();
+            break;
+        }
+    }
+    nrf_host_ipsr = ipsr;
+}
+
+
+void nrf_host_irq_connect(IRQn_Type irqn, int signo, void (*handler)(void))
+{
+    m_irq_signo[irqn]   = signo;
+    m_irq_handler[irqn] = handler;
+    (void)sigaddset(&m_irq_sigset, signo);
+    m_irq_connected = true;
+
+    /* Priorities are compared again for every interrupt, as the new one can mask any of them. */
+    for (IRQn_Type i = 0; i < NRF_HOST_IRQ_COUNT; i++)
+    {
+        struct sigaction action = {.sa_handler = irq_signal_handler};
+
+        if (m_irq_signo[i] == 0)
+        {
+            continue;
+        }
+        (void)sigemptyset(&action.sa_mask);
+        for (IRQn_Type j = 0; j < NRF_HOST_IRQ_COUNT; j++)
+        {
+            if ((m_irq_signo[j] != 0) && (m_irq_priority[j] >= m_irq_priority[i]))
+            {
+                (void)sigaddset(&action.sa_mask, m_irq_signo[j]);
+            }
+        }
+        (void)sigaction(m_irq_signo[i], &action, NULL);
+    }
+}
+
+
+void nrf_host_irq_disconnect(void)
+{
+    for (IRQn_Type irqn = 0; irqn < NRF_HOST_IRQ_COUNT; irqn++)
+    {
+        if (m_irq_signo[irqn] != 0)
+        {
+            /* Ignoring a signal discards it if it is pending. */
+            (void)signal(m_irq_signo[irqn], SIG_IGN);
+            (void)signal(m_irq_signo[irqn], SIG_DFL);
+            m_irq_signo[irqn] = 0;
+        }
+    }
+    (void)sigemptyset(&m_irq_sigset);
+    m_irq_connected = false;
+}
@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2018, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ * @brief Stand-ins for the Cortex-M core used when building SDK libraries for a PC host.
+ *
+ * On a host, nrf.h does not include any device or core headers. This file provides the parts
+ * of the CMSIS core API that the libraries use, so that they can be built and benchmarked
+ * off-target. It must be included before any other file, for example with the
+ * @c -include compiler option.
+ *
+ * - Interrupt masking (@c __disable_irq, @c __enable_irq) is emulated with a global lock that
+ *   is owned by the thread which "disabled interrupts". This makes @ref CRITICAL_REGION_ENTER
+ *   safe also when the libraries are called from several threads.
+ * - Exclusive access (@c __LDREXW, @c __STREXW) is emulated with a compare-and-swap of the
+ *   value that was loaded. A store fails if the value was changed by another thread in between.
+ * - Memory barriers are mapped to full compiler and hardware fences.
+ * - Interrupts can be emulated with POSIX signals delivered to a thread, see
+ *   @ref nrf_host_irq_connect. The handler runs with IPSR set to the emulated exception, and
+ *   signals of interrupts with the same or a lower priority are blocked while it runs. Signals
+ *   of all connected interrupts are blocked while interrupts are disabled.
+ */
+#ifndef NRF_HOST_H__
+#define NRF_HOST_H__
+
+#if !defined(_WIN32) && !defined(__unix) && !defined(__APPLE__)
+#error This file can only be used when building for a PC host.
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "compiler_abstraction.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE     static inline
+#endif
+
+/** @brief The emulated core. Cortex-M4 has the exclusive access instructions. */
+#define __CORTEX_M          (0x04U)
+#define __NVIC_PRIO_BITS    3
+
+/** @brief Interrupt number type. No peripheral interrupts exist on the host. */
+typedef int32_t IRQn_Type;
+
+/* Instructions without a meaning on the host. */
+#define __NOP()             do {} while (0)
+#define __WFE()             do {} while (0)
+#define __WFI()             do {} while (0)
+#define __SEV()             do {} while (0)
+#define __BKPT(value)       do {} while (0)
+
+#define __ISB()             __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()             __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DMB()             __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+__STATIC_INLINE uint32_t __REV(uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
+__STATIC_INLINE uint32_t __REV16(uint32_t value)
+{
+    return ((value & 0xFF00FF00UL) >> 8) | ((value & 0x00FF00FFUL) << 8);
+}
+
+/* A single instruction on the core, so it must not be a loop here: it is used together with
+ * __CLZ to find the lowest set bit. */
+__STATIC_INLINE uint32_t __RBIT(uint32_t value)
+{
+    value = ((value >> 1) & 0x55555555UL) | ((value & 0x55555555UL) << 1);
+    value = ((value >> 2) & 0x33333333UL) | ((value & 0x33333333UL) << 2);
+    value = ((value >> 4) & 0x0F0F0F0FUL) | ((value & 0x0F0F0F0FUL) << 4);
+    return __builtin_bswap32(value);
+}
+
+__STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+    return (value == 0) ? 32 : (uint8_t)__builtin_clz(value);
+}
+
+/* Saturates a signed value to the unsigned range of 'sat' bits. */
+__STATIC_INLINE uint32_t __USAT(int32_t value, uint32_t sat)
+{
+    uint32_t max = (sat >= 32) ? UINT32_MAX : ((1UL << sat) - 1);
+
+    if (value < 0)
+    {
+        return 0;
+    }
+    return ((uint32_t)value > max) ? max : (uint32_t)value;
+}
+
+/* Interrupt masking, see nrf_host.c. */
+void     __disable_irq(void);
+void     __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t primask);
+
+/* Exception number of the emulated interrupt run by the calling thread, 0 in Thread Mode. */
+extern __thread uint32_t nrf_host_ipsr;
+
+/* Privileged. */
+__STATIC_INLINE uint32_t __get_IPSR(void)
+{
+    return nrf_host_ipsr;
+}
+
+__STATIC_INLINE uint32_t __get_CONTROL(void)
+{
+    return 0;
+}
+
+/* Exclusive monitor of the calling thread, see nrf_host.c. */
+extern __thread uint32_t volatile * nrf_host_excl_addr;
+extern __thread uint32_t            nrf_host_excl_value;
+
+__STATIC_INLINE uint32_t __LDREXW(uint32_t volatile * p_addr)
+{
+    nrf_host_excl_addr  = p_addr;
+    nrf_host_excl_value = __atomic_load_n(p_addr, __ATOMIC_SEQ_CST);
+    return nrf_host_excl_value;
+}
+
+__STATIC_INLINE uint32_t __STREXW(uint32_t value, uint32_t volatile * p_addr)
+{
+    uint32_t expected = nrf_host_excl_value;
+    bool     reserved = (nrf_host_excl_addr == p_addr);
+
+    nrf_host_excl_addr = NULL;
+    if (!reserved)
+    {
+        return 1;
+    }
+    return __atomic_compare_exchange_n(p_addr, &expected, value, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? 0 : 1;
+}
+
+__STATIC_INLINE void __CLREX(void)
+{
+    nrf_host_excl_addr = NULL;
+}
+
+/* There is no interrupt controller on the host. */
+__STATIC_INLINE void NVIC_EnableIRQ(IRQn_Type irqn)
+{
+    (void)irqn;
+}
+
+__STATIC_INLINE void NVIC_DisableIRQ(IRQn_Type irqn)
+{
+    (void)irqn;
+}
+
+__STATIC_INLINE void NVIC_SetPendingIRQ(IRQn_Type irqn)
+{
+    (void)irqn;
+}
+
+__STATIC_INLINE void NVIC_ClearPendingIRQ(IRQn_Type irqn)
+{
+    (void)irqn;
+}
+
+/** @brief Number of interrupts which can be emulated. */
+#define NRF_HOST_IRQ_COUNT  8
+
+/* Priorities of the emulated interrupts, see nrf_host.c. */
+void     NVIC_SetPriority(IRQn_Type irqn, uint32_t priority);
+uint32_t NVIC_GetPriority(IRQn_Type irqn);
+
+/**
+ * @brief Function for emulating an interrupt with a signal sent to a thread.
+ *
+ * The priority of the interrupt must be set with @c NVIC_SetPriority before. Connected
+ * interrupts with a lower or the same priority do not preempt the handler.
+ *
+ * @param[in] irqn      Interrupt number, lower than @ref NRF_HOST_IRQ_COUNT.
+ * @param[in] signo     Signal which triggers the interrupt.
+ * @param[in] handler   Interrupt handler.
+ */
+void nrf_host_irq_connect(IRQn_Type irqn, int signo, void (*handler)(void));
+
+/**
+ * @brief Function for disconnecting all emulated interrupts.
+ *
+ * Pending signals are discarded and the default action of the signals is restored.
+ */
+void nrf_host_irq_disconnect(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_HOST_H__
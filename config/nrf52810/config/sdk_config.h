@@ -4796,6 +4796,30 @@
 #define APP_SCHEDULER_WITH_PROFILER 0
 #endif
 
+// <o> APP_SCHEDULER_PRIORITY_LEVELS - Number of event priority levels  <1-8> 
+// <i> Each level gets its own share of the scheduler buffer.
+// <i> Level 0 is the highest priority.
+
+#ifndef APP_SCHEDULER_PRIORITY_LEVELS
+#define APP_SCHEDULER_PRIORITY_LEVELS 1
+#endif
+
+// <q> APP_SCHEDULER_WEIGHTED_DISPATCH  - Enabling weighted dispatch between priority levels
+ 
+// <i> If disabled, a lower priority level is served only when all higher levels are empty.
+
+#ifndef APP_SCHEDULER_WEIGHTED_DISPATCH
+#define APP_SCHEDULER_WEIGHTED_DISPATCH 0
+#endif
+
+// <q> APP_SCHEDULER_WITH_DEADLINE  - Enabling per-event deadlines
+ 
+// <i> Requires a timestamp source set with app_sched_timestamp_func_set().
+
+#ifndef APP_SCHEDULER_WITH_DEADLINE
+#define APP_SCHEDULER_WITH_DEADLINE 0
+#endif
+
 // </e>
 
 // <e> APP_SDCARD_ENABLED - app_sdcard - SD/MMC card support using SPI
@@ -4905,11 +4929,25 @@
 #define APP_TIMER_KEEPS_RTC_ACTIVE 0
 #endif
 
+// <q> APP_TIMER_CONFIG_USE_WHEEL  - Use hierarchical timing wheel for active timers (app_timer V2)
+ 
+
+// <i> If option is enabled, timers are kept in a timing wheel instead of a sorted list.
+// <i> Starting and stopping a timer takes constant time and all timers due at the same
+// <i> time expire in a single RTC interrupt. The wheel uses 640 bytes of RAM for its slots
+// <i> and 20 bytes for a bitmap of the occupied slots. Each timer takes 8 more bytes.
+
+#ifndef APP_TIMER_CONFIG_USE_WHEEL
+#define APP_TIMER_CONFIG_USE_WHEEL 0
+#endif
+
 // <h> App Timer Legacy configuration - Legacy configuration.
 
 //==========================================================
 // <q> APP_TIMER_WITH_PROFILER  - Enable app_timer profiling
+ 
 
+// <i> In app_timer V2 it enables expiry statistics, see app_timer_stats_get().
 
 #ifndef APP_TIMER_WITH_PROFILER
 #define APP_TIMER_WITH_PROFILER 0
@@ -5142,19 +5180,43 @@
 #define APP_USBD_MSC_ENABLED 0
 #endif
 
-// <q> CRC16_ENABLED  - crc16 - CRC16 calculation routines
-
-
+// <e> CRC16_ENABLED - crc16 - CRC16 calculation routines
+//==========================================================
 #ifndef CRC16_ENABLED
 #define CRC16_ENABLED 0
 #endif
+// <o> CRC16_IMPLEMENTATION  - Calculation method
 
-// <q> CRC32_ENABLED  - crc32 - CRC32 calculation routines
+// <i> All methods give identical results. Table-driven methods are faster but use more flash.
+// <0=> Shift
+// <1=> Table (512 B of flash)
+// <2=> Slice-by-4 (2 KB of flash)
+// <3=> Slice-by-8 (4 KB of flash)
 
+#ifndef CRC16_IMPLEMENTATION
+#define CRC16_IMPLEMENTATION 0
+#endif
+
+// </e>
 
+// <e> CRC32_ENABLED - crc32 - CRC32 calculation routines
+//==========================================================
 #ifndef CRC32_ENABLED
 #define CRC32_ENABLED 0
 #endif
+// <o> CRC32_IMPLEMENTATION  - Calculation method
+
+// <i> All methods give identical results. Table-driven methods are faster but use more flash.
+// <0=> Bitwise
+// <1=> Table (1 KB of flash)
+// <2=> Slice-by-4 (4 KB of flash)
+// <3=> Slice-by-8 (8 KB of flash)
+
+#ifndef CRC32_IMPLEMENTATION
+#define CRC32_IMPLEMENTATION 0
+#endif
+
+// </e>
 
 // <q> ECC_ENABLED  - ecc - Elliptic Curve Cryptography Library
 
@@ -5206,8 +5268,10 @@
 
 // <i> NRF_FSTORAGE_SD uses the nrf_fstorage_sd backend implementation using the SoftDevice API. Use this if you have a SoftDevice present.
 // <i> NRF_FSTORAGE_NVMC uses the nrf_fstorage_nvmc implementation. Use this setting if you don't use the SoftDevice.
+// <i> NRF_FSTORAGE_RAM uses the nrf_fstorage_ram implementation, which emulates flash in RAM. Use this setting for testing only.
 // <1=> NRF_FSTORAGE_NVMC
 // <2=> NRF_FSTORAGE_SD
+// <3=> NRF_FSTORAGE_RAM
 
 #ifndef FDS_BACKEND
 #define FDS_BACKEND 2
@@ -5229,6 +5293,59 @@
 // </h>
 //==========================================================
 
+// <h> Index - Record index settings
+
+//==========================================================
+// <e> FDS_RECORD_INDEX_ENABLED - Keep an index of the records in RAM.
+
+// <i> The index maps file IDs and record keys to the location of records in flash, so that
+// <i> fds_record_find() does not need to scan flash pages to locate records. Searches by file ID
+// <i> or by record key alone, and fds_record_iterate(), scan flash.
+// <i> The index is rebuilt during initialization and maintained when records are written, deleted, or garbage collected.
+//==========================================================
+#ifndef FDS_RECORD_INDEX_ENABLED
+#define FDS_RECORD_INDEX_ENABLED 0
+#endif
+// <o> FDS_RECORD_INDEX_SIZE - Maximum number of records in the index.
+// <i> Each entry uses 12 bytes of RAM. If there are more valid records in flash than entries
+// <i> in the index, FDS falls back to scanning flash until garbage collection brings the number
+// <i> of records below this limit.
+#ifndef FDS_RECORD_INDEX_SIZE
+#define FDS_RECORD_INDEX_SIZE 32
+#endif
+
+// </e>
+
+// </h>
+//==========================================================
+
+// <h> Garbage collection - Garbage collection settings
+
+//==========================================================
+// <e> FDS_GC_AUTO_ENABLED - Run garbage collection automatically.
+
+// <i> Queue garbage collection when writing a record or reserving space leaves less than
+// <i> FDS_GC_AUTO_THRESHOLD free words in flash, or when there is not enough space left.
+// <i> No FDS_EVT_GC event is sent for garbage collection started this way.
+//==========================================================
+#ifndef FDS_GC_AUTO_ENABLED
+#define FDS_GC_AUTO_ENABLED 0
+#endif
+// <o> FDS_GC_AUTO_THRESHOLD - Free space threshold, in 4-byte words.
+#ifndef FDS_GC_AUTO_THRESHOLD
+#define FDS_GC_AUTO_THRESHOLD 256
+#endif
+
+// <o> FDS_GC_AUTO_PAGES - Maximum number of pages to garbage collect each time.
+#ifndef FDS_GC_AUTO_PAGES
+#define FDS_GC_AUTO_PAGES 1
+#endif
+
+// </e>
+
+// </h>
+//==========================================================
+
 // <h> CRC - CRC functionality
 
 //==========================================================
@@ -5563,6 +5680,16 @@
 
 // </e>
 
+// <q> NRF_ATFIFO_CONFIG_STATS_ENABLED  - nrf_atfifo - Gather usage statistics
+
+
+// <i> Tracks the high-water mark and the number of contended space reservations of each atomic FIFO.
+// <i> Single item operations use the generic C implementation instead of the assembly one when enabled.
+
+#ifndef NRF_ATFIFO_CONFIG_STATS_ENABLED
+#define NRF_ATFIFO_CONFIG_STATS_ENABLED 0
+#endif
+
 // <e> NRF_BALLOC_ENABLED - nrf_balloc - Block allocator module
 //==========================================================
 #ifndef NRF_BALLOC_ENABLED
@@ -5615,6 +5742,17 @@
 #define NRF_BALLOC_CLI_CMDS 0
 #endif
 
+// <o> NRF_BALLOC_CONFIG_MAGAZINE_SIZE - Number of elements cached per execution context. <0-32>
+// <i> Every pool caches freed elements separately for Thread Mode and for each
+// <i> interrupt priority level. Such a magazine is refilled and flushed in batches,
+// <i> so most allocations and frees do not need a critical region. 0 disables the cache.
+// <i> Elements cached by other contexts are used only when the pool runs out.
+// <i> Requires nrf_atomic. Do not enable this option if Thread Mode is preemptive (RTOS).
+
+#ifndef NRF_BALLOC_CONFIG_MAGAZINE_SIZE
+#define NRF_BALLOC_CONFIG_MAGAZINE_SIZE 0
+#endif
+
 // </e>
 
 // </e>
@@ -5755,6 +5893,20 @@
 // </h>
 //==========================================================
 
+// <h> nrf_fstorage_ram - Implementation emulating flash in RAM
+
+// <i> Configuration options for the fstorage implementation used for testing
+//==========================================================
+// <o> NRF_FSTORAGE_RAM_SIZE - Size of the emulated flash, in bytes
+// <i> Must be a multiple of the flash page size. The memory is only allocated if nrf_fstorage_ram.c is compiled in.
+
+#ifndef NRF_FSTORAGE_RAM_SIZE
+#define NRF_FSTORAGE_RAM_SIZE 32768
+#endif
+
+// </h>
+//==========================================================
+
 // </e>
 
 // <q> NRF_GFX_ENABLED  - nrf_gfx - GFX module
@@ -5899,12 +6051,22 @@
 #define NRF_SECTION_ITER_ENABLED 1
 #endif
 
-// <q> NRF_SORTLIST_ENABLED  - nrf_sortlist - Sorted list
-
-
+// <e> NRF_SORTLIST_ENABLED - nrf_sortlist - Sorted list
+//==========================================================
 #ifndef NRF_SORTLIST_ENABLED
 #define NRF_SORTLIST_ENABLED 0
 #endif
+// <q> NRF_SORTLIST_CONFIG_PAIRING_HEAP  - Store items in a pairing heap instead of a sorted linked list
+
+
+// <i> Adding is O(1), removing and popping is amortized O(log n) instead of O(n).
+// <i> Items take two more pointers and nrf_sortlist_next() does not iterate in sorted order.
+
+#ifndef NRF_SORTLIST_CONFIG_PAIRING_HEAP
+#define NRF_SORTLIST_CONFIG_PAIRING_HEAP 0
+#endif
+
+// </e>
 
 // <q> NRF_SPI_MNGR_ENABLED  - nrf_spi_mngr - SPI transaction manager
 
@@ -5927,6 +6089,16 @@
 #define NRF_TWI_MNGR_ENABLED 0
 #endif
 
+// <q> SHA256_UNROLL_FULL  - sha256 - Unroll all rounds of the SHA-256 transform
+ 
+
+// <i> By default, the rounds of the transform are unrolled 8 at a time. Unrolling all 64 rounds
+// <i> makes hashing faster, but the transform takes about 4 times more flash.
+
+#ifndef SHA256_UNROLL_FULL
+#define SHA256_UNROLL_FULL 0
+#endif
+
 // <q> SLIP_ENABLED  - slip - SLIP encoding and decoding
 
 
@@ -6098,6 +6270,17 @@
 // <h> nRF_Log
 
 //==========================================================
+// <q> NRF_LOG_BACKEND_SERIAL_BINARY  - Binary output of serial backends
+
+
+// <i> If enabled, UART and RTT backends send entries as compact binary frames
+// <i> (format string address and raw arguments) instead of formatted text.
+// <i> Frames must be decoded on the host using the application ELF file.
+
+#ifndef NRF_LOG_BACKEND_SERIAL_BINARY
+#define NRF_LOG_BACKEND_SERIAL_BINARY 0
+#endif
+
 // <q> NRF_LOG_STR_FORMATTER_TIMESTAMP_FORMAT_ENABLED  - nrf_log_str_formatter - Log string formatter
 
 
@@ -6217,6 +6400,19 @@
 #define NRF_LOG_ALLOW_OVERFLOW 1
 #endif
 
+// <q> NRF_LOG_LOCK_FREE  - Reserve space in the log buffer without masking interrupts.
+
+
+// <i> Space is reserved with an atomic compare-and-swap on the write index.
+// <i> Entries are never overwritten, so NRF_LOG_ALLOW_OVERFLOW is ignored
+// <i> and new logs are dropped when the buffer is full. Strings pushed with
+// <i> NRF_LOG_PUSH are released together with the entry which follows them,
+// <i> or when they leave no room for a new entry.
+
+#ifndef NRF_LOG_LOCK_FREE
+#define NRF_LOG_LOCK_FREE 0
+#endif
+
 // <e> NRF_LOG_USES_TIMESTAMP - Enable timestamping
 
 // <i> Function for getting the timestamp is provided by the user
@@ -6268,6 +6464,29 @@
 #define NRF_LOG_MSGPOOL_ELEMENT_COUNT 8
 #endif
 
+// <e> NRF_LOG_MSGPOOL_ARENA_ENABLED - Allocate log messages from a size class.
+
+// <i> Standard log messages are allocated as single contiguous
+// <i> elements of a size class, so they are not split into chunks.
+// <i> Chunks are used for hexdumps and when the size class is exhausted.
+//==========================================================
+#ifndef NRF_LOG_MSGPOOL_ARENA_ENABLED
+#define NRF_LOG_MSGPOOL_ARENA_ENABLED 0
+#endif
+// <o> NRF_LOG_MSGPOOL_CLASS_SIZE - Size of an element in the size class.
+// <i> The default value fits a message with a timestamp and 6 arguments.
+
+#ifndef NRF_LOG_MSGPOOL_CLASS_SIZE
+#define NRF_LOG_MSGPOOL_CLASS_SIZE 36
+#endif
+
+// <o> NRF_LOG_MSGPOOL_CLASS_COUNT - Number of elements in the size class.
+#ifndef NRF_LOG_MSGPOOL_CLASS_COUNT
+#define NRF_LOG_MSGPOOL_CLASS_COUNT 8
+#endif
+
+// </e>
+
 // </h>
 //==========================================================
 
@@ -0,0 +1,5804 @@
+/**
+ * Copyright (c) 2018, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ * @defgroup lib_benchmark_example_main main.c
+ * @{
+ * @ingroup lib_benchmark_example
+ *
+ * @brief Host library benchmark application main file.
+ *
+ * This file contains a micro-benchmark suite for the core libraries built natively for the host.
+ * Each benchmark runs a fixed number of operations and reports the average latency of a single
+ * operation and, where it applies, the throughput. The results of the benchmarked code are
+ * checked against known values or reference implementations, and the benchmark stops with
+ * an error if a check fails.
+ *
+ */
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+
+#include "sdk_errors.h"
+#include "app_error.h"
+#include "app_util.h"
+#include "app_scheduler.h"
+#include "crc16.h"
+#include "crc32.h"
+#include "sha256.h"
+#include "nrf_queue.h"
+#include "nrf_atfifo.h"
+#include "nrf_balloc.h"
+#include "mem_manager.h"
+#include "nrf_ringbuf.h"
+#include "nrf_sortlist.h"
+#include "nrf_fstorage.h"
+#include "nrf_fstorage_ram.h"
+#include "fds.h"
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+#include "nrf_log_backend_interface.h"
+#include "nrf_log_backend_flash.h"
+#include "nrf_log_backend_serial.h"
+#include "nrf_log_str_formatter.h"
+#include "nrf_log_internal.h"
+#include "nrf_memobj.h"
+#include "ipv6_utils.h"
+#include "iot_errors.h"
+#include "coap_queue.h"
+#include "coap_resource.h"
+#include "coap_api.h"
+#include "coap_message.h"
+#include "coap_transport.h"
+#include "coap_observe_api.h"
+#include "rtc_sim.h"
+#include "app_timer.h"
+
+
+#define DATA_SIZE           4096    /**< Size of the data block used by the checksum benchmarks. */
+#define DATA_ROUNDS         2000    /**< Number of passes over the data block. */
+#define PACKET_SIZE         1280    /**< Size of the packet used by the IPv6 checksum benchmark. */
+#define CRC_CHECK_LENGTH    130     /**< Largest block length checked against the reference CRCs. */
+#define CHECKSUM_CHECK_SIZE 1536    /**< Size of the block used to check the IPv6 checksum. */
+#define CHECKSUM_CHECK_ROUNDS 100000 /**< Number of random blocks checked against the reference checksum. */
+#define ITEM_ROUNDS         1000000 /**< Number of operations for the container benchmarks. */
+#define ITEM_BATCH          8       /**< Number of items moved at once by the batch operations. */
+
+#define QUEUE_SIZE          64      /**< Number of elements in the queue and FIFO benchmarks. */
+#define ATFIFO_STATS_DEPTH  20      /**< Number of items held in the FIFO by the statistics check. */
+#define POOL_SIZE           64      /**< Number of blocks in the memory pool. */
+#define BALLOC_IRQ_POOL_SIZE 32     /**< Number of blocks in the pool shared by Thread Mode and interrupts. */
+#define BALLOC_IRQ_BLOCK_SIZE 16    /**< Size of the blocks in the pool shared by Thread Mode and interrupts. */
+#define BALLOC_IRQ_HELD_MAX 16      /**< Largest number of blocks held by a context, more than its share of the pool. */
+#define BALLOC_IRQ_ROUNDS   200000  /**< Number of allocations and frees in Thread Mode while interrupts use the pool. */
+#define BALLOC_IRQ_NESTED_MIN 100   /**< Number of times the high priority interrupt must preempt the low priority one. */
+#define BALLOC_IRQ_LOW_PERIOD  17000 /**< Period of the low priority interrupt in nanoseconds. */
+#define BALLOC_IRQ_HIGH_PERIOD 23000 /**< Period of the high priority interrupt in nanoseconds. */
+#define MEM_TRACE_OPS       500000  /**< Number of reserve and free operations in the memory manager trace. */
+#define MEM_LIVE_MAX        128     /**< Largest number of blocks held at once by the memory manager trace. */
+#define MEMOBJ_CHUNK_SIZE   16      /**< Size of a memory object chunk. */
+#define MEMOBJ_CHUNKS       32      /**< Number of memory object chunks. */
+#define MEMOBJ_SMALL_SIZE   20      /**< Size of the objects in the small size class. */
+#define MEMOBJ_SMALL_COUNT  8       /**< Number of objects in the small size class. */
+#define MEMOBJ_LARGE_SIZE   60      /**< Size of the objects in the large size class. */
+#define MEMOBJ_LARGE_COUNT  4       /**< Number of objects in the large size class. */
+#define MEMOBJ_SIZE_MAX     120     /**< Size of the largest memory object, which needs chunks. */
+#define MEMOBJ_LIVE_MAX     32      /**< Largest number of memory objects held at once. */
+#define MEMOBJ_OPS          200000  /**< Number of allocations and frees in the memory object check. */
+#define MEMOBJ_MSG_SIZE     20      /**< Size of the log message in the memory object benchmark. */
+#define RINGBUF_SIZE        1024    /**< Size of the ring buffer. */
+#define RINGBUF_MIRROR_SIZE 128     /**< Size of the mirror area of the mirrored ring buffer. */
+#define RINGBUF_RECORD_SIZE 100     /**< Size of the records which wrap around the ring buffer. */
+#define SORTLIST_SIZE       256     /**< Largest number of items in the sorted list. */
+#define SORTLIST_OPS        (ITEM_ROUNDS / 10) /**< Number of operations of each kind for each list size. */
+#define SCHED_EVENT_SIZE    8       /**< Size of the scheduler event data. */
+#define SCHED_QUEUE_SIZE    64      /**< Number of events in the scheduler queue. */
+#define SCHED_CHECK_OPS     200000  /**< Number of operations in the scheduler model check. */
+#define SCHED_MODEL_MAX     256     /**< Largest number of events queued at a priority level. */
+#define SCHED_HANDLER_TICKS 4       /**< Longest time taken by an event handler, plus one. */
+#define SCHED_DEADLINE_MAX  24      /**< Longest relative deadline of an event. */
+#define SCHED_TIME_START    0xFFFFF000 /**< Time at the start of the check, so that it wraps around. */
+#define SCHED_WEIGHT_ROUNDS 4       /**< Number of weighted dispatch rounds checked. */
+
+#define FS_SIZE             16384   /**< Size of the flash area used by the fstorage benchmark. */
+#define FS_ROUNDS           200     /**< Number of passes over the fstorage area. */
+#define FDS_FILE_ID         0x1111  /**< File ID of the records written by the FDS benchmark. */
+#define FDS_RECORD_WORDS    4       /**< Size of the records written by the FDS benchmark. */
+#define FDS_ROUNDS          20      /**< Number of fill, find and collect cycles. */
+#define FDS_MISS_LOOKUPS    100     /**< Number of lookups of a missing record per cycle. */
+#define FDS_FIND_KEYS       8       /**< Number of record keys written by the FDS search check. */
+#define FDS_FIND_COPIES     3       /**< Number of records with the same file ID and key in the search check. */
+#define FDS_BATCH_SIZE      8       /**< Number of records written by a batch. */
+#define FDS_RECORDS_MAX     ((FDS_VIRTUAL_PAGES * FDS_VIRTUAL_PAGE_SIZE) / FDS_RECORD_WORDS) /**< More records than fit in flash. */
+
+#define LOG_THREADS         4       /**< Number of threads which log concurrently. */
+#define LOG_ENTRIES         50000   /**< Number of log entries written by each thread. */
+#define LOG_ARGS_MAX        6       /**< Largest number of arguments of a log entry. */
+#define LOG_HEXDUMP_MAX     64      /**< Largest length of a hexdump log entry. */
+#define LOG_THREAD_POS      24      /**< Position of the thread number in the entry identifier. */
+#define LOG_PUSH_FMT        "id %08X" /**< Format of the strings pushed to the logger. */
+#define LOG_FLASH_ENTRIES   4000    /**< Number of entries which wrap the flash log ring several times. */
+#define LOG_FLASH_ROUNDS    40      /**< Number of times the flash log is read back while it is written. */
+#define LOG_FLASH_RESYNCS   4       /**< Number of reads from earlier tokens each time the flash log is read back. */
+#define LOG_FLASH_STALE_READERS 4   /**< Number of readers left at an entry while the ring wraps. */
+#define LOG_FLASH_SEEKS     1000    /**< Number of seeks by timestamp. */
+#define LOG_FLASH_CUTS      2000    /**< Number of flash operations interrupted by a failure or a reset. */
+#define LOG_FLASH_HEXDUMP_MAX 24    /**< Largest length of a hexdump written to the flash log. */
+#define LOG_FLASH_MARKER    0       /**< Identifier of the marker which starts a crash log. */
+#define LOG_FLASH_READ_MAX  4096    /**< Largest number of entries read back from the flash log. */
+#define LOG_FLASH_CHUNK_SIZE 16     /**< Size of the chunks of the entries passed to the flash log backend. */
+#define LOG_FLASH_CHUNKS    64      /**< Number of chunks, enough for the entries queued by both backends. */
+#define LOG_SERIAL_ENTRIES  5000    /**< Number of entries passed to the serial backend for each timestamp frequency. */
+#define LOG_SERIAL_BUF_SIZE 16      /**< Size of the serial backend output buffer. */
+#define LOG_SERIAL_OUT_MAX  1024    /**< Largest output of the serial backend for an entry. */
+#define LOG_SERIAL_HEXDUMP_MAX 40   /**< Largest length of a hexdump passed to the serial backend. */
+#define LOG_SERIAL_CHUNK_SIZE 16    /**< Size of the chunks of the entries passed to the serial backend. */
+#define LOG_SERIAL_CHUNKS   16      /**< Number of chunks, enough for the largest entry. */
+#define LOG_BIN_FRAME_END   0xC0    /**< SLIP frame end of binary log frames. */
+#define LOG_BIN_FRAME_ESC   0xDB    /**< SLIP escape of binary log frames. */
+#define LOG_BIN_FRAME_ESC_END 0xDC  /**< Escaped frame end. */
+#define LOG_BIN_FRAME_ESC_ESC 0xDD  /**< Escaped escape. */
+#define LOG_BIN_TYPE_STD    0       /**< Type of a binary frame of a standard entry. */
+#define LOG_BIN_ARG_UINT    0       /**< Argument sent as a varint. */
+#define LOG_BIN_ARG_INT     1       /**< Argument sent as a zigzag encoded varint. */
+#define LOG_BIN_ARG_STR     2       /**< Argument sent as a null terminated string. */
+#define LOG_BIN_HEXDUMP_LINE 8      /**< Number of bytes on a hexdump line. */
+
+#define COAP_QUEUE_OPS      1000000 /**< Number of operations in the CoAP queue model check. */
+#define COAP_MID_RANGE      64      /**< Range of the message IDs, small enough for lookups to hit. */
+#define COAP_TOKEN_LEN_MAX  2       /**< Largest token length, small enough for lookups to hit. */
+#define COAP_TIMEOUT_MAX    5       /**< Largest timeout in ticks. */
+#define COAP_WELL_KNOWN_SIZE 300    /**< Largest buffer size for .well-known/core checked. */
+#define COAP_PORT           5683    /**< Local CoAP port. */
+#define COAP_SEND_MESSAGES  20000   /**< Number of random messages sent by the CoAP send check. */
+#define COAP_OPT_LEN_MAX    20      /**< Largest length of a string option. */
+#define COAP_PAYLOAD_MAX    48      /**< Largest payload length. */
+#define COAP_SENT_MAX       512     /**< Largest datagram kept by the test transport. */
+#define COAP_NOTIFY_ROUNDS  20000   /**< Number of notify-all calls timed. */
+
+#define TIMER_COUNT         64      /**< Number of timers used by the timer trace. */
+#define TIMER_REPEAT_EVERY  4       /**< Every 4th timer is a repeated one. */
+#define TIMER_TRACE_OPS     100000  /**< Number of start and stop operations in the timer trace. */
+#define TIMER_IDLE_OPS      5000    /**< Number of operations between long idle periods. */
+#define TIMER_IDLE_TICKS    20000000 /**< Length of an idle period, longer than the counter range. */
+#define TIMER_TIMEOUT_MAX   (DRV_RTC_MAX_CNT - 1000) /**< Largest timeout plus slack accepted by app_timer. */
+
+/**@brief Macro for checking a result of the benchmarked code. */
+#define BENCH_CHECK(expr)   ((expr) ? (void)0 : check_failed(#expr, __LINE__))
+
+
+/**@brief Record of a single benchmark result. */
+typedef struct
+{
+    uint64_t start;     /**< Start time of the benchmark in nanoseconds. */
+    uint32_t ops;       /**< Number of operations performed. */
+    size_t   bytes;     /**< Number of bytes processed, or 0 if throughput does not apply. */
+} benchmark_t;
+
+/**@brief Item passed between threads through the atomic FIFO. */
+typedef struct
+{
+    uint32_t seq;       /**< Sequence number. */
+    uint32_t check;     /**< Value derived from the sequence number, to detect torn items. */
+} fifo_item_t;
+
+/**@brief Operation of the timer trace. */
+typedef struct
+{
+    uint32_t delay;     /**< Number of RTC ticks which pass before the operation. */
+    uint32_t timeout;   /**< Timeout in RTC ticks, or 0 if the timer is stopped. */
+    uint32_t slack;     /**< Slack in RTC ticks. */
+    uint32_t timer;     /**< Index of the timer. */
+} timer_op_t;
+
+/**@brief Expected behavior of a timer in the timer trace. */
+typedef struct
+{
+    uint32_t expected;  /**< RTC counter value at which the timer is due. */
+    uint32_t slack;     /**< Number of ticks the expiry may be late by. */
+    uint32_t period;    /**< Repeat period, or 0 for a single shot timer. */
+    bool     running;   /**< The timer is started and has not expired or been stopped. */
+} timer_state_t;
+
+/**@brief Expected state of a CoAP queue slot. */
+typedef struct
+{
+    coap_queue_item_t * p_item;     /**< Item in the queue, kept after removal. */
+    uint32_t            ticks;      /**< Number of ticks until the item expires. */
+    uint16_t            mid;        /**< Message ID. */
+    uint8_t             token_len;  /**< Token length. */
+    uint8_t             token[8];   /**< Token value. */
+    bool                queued;     /**< The item is in the queue. */
+} coap_queue_model_t;
+
+/**@brief Datagram sent by the CoAP test transport. */
+typedef struct
+{
+    coap_remote_t remote;               /**< Remote the datagram was sent to. */
+    uint16_t      len;                  /**< Length of the datagram. */
+    uint8_t       data[COAP_SENT_MAX];  /**< Datagram. */
+} coap_datagram_t;
+
+/**@brief Blocks held by an execution context in the block allocator context check. */
+typedef struct
+{
+    void   * p_blocks[BALLOC_IRQ_HELD_MAX]; /**< Blocks held. */
+    uint32_t count;                         /**< Number of blocks held. */
+    uint32_t held_max;                      /**< Largest number of blocks held at once. */
+    uint32_t rand;                          /**< State of the random numbers of the context. */
+    uint32_t runs;                          /**< Number of times the context ran. */
+} balloc_context_t;
+
+/**@brief Sorted list item carrying a key. */
+typedef struct
+{
+    nrf_sortlist_item_t item;
+    uint32_t            key;
+} sortlist_entry_t;
+
+/**@brief Event in the scheduler model. */
+typedef struct
+{
+    uint8_t * p_data;       /**< Event data in the scheduler queue. */
+    uint32_t  id;           /**< Event number, from which the data is derived. */
+    uint32_t  timestamp;    /**< Time at which the event was reserved. */
+    uint32_t  deadline;     /**< Time by which the event must be executed, or 0 if none. */
+    uint16_t  size;         /**< Size of the event data. */
+    bool      committed;    /**< The event was committed. */
+} sched_model_event_t;
+
+/**@brief Events of a priority level in the scheduler model, oldest first. */
+typedef struct
+{
+    sched_model_event_t events[SCHED_MODEL_MAX];
+    uint32_t            head;   /**< Index of the oldest event. */
+    uint32_t            count;  /**< Number of events. */
+} sched_model_queue_t;
+
+/**@brief Format string of the serial backend check. */
+typedef struct
+{
+    char const * p_fmt;     /**< Format string. */
+    char const * p_args;    /**< Kind of each argument, one character per argument. */
+} log_serial_fmt_t;
+
+/**@brief Text decoded from a binary log frame. */
+typedef struct
+{
+    char     text[LOG_SERIAL_OUT_MAX];  /**< Decoded text. */
+    uint32_t len;                       /**< Length of the decoded text. */
+} log_bin_out_t;
+
+/**@brief Reader of a binary log frame. */
+typedef struct
+{
+    uint8_t const * p_data; /**< Frame without SLIP encoding. */
+    uint32_t        len;    /**< Length of the frame. */
+    uint32_t        idx;    /**< Position of the next byte. */
+    bool            error;  /**< The frame ended early or holds a malformed field. */
+} log_bin_reader_t;
+
+/**@brief Conversion specification of a format string. */
+typedef struct
+{
+    char flags[4];          /**< Flags. */
+    char width[8];          /**< Field width, empty if none. */
+    char precision[8];      /**< Precision, empty if none. */
+    bool width_arg;         /**< The field width is taken from the arguments. */
+    char conversion;        /**< Conversion character. */
+} log_bin_spec_t;
+
+/**@brief Decoded argument of a standard entry. */
+typedef struct
+{
+    int64_t      value;     /**< Value of a numeric argument. */
+    char const * p_str;     /**< Value of a string argument. */
+} log_bin_arg_t;
+
+
+NRF_QUEUE_DEF(uint32_t, m_queue, QUEUE_SIZE, NRF_QUEUE_MODE_NO_OVERFLOW);
+NRF_QUEUE_DEF(uint32_t, m_queue_spsc, QUEUE_SIZE, NRF_QUEUE_MODE_SPSC);
+NRF_ATFIFO_DEF(m_fifo, uint32_t, QUEUE_SIZE);
+NRF_ATFIFO_DEF(m_fifo_threads, fifo_item_t, QUEUE_SIZE);
+NRF_BALLOC_DEF(m_pool, 32, POOL_SIZE);
+NRF_BALLOC_DEF(m_pool_irq, BALLOC_IRQ_BLOCK_SIZE, BALLOC_IRQ_POOL_SIZE);
+NRF_MEMOBJ_CLASS_DEF(m_memobj_small, MEMOBJ_SMALL_SIZE, MEMOBJ_SMALL_COUNT);
+NRF_MEMOBJ_CLASS_DEF(m_memobj_large, MEMOBJ_LARGE_SIZE, MEMOBJ_LARGE_COUNT);
+NRF_MEMOBJ_POOL_ARENA_DEF(m_memobj_arena, MEMOBJ_CHUNK_SIZE, MEMOBJ_CHUNKS,
+                          &m_memobj_small, &m_memobj_large);
+NRF_MEMOBJ_POOL_DEF(m_memobj_chunks, MEMOBJ_CHUNK_SIZE, MEMOBJ_CHUNKS);
+NRF_RINGBUF_DEF(m_ringbuf, RINGBUF_SIZE);
+NRF_RINGBUF_MIRRORED_DEF(m_ringbuf_mirrored, RINGBUF_SIZE, RINGBUF_MIRROR_SIZE);
+
+
+static bool sortlist_compare(nrf_sortlist_item_t * p_item0, nrf_sortlist_item_t * p_item1)
+{
+    sortlist_entry_t * p_entry0 = CONTAINER_OF(p_item0, sortlist_entry_t, item);
+    sortlist_entry_t * p_entry1 = CONTAINER_OF(p_item1, sortlist_entry_t, item);
+
+    return p_entry0->key < p_entry1->key;
+}
+
+NRF_SORTLIST_DEF(m_sortlist, sortlist_compare);
+
+
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt);
+
+NRF_FSTORAGE_DEF(nrf_fstorage_t m_bench_fs) =
+{
+    .evt_handler = fs_evt_handler,
+};
+
+
+static uint8_t           m_data[DATA_SIZE];
+static sortlist_entry_t  m_sortlist_entries[SORTLIST_SIZE];
+static uint32_t volatile m_sink;            /**< Keeps results of the benchmarked code alive. */
+static uint32_t volatile m_fs_pending;      /**< Number of fstorage operations in progress. */
+static uint32_t volatile m_fds_pending;     /**< Number of FDS operations in progress. */
+static bool     volatile m_fds_initialized;
+static uint32_t volatile m_fds_gc_events;   /**< Number of FDS_EVT_GC events received. */
+static ret_code_t        m_fds_result;      /**< Result expected in FDS events. */
+static fds_evt_t         m_fds_evt;         /**< Last FDS event received. */
+
+/* The timers are not defined with APP_TIMER_DEF, as an array of them is needed and the log
+ * instances which it registers are not used. */
+static app_timer_t       m_timers[TIMER_COUNT];
+static timer_state_t     m_timer_states[TIMER_COUNT];
+static timer_op_t        m_timer_trace[TIMER_TRACE_OPS];
+static uint32_t          m_timer_expirations;
+static uint32_t          m_rand;            /**< State of the pseudo-random generator. */
+static coap_queue_model_t m_coap_queue_model[COAP_MESSAGE_QUEUE_SIZE];
+static sched_model_queue_t    m_sched_model[APP_SCHEDULER_PRIORITY_LEVELS];
+static app_sched_prio_stats_t m_sched_stats[APP_SCHEDULER_PRIORITY_LEVELS]; /**< Statistics counted by the scheduler model. */
+static uint8_t                m_sched_credits[APP_SCHEDULER_PRIORITY_LEVELS]; /**< Weighted dispatch shares left in the model. */
+static uint32_t               m_sched_now;  /**< Time of the scheduler check. */
+static uint32_t               m_sched_id;   /**< Number of events scheduled by the scheduler check. */
+#if APP_SCHEDULER_WEIGHTED_DISPATCH
+static uint8_t                m_sched_order[(1 << APP_SCHEDULER_PRIORITY_LEVELS) * SCHED_WEIGHT_ROUNDS]; /**< Priorities of executed events. */
+#endif
+
+/**@brief Names of the CoAP resources. Some are prefixes of others. The first one is the root. */
+static char const * const m_coap_resource_names[] =
+{
+    "", "lights", "light", "temp", "led1", "led2", "sub", "lightsx", "a"
+};
+
+/**@brief Index of the parent of each CoAP resource. */
+static uint8_t const m_coap_resource_parents[] =
+{
+    0, 0, 0, 0, 2, 2, 5, 0, 0
+};
+
+#define COAP_RESOURCES      ARRAY_SIZE(m_coap_resource_names)   /**< Number of CoAP resources. */
+
+static coap_resource_t m_coap_resources[COAP_RESOURCES];
+
+static coap_resource_t m_coap_observed[2];     /**< Resources observed in the CoAP notify check. */
+static coap_port_t     m_coap_port = {COAP_PORT};
+static coap_datagram_t m_coap_sent[COAP_OBSERVE_MAX_NUM_OBSERVERS]; /**< Datagrams sent since the count was cleared. */
+static uint32_t        m_coap_sent_count;       /**< Number of datagrams sent since the count was cleared. */
+static uint16_t        m_coap_fail_port;        /**< Remote port for which the transport fails to send, 0 if none. */
+static uint32_t        m_coap_writes;           /**< Number of datagrams sent from a CoAP buffer. */
+static uint32_t        m_coap_direct_writes;    /**< Number of datagrams encoded into the transport buffer. */
+static uint32_t        m_coap_responses;        /**< Number of response callbacks. */
+static uint32_t        m_coap_status;           /**< Status expected by the response callback. */
+
+
+void app_error_fault_handler(uint32_t id, uint32_t pc, uint32_t info)
+{
+    error_info_t const * p_info = (error_info_t const *)(uintptr_t)info;
+
+    if (id == NRF_FAULT_ID_SDK_ERROR)
+    {
+        fprintf(stderr, "Error 0x%04X at %s:%u\n",
+                (unsigned)p_info->err_code, p_info->p_file_name, (unsigned)p_info->line_num);
+    }
+    else
+    {
+        fprintf(stderr, "Fault 0x%08X\n", (unsigned)id);
+    }
+    abort();
+}
+
+
+/**@brief Function for stopping the benchmark when a result check has failed.
+ *
+ * @param[in] p_expr    The expression which did not hold.
+ * @param[in] line      Line number of the check.
+ */
+static void check_failed(char const * p_expr, uint32_t line)
+{
+    fprintf(stderr, "Check failed at %s:%u: %s\n", __FILE__, (unsigned)line, p_expr);
+    exit(EXIT_FAILURE);
+}
+
+
+/**@brief Function for getting the monotonic time in nanoseconds. */
+static uint64_t time_ns_get(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+
+/**@brief Function for getting a pseudo-random number. The sequence is the same in every run. */
+static uint32_t rand_get(void)
+{
+    m_rand = m_rand * 1103515245 + 12345;
+    return m_rand >> 8;
+}
+
+
+static void benchmark_start(benchmark_t * p_bench)
+{
+    p_bench->ops   = 0;
+    p_bench->bytes = 0;
+    p_bench->start = time_ns_get();
+}
+
+
+/**@brief Function for printing the result of a benchmark.
+ *
+ * @param[in] p_bench   Benchmark record.
+ * @param[in] p_name    Name of the benchmark.
+ */
+static void benchmark_end(benchmark_t const * p_bench, char const * p_name)
+{
+    uint64_t elapsed = time_ns_get() - p_bench->start;
+    double   ns_op   = (double)elapsed / (p_bench->ops ? p_bench->ops : 1);
+
+    if (p_bench->bytes != 0)
+    {
+        printf("%-32s %10.1f ns/op %10.1f MB/s\n",
+               p_name, ns_op, ((double)p_bench->bytes * 1000.0) / (double)elapsed);
+    }
+    else
+    {
+        printf("%-32s %10.1f ns/op\n", p_name, ns_op);
+    }
+}
+
+
+/**@brief Function for computing CRC-16/CCITT-FALSE one bit at a time, as a reference. */
+static uint16_t crc16_reference(uint8_t const * p_data, uint32_t size)
+{
+    uint16_t crc = 0xFFFF;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc ^= (uint16_t)(p_data[i] << 8);
+        for (uint32_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+
+/**@brief Function for computing CRC-32 one bit at a time, as a reference. */
+static uint32_t crc32_reference(uint8_t const * p_data, uint32_t size)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc ^= p_data[i];
+        for (uint32_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+
+/**@brief Function for checking the configured CRC implementations against the references.
+ *
+ * The table-driven implementations process several bytes at a time, so blocks of every length
+ * up to @ref CRC_CHECK_LENGTH are checked at every alignment, in one piece and split in two.
+ */
+static void crc_check(void)
+{
+    for (uint32_t offset = 0; offset < 8; offset++)
+    {
+        for (uint32_t length = 0; length <= CRC_CHECK_LENGTH; length++)
+        {
+            uint8_t const * p_block = &m_data[offset];
+            uint16_t const  crc16   = crc16_reference(p_block, length);
+            uint32_t const  crc32   = crc32_reference(p_block, length);
+            uint32_t const  split   = length / 3;
+            uint16_t        crc16_part;
+            uint32_t        crc32_part;
+
+            BENCH_CHECK(crc16_compute(p_block, length, NULL) == crc16);
+            BENCH_CHECK(crc32_compute(p_block, length, NULL) == crc32);
+
+            crc16_part = crc16_compute(p_block, split, NULL);
+            crc32_part = crc32_compute(p_block, split, NULL);
+            BENCH_CHECK(crc16_compute(&p_block[split], length - split, &crc16_part) == crc16);
+            BENCH_CHECK(crc32_compute(&p_block[split], length - split, &crc32_part) == crc32);
+        }
+    }
+}
+
+
+/**@brief Function for computing the IPv6 checksum two bytes at a time, as a reference.
+ *
+ * This is the implementation which @ref ipv6_checksum_calculate had before it summed whole words.
+ */
+static void checksum_reference(uint8_t const * p_data,
+                               uint16_t        len,
+                               uint16_t      * p_checksum,
+                               bool            flip_zero)
+{
+    uint16_t checksum_even = (((*p_checksum) & 0xFF00) >> 8);
+    uint16_t checksum_odd  = ((*p_checksum) & 0x00FF);
+
+    while (len)
+    {
+        if (len == 1)
+        {
+            checksum_even += (*p_data);
+            len           -= 1;
+        }
+        else
+        {
+            checksum_even += *p_data++;
+            checksum_odd  += *p_data++;
+            len           -= 2;
+        }
+
+        if (checksum_odd & 0xFF00)
+        {
+            checksum_even += ((checksum_odd & 0xFF00) >> 8);
+            checksum_odd   = (checksum_odd & 0x00FF);
+        }
+
+        if (checksum_even & 0xFF00)
+        {
+            checksum_odd += ((checksum_even & 0xFF00) >> 8);
+            checksum_even = (checksum_even & 0x00FF);
+        }
+    }
+
+    checksum_even = (checksum_even << 8) + (checksum_odd & 0xFFFF);
+
+    if (flip_zero && (checksum_even == 0xFFFF))
+    {
+        checksum_even = 0x0000;
+    }
+
+    (*p_checksum) = (uint16_t)(checksum_even);
+}
+
+
+/**@brief Function for checking the IPv6 checksum against the reference.
+ *
+ * Random blocks are checked at random alignments, starting from random partial sums. Some blocks
+ * are all zeros or all ones, where the carries and the ones' complement zero are handled.
+ * The incremental update is checked against summing the changed block again.
+ */
+static void checksum_check(void)
+{
+    uint8_t block[CHECKSUM_CHECK_SIZE];
+
+    m_rand = 1;
+    for (uint32_t i = 0; i < sizeof(block); i++)
+    {
+        block[i] = (uint8_t)rand_get();
+    }
+
+    for (uint32_t i = 0; i < CHECKSUM_CHECK_ROUNDS; i++)
+    {
+        uint32_t const offset    = rand_get() % 8;
+        uint32_t const length    = ((i % 10) == 0) ? (rand_get() % (sizeof(block) - 7))
+                                                   : (rand_get() % 300);
+        bool     const flip_zero = ((rand_get() % 2) == 0);
+        uint16_t       checksum  = (uint16_t)rand_get();
+        uint16_t       reference = checksum;
+
+        if ((i % 7) == 0)
+        {
+            memset(&block[offset], ((i % 14) == 0) ? 0x00 : 0xFF, length);
+            checksum = reference = ((i % 5) == 0) ? 0xFFFF : 0x0000;
+        }
+
+        ipv6_checksum_calculate(&block[offset], length, &checksum, flip_zero);
+        checksum_reference(&block[offset], length, &reference, flip_zero);
+        BENCH_CHECK(checksum == reference);
+
+        if ((i % 7) == 0)
+        {
+            for (uint32_t j = 0; j < length; j++)
+            {
+                block[offset + j] = (uint8_t)rand_get();
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < CHECKSUM_CHECK_ROUNDS / 10; i++)
+    {
+        uint8_t        old_data[CRC_CHECK_LENGTH];
+        uint32_t const length   = 2 + (rand_get() % (CRC_CHECK_LENGTH - 2));
+        uint32_t const position = (rand_get() % (length / 2)) * 2;
+        uint32_t const changed  = 1 + (rand_get() % (length - position));
+        uint16_t       sum      = 0;
+        uint16_t       checksum;
+
+        ipv6_checksum_calculate(block, length, &sum, false);
+        checksum = (uint16_t)~sum;
+
+        memcpy(old_data, &block[position], changed);
+        for (uint32_t j = 0; j < changed; j++)
+        {
+            block[position + j] = ((i % 3) == 0) ? 0xFF : (uint8_t)rand_get();
+        }
+        ipv6_checksum_update(old_data, &block[position], changed, &checksum);
+
+        /* 0x0000 and 0xFFFF are both zero in ones' complement arithmetic. */
+        sum = 0;
+        ipv6_checksum_calculate(block, length, &sum, false);
+        BENCH_CHECK((checksum == (uint16_t)~sum) ||
+                    (((checksum == 0x0000) || (checksum == 0xFFFF)) &&
+                     ((sum == 0x0000) || (sum == 0xFFFF))));
+    }
+}
+
+
+/**@brief Function for hashing a message given in pieces, starting at an unaligned address.
+ *
+ * @param[in]  p_pieces     Message pieces, hashed in order.
+ * @param[in]  count        Number of pieces.
+ * @param[in]  repeat       Number of times the message is repeated.
+ * @param[out] p_hash       Big-endian hash value.
+ */
+static void sha256_hash(char const * const * p_pieces,
+                        uint32_t             count,
+                        uint32_t             repeat,
+                        uint8_t            * p_hash)
+{
+    static uint8_t   buffer[1 + 128];
+    sha256_context_t ctx;
+
+    APP_ERROR_CHECK(sha256_init(&ctx));
+    for (uint32_t r = 0; r < repeat; r++)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            size_t const length = strlen(p_pieces[i]);
+
+            memcpy(&buffer[1], p_pieces[i], length);
+            APP_ERROR_CHECK(sha256_update(&ctx, &buffer[1], length));
+        }
+    }
+    APP_ERROR_CHECK(sha256_final(&ctx, p_hash, false));
+}
+
+
+/**@brief Function for checking SHA-256 against the FIPS 180-2 test vectors.
+ *
+ * The messages are also hashed in pieces which do not line up with the 64-byte blocks, so that
+ * both the buffered and the direct paths of @ref sha256_update are used.
+ */
+static void sha256_check(void)
+{
+    static char const * const empty[]   = { "" };
+    static char const * const abc[]     = { "a", "bc" };
+    static char const * const msg448[]  =
+    {
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+    };
+    static char const * const msg896[]  =
+    {
+        "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopq",
+        "klmnopqrlmnopqrsmnopqrstnopqrstu",
+    };
+    static char const * const msg_a[]   =
+    {
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+    };
+    static uint8_t const hash_empty[32] =
+    {
+        0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+        0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55,
+    };
+    static uint8_t const hash_abc[32] =
+    {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+        0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+    };
+    static uint8_t const hash_448[32] =
+    {
+        0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+        0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1,
+    };
+    static uint8_t const hash_896[32] =
+    {
+        0xcf, 0x5b, 0x16, 0xa7, 0x78, 0xaf, 0x83, 0x80, 0x03, 0x6c, 0xe5, 0x9e, 0x7b, 0x04, 0x92, 0x37,
+        0x0b, 0x24, 0x9b, 0x11, 0xe8, 0xf0, 0x7a, 0x51, 0xaf, 0xac, 0x45, 0x03, 0x7a, 0xfe, 0xe9, 0xd1,
+    };
+    static uint8_t const hash_million_a[32] =
+    {
+        0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+        0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e, 0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0,
+    };
+
+    uint8_t hash[32];
+
+    sha256_hash(empty, ARRAY_SIZE(empty), 1, hash);
+    BENCH_CHECK(memcmp(hash, hash_empty, sizeof(hash)) == 0);
+    sha256_hash(abc, ARRAY_SIZE(abc), 1, hash);
+    BENCH_CHECK(memcmp(hash, hash_abc, sizeof(hash)) == 0);
+    sha256_hash(msg448, ARRAY_SIZE(msg448), 1, hash);
+    BENCH_CHECK(memcmp(hash, hash_448, sizeof(hash)) == 0);
+    sha256_hash(msg896, ARRAY_SIZE(msg896), 1, hash);
+    BENCH_CHECK(memcmp(hash, hash_896, sizeof(hash)) == 0);
+    sha256_hash(msg_a, ARRAY_SIZE(msg_a), 10000, hash);
+    BENCH_CHECK(memcmp(hash, hash_million_a, sizeof(hash)) == 0);
+}
+
+
+static void crc_benchmark(void)
+{
+    static uint8_t const check_data[] = "123456789";
+
+    benchmark_t bench;
+    uint8_t     hash[32];
+
+    /* Check values of CRC-16/CCITT-FALSE and CRC-32. */
+    BENCH_CHECK(crc16_compute(check_data, sizeof(check_data) - 1, NULL) == 0x29B1);
+    BENCH_CHECK(crc32_compute(check_data, sizeof(check_data) - 1, NULL) == 0xCBF43926);
+
+    for (uint32_t i = 0; i < DATA_SIZE; i++)
+    {
+        m_data[i] = (uint8_t)(i * 7);
+    }
+
+    crc_check();
+    sha256_check();
+    checksum_check();
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < DATA_ROUNDS; i++)
+    {
+        m_sink = crc16_compute(m_data, DATA_SIZE, NULL);
+    }
+    bench.ops   = DATA_ROUNDS;
+    bench.bytes = (size_t)DATA_ROUNDS * DATA_SIZE;
+    benchmark_end(&bench, "crc16_compute (4 kB)");
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < DATA_ROUNDS; i++)
+    {
+        m_sink = crc32_compute(m_data, DATA_SIZE, NULL);
+    }
+    bench.ops   = DATA_ROUNDS;
+    bench.bytes = (size_t)DATA_ROUNDS * DATA_SIZE;
+    benchmark_end(&bench, "crc32_compute (4 kB)");
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < DATA_ROUNDS / 10; i++)
+    {
+        sha256_context_t ctx;
+
+        APP_ERROR_CHECK(sha256_init(&ctx));
+        APP_ERROR_CHECK(sha256_update(&ctx, m_data, DATA_SIZE));
+        APP_ERROR_CHECK(sha256_final(&ctx, hash, false));
+        m_sink = hash[0];
+    }
+    bench.ops   = DATA_ROUNDS / 10;
+    bench.bytes = (size_t)(DATA_ROUNDS / 10) * DATA_SIZE;
+    benchmark_end(&bench, "sha256 (4 kB)");
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < DATA_ROUNDS * 10; i++)
+    {
+        uint16_t checksum = 0;
+
+        ipv6_checksum_calculate(m_data, PACKET_SIZE, &checksum, false);
+        m_sink = checksum;
+    }
+    bench.ops   = DATA_ROUNDS * 10;
+    bench.bytes = (size_t)DATA_ROUNDS * 10 * PACKET_SIZE;
+    benchmark_end(&bench, "ipv6_checksum_calculate (1280B)");
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < DATA_ROUNDS * 10; i++)
+    {
+        uint16_t checksum = 0;
+
+        /* Unaligned start, as for a payload following an odd length header. */
+        ipv6_checksum_calculate(&m_data[1], PACKET_SIZE, &checksum, false);
+        m_sink = checksum;
+    }
+    bench.ops   = DATA_ROUNDS * 10;
+    bench.bytes = (size_t)DATA_ROUNDS * 10 * PACKET_SIZE;
+    benchmark_end(&bench, "ipv6_checksum_calculate (+1)");
+}
+
+
+static void queue_benchmark(void)
+{
+    benchmark_t bench;
+    uint32_t    batch[ITEM_BATCH] = {0};
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS; i++)
+    {
+        uint32_t value = i;
+
+        APP_ERROR_CHECK(nrf_queue_push(&m_queue, &value));
+        APP_ERROR_CHECK(nrf_queue_pop(&m_queue, &value));
+        BENCH_CHECK(value == i);
+        m_sink = value;
+    }
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, "nrf_queue push+pop");
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS; i++)
+    {
+        uint32_t value = i;
+
+        APP_ERROR_CHECK(nrf_queue_push(&m_queue_spsc, &value));
+        APP_ERROR_CHECK(nrf_queue_pop(&m_queue_spsc, &value));
+        BENCH_CHECK(value == i);
+        m_sink = value;
+    }
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, "nrf_queue push+pop (SPSC)");
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS / ITEM_BATCH; i++)
+    {
+        batch[0] = i;
+        APP_ERROR_CHECK(nrf_queue_write(&m_queue, batch, ITEM_BATCH));
+        batch[0] = 0;
+        APP_ERROR_CHECK(nrf_queue_read(&m_queue, batch, ITEM_BATCH));
+        BENCH_CHECK(batch[0] == i);
+    }
+    bench.ops   = ITEM_ROUNDS;
+    bench.bytes = (size_t)ITEM_ROUNDS * sizeof(uint32_t);
+    benchmark_end(&bench, "nrf_queue write+read (x8)");
+}
+
+
+static void atfifo_benchmark(void)
+{
+    benchmark_t bench;
+
+    APP_ERROR_CHECK(NRF_ATFIFO_INIT(m_fifo));
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS; i++)
+    {
+        uint32_t value = i;
+
+        APP_ERROR_CHECK(nrf_atfifo_alloc_put(m_fifo, &value, sizeof(value), NULL));
+        APP_ERROR_CHECK(nrf_atfifo_get_free(m_fifo, &value, sizeof(value), NULL));
+        BENCH_CHECK(value == i);
+        m_sink = value;
+    }
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, "nrf_atfifo alloc_put+get_free");
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS / ITEM_BATCH; i++)
+    {
+        nrf_atfifo_item_put_t put_ctx;
+        nrf_atfifo_item_get_t get_ctx;
+        size_t                count = ITEM_BATCH;
+        uint32_t            * p_items;
+
+        while ((p_items = nrf_atfifo_items_alloc(m_fifo, ITEM_BATCH, &put_ctx)) == NULL)
+        {
+            /* Batch does not fit before the end of the buffer, pass single items to wrap around. */
+            uint32_t value = i;
+
+            APP_ERROR_CHECK(nrf_atfifo_alloc_put(m_fifo, &value, sizeof(value), NULL));
+            APP_ERROR_CHECK(nrf_atfifo_get_free(m_fifo, &value, sizeof(value), NULL));
+            BENCH_CHECK(value == i);
+        }
+        for (uint32_t j = 0; j < ITEM_BATCH; j++)
+        {
+            p_items[j] = i + j;
+        }
+        (void)nrf_atfifo_item_put(m_fifo, &put_ctx);
+
+        p_items = nrf_atfifo_items_get(m_fifo, &count, &get_ctx);
+        BENCH_CHECK((count == ITEM_BATCH) && (p_items[0] == i) && (p_items[count - 1] == i + count - 1));
+        m_sink  = p_items[count - 1];
+        (void)nrf_atfifo_item_free(m_fifo, &get_ctx);
+    }
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, "nrf_atfifo items_alloc+get (x8)");
+}
+
+
+/**@brief Function for writing items to the FIFO of the threaded benchmark, in batches of
+ *        1 to @ref ITEM_BATCH items. */
+static void * fifo_producer_thread(void * p_arg)
+{
+    uint32_t seq = 0;
+
+    (void)p_arg;
+    while (seq < ITEM_ROUNDS)
+    {
+        nrf_atfifo_item_put_t put_ctx;
+        size_t                count   = MIN(1 + (seq % ITEM_BATCH), ITEM_ROUNDS - seq);
+        fifo_item_t         * p_items = nrf_atfifo_items_alloc(m_fifo_threads, count, &put_ctx);
+
+        if (p_items == NULL)
+        {
+            /* Full, or the batch does not fit before the end of the buffer. */
+            count   = 1;
+            p_items = nrf_atfifo_item_alloc(m_fifo_threads, &put_ctx);
+        }
+        if (p_items == NULL)
+        {
+            (void)sched_yield();
+            continue;
+        }
+
+        for (size_t i = 0; i < count; i++, seq++)
+        {
+            p_items[i].seq   = seq;
+            p_items[i].check = ~seq * 2654435761U;
+        }
+        BENCH_CHECK(nrf_atfifo_item_put(m_fifo_threads, &put_ctx));
+    }
+    return NULL;
+}
+
+
+/**@brief Function for checking that the items written by another thread come whole and in order.
+ *
+ * The producer and the consumer run in different threads, so the FIFO is accessed concurrently
+ * and not only from nested contexts. The exclusive access instructions are emulated with atomic
+ * compare-and-swap operations of the host, see nrf_host.h.
+ */
+static void atfifo_thread_check(void)
+{
+    benchmark_t bench;
+    pthread_t   producer;
+    uint32_t    seq = 0;
+
+    APP_ERROR_CHECK(NRF_ATFIFO_INIT(m_fifo_threads));
+
+    benchmark_start(&bench);
+    BENCH_CHECK(pthread_create(&producer, NULL, fifo_producer_thread, NULL) == 0);
+    while (seq < ITEM_ROUNDS)
+    {
+        nrf_atfifo_item_get_t get_ctx;
+        size_t                count   = ITEM_BATCH;
+        fifo_item_t         * p_items = nrf_atfifo_items_get(m_fifo_threads, &count, &get_ctx);
+
+        if (p_items == NULL)
+        {
+            (void)sched_yield();
+            continue;
+        }
+
+        BENCH_CHECK((count >= 1) && (count <= ITEM_BATCH));
+        for (size_t i = 0; i < count; i++, seq++)
+        {
+            BENCH_CHECK(p_items[i].seq == seq);
+            BENCH_CHECK(p_items[i].check == ~seq * 2654435761U);
+        }
+        BENCH_CHECK(nrf_atfifo_item_free(m_fifo_threads, &get_ctx));
+    }
+    BENCH_CHECK(pthread_join(producer, NULL) == 0);
+    BENCH_CHECK(nrf_atfifo_item_get(m_fifo_threads, &(nrf_atfifo_item_get_t){0}) == NULL);
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, "nrf_atfifo 2 threads (x1-8)");
+}
+
+
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED
+/**@brief Function for checking the highest number of items used, as reported by the FIFO
+ *        statistics.
+ *
+ * The FIFO is filled to a known depth, partly drained and refilled below that depth, and then
+ * filled completely. Items which are allocated but not put yet, or read but not freed yet, also
+ * count as used.
+ */
+static void atfifo_stats_check(void)
+{
+    nrf_atfifo_stats_t    stats;
+    nrf_atfifo_item_put_t put_ctx;
+    uint32_t              put = 0;
+    uint32_t              got = 0;
+    nrf_atfifo_item_get_t get_ctx;
+    size_t                count = ITEM_BATCH;
+    uint32_t              capacity;
+    uint32_t              value;
+
+    APP_ERROR_CHECK(NRF_ATFIFO_INIT(m_fifo));
+    nrf_atfifo_stats_get(m_fifo, &stats);
+    BENCH_CHECK((stats.max_used == 0) && (stats.wr_contended == 0) && (stats.rd_contended == 0));
+
+    for (; put < ATFIFO_STATS_DEPTH; put++)
+    {
+        APP_ERROR_CHECK(nrf_atfifo_alloc_put(m_fifo, &put, sizeof(put), NULL));
+    }
+    nrf_atfifo_stats_get(m_fifo, &stats);
+    BENCH_CHECK(stats.max_used == ATFIFO_STATS_DEPTH);
+
+    for (; got < ATFIFO_STATS_DEPTH / 2; got++)
+    {
+        APP_ERROR_CHECK(nrf_atfifo_get_free(m_fifo, &value, sizeof(value), NULL));
+        BENCH_CHECK(value == got);
+    }
+    for (; put < ATFIFO_STATS_DEPTH + (ATFIFO_STATS_DEPTH / 2) - 1; put++)
+    {
+        APP_ERROR_CHECK(nrf_atfifo_alloc_put(m_fifo, &put, sizeof(put), NULL));
+    }
+    nrf_atfifo_stats_get(m_fifo, &stats);
+    BENCH_CHECK(stats.max_used == ATFIFO_STATS_DEPTH);
+
+    while (nrf_atfifo_alloc_put(m_fifo, &put, sizeof(put), NULL) == NRF_SUCCESS)
+    {
+        put++;
+    }
+    capacity = put - got;
+    nrf_atfifo_stats_get(m_fifo, &stats);
+    BENCH_CHECK((stats.max_used == capacity) && (capacity <= QUEUE_SIZE));
+
+    for (; got < put; got++)
+    {
+        APP_ERROR_CHECK(nrf_atfifo_get_free(m_fifo, &value, sizeof(value), NULL));
+        BENCH_CHECK(value == got);
+    }
+    BENCH_CHECK(nrf_atfifo_get_free(m_fifo, &value, sizeof(value), NULL) == NRF_ERROR_NOT_FOUND);
+
+    nrf_atfifo_stats_reset(m_fifo);
+    nrf_atfifo_stats_get(m_fifo, &stats);
+    BENCH_CHECK(stats.max_used == 0);
+    BENCH_CHECK(nrf_atfifo_items_alloc(m_fifo, ITEM_BATCH, &put_ctx) != NULL);
+    nrf_atfifo_stats_get(m_fifo, &stats);
+    BENCH_CHECK(stats.max_used == ITEM_BATCH);
+    (void)nrf_atfifo_item_put(m_fifo, &put_ctx);
+
+    /* Items read but not freed yet also count as used. */
+    BENCH_CHECK(nrf_atfifo_items_get(m_fifo, &count, &get_ctx) != NULL);
+    BENCH_CHECK(count == ITEM_BATCH);
+    for (uint32_t i = 0; i < ATFIFO_STATS_DEPTH / 2; i++)
+    {
+        APP_ERROR_CHECK(nrf_atfifo_alloc_put(m_fifo, &i, sizeof(i), NULL));
+    }
+    nrf_atfifo_stats_get(m_fifo, &stats);
+    BENCH_CHECK(stats.max_used == ITEM_BATCH + (ATFIFO_STATS_DEPTH / 2));
+    BENCH_CHECK(nrf_atfifo_item_free(m_fifo, &get_ctx));
+    APP_ERROR_CHECK(nrf_atfifo_clear(m_fifo));
+
+    /* The threaded check never holds more items than the FIFO has room for. */
+    nrf_atfifo_stats_get(m_fifo_threads, &stats);
+    BENCH_CHECK((stats.max_used >= 1) && (stats.max_used <= capacity));
+}
+#endif // NRF_ATFIFO_CONFIG_STATS_ENABLED
+
+
+static void balloc_benchmark(void)
+{
+    benchmark_t bench;
+    void      * p_blocks[ITEM_BATCH];
+
+    APP_ERROR_CHECK(nrf_balloc_init(&m_pool));
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS / ITEM_BATCH; i++)
+    {
+        for (uint32_t j = 0; j < ITEM_BATCH; j++)
+        {
+            p_blocks[j] = nrf_balloc_alloc(&m_pool);
+            BENCH_CHECK((p_blocks[j] != NULL) && ((j == 0) || (p_blocks[j] != p_blocks[j - 1])));
+        }
+        for (uint32_t j = 0; j < ITEM_BATCH; j++)
+        {
+            nrf_balloc_free(&m_pool, p_blocks[j]);
+        }
+    }
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, "nrf_balloc alloc+free");
+}
+
+
+
+/**@brief Execution contexts of the block allocator context check: Thread Mode, then the low and
+ *        the high priority interrupt.
+ */
+static balloc_context_t m_balloc_contexts[3] =
+{
+    {.held_max = BALLOC_IRQ_HELD_MAX,     .rand = 1},
+    {.held_max = BALLOC_IRQ_HELD_MAX * 3 / 4, .rand = 2},
+    {.held_max = BALLOC_IRQ_HELD_MAX / 2,     .rand = 3},
+};
+
+static uint8_t           m_balloc_owner[BALLOC_IRQ_POOL_SIZE]; /**< Context holding each block, plus 1. */
+static volatile bool     m_balloc_low_active;   /**< The low priority interrupt handler runs. */
+static volatile uint32_t m_balloc_nested;       /**< Number of times the low priority handler was preempted. */
+
+
+/**@brief Function for getting the index of a block in the pool shared with interrupts. */
+static uint32_t balloc_irq_idx_get(void const * p_block)
+{
+    size_t offset = (size_t)((uint8_t const *)p_block - (uint8_t const *)m_pool_irq.p_memory_begin);
+
+    BENCH_CHECK((offset % m_pool_irq.block_size) == 0);
+    BENCH_CHECK((offset / m_pool_irq.block_size) < BALLOC_IRQ_POOL_SIZE);
+    return offset / m_pool_irq.block_size;
+}
+
+
+/**@brief Function for allocating or freeing a block of the pool shared with interrupts.
+ *
+ * Every block is marked with the context which holds it, so a block which is handed out twice is
+ * detected when it is allocated and when it is freed.
+ *
+ * @param[in] context   Index of the running context.
+ */
+static void balloc_context_step(uint32_t context)
+{
+    balloc_context_t * p_ctx = &m_balloc_contexts[context];
+    uint8_t            tag   = (uint8_t)(context + 1);
+
+    p_ctx->rand = (p_ctx->rand * 1103515245UL) + 12345UL;
+    if ((p_ctx->count == 0) || ((p_ctx->count < p_ctx->held_max) && ((p_ctx->rand >> 16) & 1)))
+    {
+        uint8_t * p_block = nrf_balloc_alloc(&m_pool_irq);
+
+        if (p_block != NULL)
+        {
+            BENCH_CHECK(__atomic_exchange_n(&m_balloc_owner[balloc_irq_idx_get(p_block)], tag,
+                                            __ATOMIC_SEQ_CST) == 0);
+            memset(p_block, tag, BALLOC_IRQ_BLOCK_SIZE);
+            p_ctx->p_blocks[p_ctx->count++] = p_block;
+        }
+    }
+    else
+    {
+        uint32_t  i       = (p_ctx->rand >> 18) % p_ctx->count;
+        uint8_t * p_block = p_ctx->p_blocks[i];
+
+        for (uint32_t j = 0; j < BALLOC_IRQ_BLOCK_SIZE; j++)
+        {
+            BENCH_CHECK(p_block[j] == tag);
+        }
+        BENCH_CHECK(__atomic_exchange_n(&m_balloc_owner[balloc_irq_idx_get(p_block)], 0,
+                                        __ATOMIC_SEQ_CST) == tag);
+        p_ctx->p_blocks[i] = p_ctx->p_blocks[--p_ctx->count];
+        nrf_balloc_free(&m_pool_irq, p_block);
+    }
+}
+
+
+/**@brief Function for handling the low priority interrupt of the block allocator context check. */
+static void balloc_irq_low_handler(void)
+{
+    m_balloc_low_active = true;
+    m_balloc_contexts[1].runs++;
+    for (uint32_t i = 0; i < 1 + (m_balloc_contexts[1].rand >> 28); i++)
+    {
+        balloc_context_step(1);
+    }
+    m_balloc_low_active = false;
+}
+
+
+/**@brief Function for handling the high priority interrupt of the block allocator context check. */
+static void balloc_irq_high_handler(void)
+{
+    if (m_balloc_low_active)
+    {
+        m_balloc_nested++;
+    }
+    m_balloc_contexts[2].runs++;
+    balloc_context_step(2);
+    balloc_context_step(2);
+}
+
+
+/**@brief Function for starting a timer which triggers an interrupt emulated with a signal.
+ *
+ * @param[out] p_timer  Timer.
+ * @param[in]  signo    Signal of the interrupt.
+ * @param[in]  period   Period in nanoseconds.
+ */
+static void balloc_irq_timer_start(timer_t * p_timer, int signo, long period)
+{
+    struct sigevent   event = {.sigev_notify = SIGEV_SIGNAL, .sigev_signo = signo};
+    struct itimerspec spec  = {.it_interval = {0, period}, .it_value = {0, period}};
+
+    BENCH_CHECK(timer_create(CLOCK_MONOTONIC, &event, p_timer) == 0);
+    BENCH_CHECK(timer_settime(*p_timer, 0, &spec, NULL) == 0);
+}
+
+
+/**@brief Function for checking that no block is lost or handed out twice when the pool is used by
+ *        Thread Mode and by nested interrupts.
+ *
+ * The interrupts are emulated with signals sent by timers, so they preempt Thread Mode and the
+ * low priority interrupt at any point, also inside the allocator. Every context holds more blocks than its share of the pool, so the
+ * pool runs out and blocks cached by other contexts are used.
+ */
+static void balloc_context_check(void)
+{
+    timer_t   timers[2];
+    uint32_t  rounds;
+    void    * p_blocks[BALLOC_IRQ_POOL_SIZE];
+
+    APP_ERROR_CHECK(nrf_balloc_init(&m_pool_irq));
+    NVIC_SetPriority(0, APP_IRQ_PRIORITY_LOW);
+    NVIC_SetPriority(1, APP_IRQ_PRIORITY_HIGH);
+    nrf_host_irq_connect(0, SIGUSR1, balloc_irq_low_handler);
+    nrf_host_irq_connect(1, SIGUSR2, balloc_irq_high_handler);
+
+    balloc_irq_timer_start(&timers[0], SIGUSR1, BALLOC_IRQ_LOW_PERIOD);
+    balloc_irq_timer_start(&timers[1], SIGUSR2, BALLOC_IRQ_HIGH_PERIOD);
+    for (rounds = 0; (rounds < BALLOC_IRQ_ROUNDS) || (m_balloc_nested < BALLOC_IRQ_NESTED_MIN);
+         rounds++)
+    {
+        BENCH_CHECK(rounds < BALLOC_IRQ_ROUNDS * 100);
+        balloc_context_step(0);
+    }
+    BENCH_CHECK(timer_delete(timers[0]) == 0);
+    BENCH_CHECK(timer_delete(timers[1]) == 0);
+    nrf_host_irq_disconnect();
+
+    /* Blocks held by the interrupts are freed in Thread Mode, as if they were passed to it. */
+    for (uint32_t context = 0; context < ARRAY_SIZE(m_balloc_contexts); context++)
+    {
+        balloc_context_t * p_ctx = &m_balloc_contexts[context];
+
+        BENCH_CHECK(p_ctx->runs != 0 || context == 0);
+        while (p_ctx->count != 0)
+        {
+            void * p_block = p_ctx->p_blocks[--p_ctx->count];
+
+            BENCH_CHECK(__atomic_exchange_n(&m_balloc_owner[balloc_irq_idx_get(p_block)], 0,
+                                            __ATOMIC_SEQ_CST) == context + 1);
+            nrf_balloc_free(&m_pool_irq, p_block);
+        }
+    }
+    BENCH_CHECK(nrf_balloc_utilization_get(&m_pool_irq) == 0);
+    BENCH_CHECK(nrf_balloc_max_utilization_get(&m_pool_irq) == BALLOC_IRQ_POOL_SIZE);
+
+    /* Every block must come back, also the ones cached for other contexts, and only once. */
+    for (uint32_t i = 0; i < BALLOC_IRQ_POOL_SIZE; i++)
+    {
+        p_blocks[i] = nrf_balloc_alloc(&m_pool_irq);
+        BENCH_CHECK(p_blocks[i] != NULL);
+        BENCH_CHECK(m_balloc_owner[balloc_irq_idx_get(p_blocks[i])]++ == 0);
+    }
+    BENCH_CHECK(nrf_balloc_alloc(&m_pool_irq) == NULL);
+    for (uint32_t i = 0; i < BALLOC_IRQ_POOL_SIZE; i++)
+    {
+        m_balloc_owner[balloc_irq_idx_get(p_blocks[i])] = 0;
+        nrf_balloc_free(&m_pool_irq, p_blocks[i]);
+    }
+
+    printf("%-32s %10u irqs %u nested\n", "nrf_balloc Thread Mode + 2 irqs",
+           (unsigned)(m_balloc_contexts[1].runs + m_balloc_contexts[2].runs),
+           (unsigned)m_balloc_nested);
+}
+
+
+/**@brief Block sizes of the memory manager categories, from the smallest one. */
+static uint32_t const m_mem_block_size[] =
+{
+    MEMORY_MANAGER_XXSMALL_BLOCK_SIZE, MEMORY_MANAGER_XSMALL_BLOCK_SIZE,
+    MEMORY_MANAGER_SMALL_BLOCK_SIZE,   MEMORY_MANAGER_MEDIUM_BLOCK_SIZE,
+    MEMORY_MANAGER_LARGE_BLOCK_SIZE,   MEMORY_MANAGER_XLARGE_BLOCK_SIZE,
+    MEMORY_MANAGER_XXLARGE_BLOCK_SIZE
+};
+
+/**@brief Block counts of the memory manager categories, from the smallest one. */
+static uint32_t const m_mem_block_count[] =
+{
+    MEMORY_MANAGER_XXSMALL_BLOCK_COUNT, MEMORY_MANAGER_XSMALL_BLOCK_COUNT,
+    MEMORY_MANAGER_SMALL_BLOCK_COUNT,   MEMORY_MANAGER_MEDIUM_BLOCK_COUNT,
+    MEMORY_MANAGER_LARGE_BLOCK_COUNT,   MEMORY_MANAGER_XLARGE_BLOCK_COUNT,
+    MEMORY_MANAGER_XXLARGE_BLOCK_COUNT
+};
+
+#define MEM_CATEGORIES      ARRAY_SIZE(m_mem_block_size)    /**< Number of memory manager categories. */
+#define MEM_TRACE_FREE      0x80000000                      /**< Marks a free in the memory manager trace. */
+
+static uint32_t m_mem_trace[MEM_TRACE_OPS];                 /**< Memory manager trace. */
+
+
+/**@brief Function for replaying the memory manager trace.
+ *
+ * A reserve entry holds the requested size. A free entry holds a random number which selects
+ * the block to free among the blocks held.
+ *
+ * @param[in] check True to check every result against a model of the pool and to check that
+ *                  blocks do not overlap, false to only replay the trace.
+ *
+ * @return Number of reservations which fell back to a larger category.
+ */
+static uint32_t mem_trace_replay(bool check)
+{
+    uint8_t * p_live[MEM_LIVE_MAX];
+    uint8_t   live_cat[MEM_LIVE_MAX];
+    uint32_t  used[MEM_CATEGORIES] = {0};
+    uint32_t  live      = 0;
+    uint32_t  fallbacks = 0;
+
+    for (uint32_t i = 0; i < MEM_TRACE_OPS; i++)
+    {
+        if (m_mem_trace[i] & MEM_TRACE_FREE)
+        {
+            if (live == 0)
+            {
+                continue;
+            }
+
+            uint32_t  idx      = (m_mem_trace[i] & ~MEM_TRACE_FREE) % live;
+            uint8_t * p_buffer = p_live[idx];
+            uint8_t   cat      = live_cat[idx];
+
+            if (check)
+            {
+                /* The block is filled with its category and slot, any overlap changes it. */
+                for (uint32_t j = 0; j < m_mem_block_size[cat]; j++)
+                {
+                    BENCH_CHECK(p_buffer[j] == (uint8_t)((cat << 5) ^ (uintptr_t)p_buffer));
+                }
+            }
+            nrf_free(p_buffer);
+
+            used[cat]--;
+            live--;
+            p_live[idx]   = p_live[live];
+            live_cat[idx] = live_cat[live];
+        }
+        else
+        {
+            uint8_t  * p_buffer = NULL;
+            uint32_t   size     = m_mem_trace[i];
+            uint32_t   cat;
+            ret_code_t err_code = nrf_mem_reserve(&p_buffer, &size);
+
+            /* The smallest category which fits the request and has a free block is used. */
+            for (cat = 0; cat < MEM_CATEGORIES; cat++)
+            {
+                if ((m_mem_block_size[cat] >= m_mem_trace[i]) &&
+                    (used[cat] < m_mem_block_count[cat]))
+                {
+                    break;
+                }
+            }
+            if (cat == MEM_CATEGORIES)
+            {
+                BENCH_CHECK(err_code != NRF_SUCCESS);
+                continue;
+            }
+            BENCH_CHECK(err_code == NRF_SUCCESS);
+            BENCH_CHECK(size == m_mem_block_size[cat]);
+            BENCH_CHECK(live < MEM_LIVE_MAX);
+
+            if (check)
+            {
+                BENCH_CHECK(((uintptr_t)p_buffer & 0x03) == 0);
+                memset(p_buffer, (uint8_t)((cat << 5) ^ (uintptr_t)p_buffer), size);
+            }
+            if ((cat != 0) && (m_mem_block_size[cat - 1] >= m_mem_trace[i]))
+            {
+                fallbacks++;
+            }
+
+            used[cat]++;
+            p_live[live]   = p_buffer;
+            live_cat[live] = (uint8_t)cat;
+            live++;
+        }
+    }
+
+    while (live != 0)
+    {
+        nrf_free(p_live[--live]);
+    }
+
+    return fallbacks;
+}
+
+
+/**@brief Function for replaying a reserve and free trace on the memory manager.
+ *
+ * Most requests are small, as for CoAP options and IPv6 headers, some are the size of a packet.
+ * The trace keeps the pool close to full so that reservations fall back to larger categories
+ * and fail.
+ */
+/**@brief Function for checking that all memory manager blocks are free. */
+static void mem_free_check(void)
+{
+    for (uint32_t cat = 0; cat < MEM_CATEGORIES; cat++)
+    {
+        uint8_t * p_blocks[MEM_LIVE_MAX];
+
+        for (uint32_t j = 0; j < m_mem_block_count[cat]; j++)
+        {
+            uint32_t size = m_mem_block_size[cat];
+
+            APP_ERROR_CHECK(nrf_mem_reserve(&p_blocks[j], &size));
+            BENCH_CHECK(size == m_mem_block_size[cat]);
+        }
+        for (uint32_t j = 0; j < m_mem_block_count[cat]; j++)
+        {
+            nrf_free(p_blocks[j]);
+        }
+    }
+}
+
+
+static void mem_manager_benchmark(void)
+{
+    benchmark_t bench;
+    uint32_t    fallbacks;
+
+    for (uint32_t i = 0; i < MEM_TRACE_OPS; i++)
+    {
+        uint32_t r = rand_get() % 100;
+
+        if (r < 48)
+        {
+            m_mem_trace[i] = MEM_TRACE_FREE | rand_get();
+        }
+        else if (r < 80)
+        {
+            m_mem_trace[i] = 1 + (rand_get() % MEMORY_MANAGER_SMALL_BLOCK_SIZE);
+        }
+        else if (r < 95)
+        {
+            m_mem_trace[i] = 1 + (rand_get() % MEMORY_MANAGER_LARGE_BLOCK_SIZE);
+        }
+        else
+        {
+            m_mem_trace[i] = 1 + (rand_get() % MEMORY_MANAGER_XXLARGE_BLOCK_SIZE);
+        }
+    }
+
+    APP_ERROR_CHECK(nrf_mem_init());
+    fallbacks = mem_trace_replay(true);
+    BENCH_CHECK(fallbacks != 0);
+    mem_free_check();
+
+    benchmark_start(&bench);
+    BENCH_CHECK(mem_trace_replay(false) == fallbacks);
+    bench.ops = MEM_TRACE_OPS;
+    benchmark_end(&bench, "nrf_mem_reserve+nrf_free (trace)");
+}
+
+
+/**@brief Pools of the memory object arena, from the smallest size class to the chunks. */
+static nrf_balloc_t const * const m_memobj_pools[] =
+{
+    &m_memobj_small, &m_memobj_large, &m_memobj_arena_chunks
+};
+
+/**@brief Object sizes of the size classes. */
+static uint32_t const m_memobj_class_size[] = {MEMOBJ_SMALL_SIZE, MEMOBJ_LARGE_SIZE};
+
+/**@brief Element counts of the memory object arena pools. */
+static uint32_t const m_memobj_pool_count[] = {MEMOBJ_SMALL_COUNT, MEMOBJ_LARGE_COUNT, MEMOBJ_CHUNKS};
+
+#define MEMOBJ_CLASSES      ARRAY_SIZE(m_memobj_class_size) /**< Number of size classes. */
+#define MEMOBJ_POOLS        ARRAY_SIZE(m_memobj_pools)      /**< Number of pools, the chunks are the last one. */
+
+
+/**@brief Function for getting the number of pool elements taken by a memory object. */
+static uint32_t memobj_elems_get(uint32_t pool, uint32_t size)
+{
+    return (pool < MEMOBJ_CLASSES) ? 1 :
+           CEIL_DIV(size + NRF_MEMOBJ_HEAD_HEADER_SIZE, MEMOBJ_CHUNK_SIZE);
+}
+
+
+/**@brief Function for getting the byte at a given offset of a memory object. */
+static uint8_t memobj_byte_get(uint8_t seed, uint32_t offset)
+{
+    return (uint8_t)((seed * 31) + (offset * 7) + (offset >> 3));
+}
+
+
+/**@brief Function for writing a memory object in random pieces. */
+static void memobj_fill(nrf_memobj_t * p_obj, uint32_t size, uint8_t seed)
+{
+    uint8_t  data[MEMOBJ_SIZE_MAX];
+    uint32_t len;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        data[i] = memobj_byte_get(seed, i);
+    }
+    for (uint32_t offset = 0; offset < size; offset += len)
+    {
+        len = 1 + (rand_get() % (size - offset));
+        nrf_memobj_write(p_obj, &data[offset], len, offset);
+    }
+}
+
+
+/**@brief Function for checking a memory object by reading it in random pieces and by spans.
+ *
+ * An object of a size class must be a single span which holds the whole class size. A chunked
+ * object has one span per chunk.
+ */
+static void memobj_verify(nrf_memobj_t * p_obj, uint32_t size, uint32_t pool, uint8_t seed)
+{
+    uint8_t  data[MEMOBJ_SIZE_MAX];
+    uint32_t len;
+    uint32_t spans = 0;
+
+    for (uint32_t offset = 0; offset < size; offset += len)
+    {
+        len = 1 + (rand_get() % (size - offset));
+        nrf_memobj_read(p_obj, &data[offset], len, offset);
+    }
+    for (uint32_t i = 0; i < size; i++)
+    {
+        BENCH_CHECK(data[i] == memobj_byte_get(seed, i));
+    }
+
+    for (uint32_t offset = 0; offset < size; offset += len, spans++)
+    {
+        uint8_t const * p_span = nrf_memobj_span_get(p_obj, offset, &len);
+
+        if (pool < MEMOBJ_CLASSES)
+        {
+            BENCH_CHECK(len == m_memobj_class_size[pool]);
+        }
+        len = MIN(len, size - offset);
+        BENCH_CHECK(len != 0);
+        BENCH_CHECK(memcmp(p_span, &data[offset], len) == 0);
+    }
+    BENCH_CHECK(spans == memobj_elems_get(pool, size));
+}
+
+
+/**@brief Function for checking the allocation of memory objects from an arena with size classes.
+ *
+ * Every allocation is checked against a model of the pools: the smallest size class which fits
+ * the object and has a free element is used, then chunks. The objects are checked when they are
+ * freed, so an object which overlaps another is detected.
+ */
+static void memobj_arena_check(void)
+{
+    nrf_memobj_t * p_live[MEMOBJ_LIVE_MAX];
+    uint32_t       live_size[MEMOBJ_LIVE_MAX];
+    uint8_t        live_pool[MEMOBJ_LIVE_MAX];
+    uint8_t        live_seed[MEMOBJ_LIVE_MAX];
+    uint32_t       used[MEMOBJ_POOLS] = {0};
+    uint32_t       allocs[MEMOBJ_POOLS] = {0};
+    uint32_t       live      = 0;
+    uint32_t       fallbacks = 0;
+    uint32_t       failures  = 0;
+
+    APP_ERROR_CHECK(nrf_memobj_pool_init(&m_memobj_arena));
+
+    for (uint32_t i = 0; i < MEMOBJ_OPS + MEMOBJ_LIVE_MAX; i++)
+    {
+        if ((i >= MEMOBJ_OPS) || (live == MEMOBJ_LIVE_MAX) || ((live != 0) && (rand_get() & 1)))
+        {
+            if (live == 0)
+            {
+                break;
+            }
+
+            uint32_t       idx   = rand_get() % live;
+            nrf_memobj_t * p_obj = p_live[idx];
+
+            memobj_verify(p_obj, live_size[idx], live_pool[idx], live_seed[idx]);
+            if (rand_get() & 1)
+            {
+                nrf_memobj_free(p_obj);
+            }
+            else
+            {
+                /* The object is freed by the last put. */
+                nrf_memobj_get(p_obj);
+                nrf_memobj_get(p_obj);
+                nrf_memobj_put(p_obj);
+                BENCH_CHECK(nrf_balloc_utilization_get(m_memobj_pools[live_pool[idx]]) ==
+                            used[live_pool[idx]]);
+                nrf_memobj_put(p_obj);
+            }
+
+            used[live_pool[idx]] -= memobj_elems_get(live_pool[idx], live_size[idx]);
+            live--;
+            p_live[idx]    = p_live[live];
+            live_size[idx] = live_size[live];
+            live_pool[idx] = live_pool[live];
+            live_seed[idx] = live_seed[live];
+        }
+        else
+        {
+            uint32_t r    = rand_get() % 10;
+            uint32_t size = 1 + (rand_get() % ((r < 5) ? MEMOBJ_SMALL_SIZE :
+                                               (r < 8) ? MEMOBJ_LARGE_SIZE : MEMOBJ_SIZE_MAX));
+            uint32_t pool;
+
+            for (pool = 0; pool < MEMOBJ_CLASSES; pool++)
+            {
+                if ((size <= m_memobj_class_size[pool]) &&
+                    (used[pool] < m_memobj_pool_count[pool]))
+                {
+                    break;
+                }
+            }
+            if ((pool > 0) && (size <= m_memobj_class_size[pool - 1]))
+            {
+                fallbacks++;
+            }
+
+            nrf_memobj_t * p_obj = nrf_memobj_alloc(&m_memobj_arena, size);
+
+            if ((pool == MEMOBJ_CLASSES) &&
+                (used[pool] + memobj_elems_get(pool, size) > m_memobj_pool_count[pool]))
+            {
+                /* Chunks taken before the failure must be returned. */
+                BENCH_CHECK(p_obj == NULL);
+                failures++;
+            }
+            else
+            {
+                BENCH_CHECK(p_obj != NULL);
+                live_seed[live] = (uint8_t)rand_get();
+                memobj_fill(p_obj, size, live_seed[live]);
+
+                used[pool] += memobj_elems_get(pool, size);
+                allocs[pool]++;
+                p_live[live]    = p_obj;
+                live_size[live] = size;
+                live_pool[live] = (uint8_t)pool;
+                live++;
+            }
+        }
+
+        for (uint32_t pool = 0; pool < MEMOBJ_POOLS; pool++)
+        {
+            BENCH_CHECK(nrf_balloc_utilization_get(m_memobj_pools[pool]) == used[pool]);
+        }
+    }
+
+    BENCH_CHECK(live == 0);
+    for (uint32_t pool = 0; pool < MEMOBJ_POOLS; pool++)
+    {
+        BENCH_CHECK(used[pool] == 0);
+        BENCH_CHECK(allocs[pool] != 0);
+    }
+    BENCH_CHECK((fallbacks != 0) && (failures != 0));
+}
+
+
+/**@brief Function for measuring a log message which is written and read like the logger does.
+ *
+ * @param[in] p_pool Pool of memory objects.
+ * @param[in] p_name Name of the benchmark.
+ */
+static void memobj_msg_benchmark(nrf_memobj_pool_t const * p_pool, char const * p_name)
+{
+    benchmark_t bench;
+    uint32_t    words[MEMOBJ_MSG_SIZE / sizeof(uint32_t)] = {0};
+
+    APP_ERROR_CHECK(nrf_memobj_pool_init(p_pool));
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS; i++)
+    {
+        nrf_memobj_t * p_obj = nrf_memobj_alloc(p_pool, MEMOBJ_MSG_SIZE);
+
+        BENCH_CHECK(p_obj != NULL);
+        nrf_memobj_get(p_obj);
+        words[0] = i;
+        for (uint32_t j = 0; j < ARRAY_SIZE(words); j++)
+        {
+            nrf_memobj_write(p_obj, &words[j], sizeof(uint32_t), j * sizeof(uint32_t));
+        }
+        nrf_memobj_read(p_obj, words, sizeof(words), 0);
+        BENCH_CHECK(words[0] == i);
+        nrf_memobj_put(p_obj);
+    }
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, p_name);
+}
+
+
+static void memobj_benchmark(void)
+{
+    memobj_arena_check();
+    memobj_msg_benchmark(&m_memobj_chunks, "nrf_memobj msg (chunks)");
+    memobj_msg_benchmark(&m_memobj_arena, "nrf_memobj msg (size class)");
+}
+
+
+/**@brief Function for filling or checking a record spread over ring buffer segments.
+ *
+ * @param[in] p_iov     Segments of the record.
+ * @param[in] count     Number of segments.
+ * @param[in] seed      Value of the first byte of the record, the following bytes count up.
+ * @param[in] fill      True to fill the record, false to check it.
+ */
+static void ringbuf_record_process(nrf_ringbuf_iovec_t const * p_iov,
+                                   uint32_t                    count,
+                                   uint8_t                     seed,
+                                   bool                        fill)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        for (size_t j = 0; j < p_iov[i].length; j++, seed++)
+        {
+            if (fill)
+            {
+                p_iov[i].p_data[j] = seed;
+            }
+            else
+            {
+                BENCH_CHECK(p_iov[i].p_data[j] == seed);
+            }
+        }
+    }
+}
+
+
+/**@brief Function for passing records which do not divide the buffer size through a ring buffer.
+ *
+ * Every few records wrap around the end of the buffer. With the contiguous API, a wrapped record
+ * takes two alloc and two get calls. The vectored API returns it as two segments at once, and
+ * the mirrored layout as one.
+ *
+ * @param[in] p_ringbuf Ring buffer.
+ * @param[in] iov       True to use the vectored API.
+ * @param[in] p_name    Name of the benchmark.
+ */
+static void ringbuf_record_benchmark(nrf_ringbuf_t const * p_ringbuf, bool iov, char const * p_name)
+{
+    benchmark_t bench;
+    uint32_t    wrapped = 0;
+
+    nrf_ringbuf_init(p_ringbuf);
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS; i++)
+    {
+        nrf_ringbuf_iovec_t segments[NRF_RINGBUF_IOV_MAX] = {{0}};
+        size_t              length = RINGBUF_RECORD_SIZE;
+        uint32_t            count  = 1;
+
+        if (iov)
+        {
+            APP_ERROR_CHECK(nrf_ringbuf_alloc_iov(p_ringbuf, segments, &length, true));
+            count = (segments[1].length != 0) ? 2 : 1;
+        }
+        else
+        {
+            APP_ERROR_CHECK(nrf_ringbuf_alloc(p_ringbuf, &segments[0].p_data, &length, true));
+            segments[0].length = length;
+            if (length < RINGBUF_RECORD_SIZE)
+            {
+                length = RINGBUF_RECORD_SIZE - length;
+                APP_ERROR_CHECK(nrf_ringbuf_alloc(p_ringbuf, &segments[1].p_data, &length, false));
+                segments[1].length = length;
+                count = 2;
+            }
+        }
+        BENCH_CHECK(segments[0].length + segments[1].length == RINGBUF_RECORD_SIZE);
+        ringbuf_record_process(segments, count, (uint8_t)i, true);
+        APP_ERROR_CHECK(nrf_ringbuf_put(p_ringbuf, RINGBUF_RECORD_SIZE));
+
+        memset(segments, 0, sizeof(segments));
+        length = RINGBUF_RECORD_SIZE;
+        count  = 1;
+        if (iov)
+        {
+            APP_ERROR_CHECK(nrf_ringbuf_get_iov(p_ringbuf, segments, &length, true));
+            count = (segments[1].length != 0) ? 2 : 1;
+        }
+        else
+        {
+            APP_ERROR_CHECK(nrf_ringbuf_get(p_ringbuf, &segments[0].p_data, &length, true));
+            segments[0].length = length;
+            if (length < RINGBUF_RECORD_SIZE)
+            {
+                length = RINGBUF_RECORD_SIZE - length;
+                APP_ERROR_CHECK(nrf_ringbuf_get(p_ringbuf, &segments[1].p_data, &length, false));
+                segments[1].length = length;
+                count = 2;
+            }
+        }
+        BENCH_CHECK(segments[0].length + segments[1].length == RINGBUF_RECORD_SIZE);
+        ringbuf_record_process(segments, count, (uint8_t)i, false);
+        APP_ERROR_CHECK(nrf_ringbuf_free(p_ringbuf, RINGBUF_RECORD_SIZE));
+
+        wrapped     += count - 1;
+        bench.bytes += RINGBUF_RECORD_SIZE;
+    }
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, p_name);
+
+    /* The mirrored layout never splits a record shorter than the mirror area. */
+    BENCH_CHECK((p_ringbuf->mirror_size == 0) ? (wrapped != 0) : (wrapped == 0));
+}
+
+
+static void ringbuf_benchmark(void)
+{
+    benchmark_t bench;
+    uint8_t     chunk[64];
+
+    nrf_ringbuf_init(&m_ringbuf);
+    memset(chunk, 0x5A, sizeof(chunk));
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS; i++)
+    {
+        size_t length = sizeof(chunk);
+
+        chunk[0] = (uint8_t)i;
+        APP_ERROR_CHECK(nrf_ringbuf_cpy_put(&m_ringbuf, chunk, &length));
+        BENCH_CHECK(length == sizeof(chunk));
+        chunk[0] = (uint8_t)(i + 1);
+        APP_ERROR_CHECK(nrf_ringbuf_cpy_get(&m_ringbuf, chunk, &length));
+        BENCH_CHECK((length == sizeof(chunk)) && (chunk[0] == (uint8_t)i));
+        bench.bytes += length;
+    }
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, "nrf_ringbuf cpy_put+cpy_get (64B)");
+
+    ringbuf_record_benchmark(&m_ringbuf, false, "nrf_ringbuf alloc+get (100B)");
+    ringbuf_record_benchmark(&m_ringbuf, true, "nrf_ringbuf alloc_iov+get_iov");
+    ringbuf_record_benchmark(&m_ringbuf_mirrored, true, "nrf_ringbuf mirrored (iov)");
+}
+
+
+static void sched_evt_handler(void * p_event_data, uint16_t event_size)
+{
+    BENCH_CHECK(*(uint32_t *)p_event_data == m_sink + 1);
+    m_sink = *(uint32_t *)p_event_data;
+}
+
+
+static void scheduler_benchmark(void)
+{
+    benchmark_t bench;
+
+    APP_SCHED_INIT(SCHED_EVENT_SIZE, SCHED_QUEUE_SIZE);
+
+    /* Events carry consecutive values, so the handler can check that they come in order. */
+    m_sink = 0;
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS / ITEM_BATCH; i++)
+    {
+        for (uint32_t j = 0; j < ITEM_BATCH; j++)
+        {
+            uint32_t value = (i * ITEM_BATCH) + j + 1;
+
+            APP_ERROR_CHECK(app_sched_event_put(&value, sizeof(value), sched_evt_handler));
+        }
+        app_sched_execute();
+    }
+    BENCH_CHECK(m_sink == ITEM_ROUNDS);
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, "app_scheduler put+execute");
+}
+
+
+#if APP_SCHEDULER_WITH_DEADLINE || APP_SCHEDULER_WITH_PROFILER
+/**@brief Function for getting the time of the scheduler check. */
+static uint32_t sched_timestamp_get(void)
+{
+    return m_sched_now;
+}
+#endif
+
+
+/**@brief Function for getting the oldest event of a priority level of the scheduler model, if it
+ *        is committed.
+ */
+static sched_model_event_t * sched_model_head_get(uint8_t priority)
+{
+    sched_model_queue_t * p_queue = &m_sched_model[priority];
+
+    if ((p_queue->count == 0) || !p_queue->events[p_queue->head].committed)
+    {
+        return NULL;
+    }
+    return &p_queue->events[p_queue->head];
+}
+
+
+/**@brief Function for selecting the priority level of the next event, following the dispatch
+ *        rules documented for app_sched_execute().
+ *
+ * @param[in] now   Current time.
+ *
+ * @return Priority level, or APP_SCHEDULER_PRIORITY_LEVELS if no event is ready.
+ */
+static uint8_t sched_model_next_get(uint32_t now)
+{
+    sched_model_event_t * p_heads[APP_SCHEDULER_PRIORITY_LEVELS];
+    uint8_t               priority;
+
+    for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+    {
+        p_heads[priority] = sched_model_head_get(priority);
+    }
+
+#if APP_SCHEDULER_WITH_DEADLINE
+    uint8_t overdue_priority = APP_SCHEDULER_PRIORITY_LEVELS;
+    int32_t overdue_max      = -1;
+
+    /* The most overdue event goes first, the highest priority one of equally overdue events. */
+    for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+    {
+        if ((p_heads[priority] != NULL) && (p_heads[priority]->deadline != 0) &&
+            ((int32_t)(now - p_heads[priority]->deadline) > overdue_max))
+        {
+            overdue_max      = (int32_t)(now - p_heads[priority]->deadline);
+            overdue_priority = priority;
+        }
+    }
+    if (overdue_priority < APP_SCHEDULER_PRIORITY_LEVELS)
+    {
+#if APP_SCHEDULER_WEIGHTED_DISPATCH
+        if (m_sched_credits[overdue_priority] > 0)
+        {
+            m_sched_credits[overdue_priority]--;
+        }
+#endif
+        return overdue_priority;
+    }
+#endif
+
+#if APP_SCHEDULER_WEIGHTED_DISPATCH
+    /* Each level gets twice the share of the level below it, and a new round starts when every
+     * level with ready events has used up its share. */
+    for (uint32_t round = 0; round < 2; round++)
+    {
+        for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+        {
+            if ((p_heads[priority] != NULL) && (m_sched_credits[priority] > 0))
+            {
+                m_sched_credits[priority]--;
+                return priority;
+            }
+        }
+        for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+        {
+            m_sched_credits[priority] = 1 << (APP_SCHED_PRIORITY_LOWEST - priority);
+        }
+    }
+#else
+    for (priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+    {
+        if (p_heads[priority] != NULL)
+        {
+            return priority;
+        }
+    }
+#endif
+
+    return APP_SCHEDULER_PRIORITY_LEVELS;
+}
+
+
+/**@brief Function for handling the events of the scheduler check.
+ *
+ * The event must be the one which the model selects at the current time. Handlers take a random
+ * time, so that later events miss their deadlines.
+ */
+static void sched_check_handler(void * p_event_data, uint16_t event_size)
+{
+    uint32_t                 now      = m_sched_now;
+    uint8_t                  priority = sched_model_next_get(now);
+    sched_model_queue_t    * p_queue;
+    sched_model_event_t    * p_event;
+    app_sched_prio_stats_t * p_stats;
+
+    BENCH_CHECK(priority < APP_SCHEDULER_PRIORITY_LEVELS);
+    p_queue = &m_sched_model[priority];
+    p_event = &p_queue->events[p_queue->head];
+    BENCH_CHECK((p_event->p_data == p_event_data) && (p_event->size == event_size));
+    for (uint32_t i = 0; i < event_size; i++)
+    {
+        BENCH_CHECK(p_event->p_data[i] == (uint8_t)(p_event->id + i));
+    }
+
+    p_stats = &m_sched_stats[priority];
+    p_stats->executed++;
+    p_stats->latency_total += now - p_event->timestamp;
+    p_stats->latency_max    = MAX(p_stats->latency_max, now - p_event->timestamp);
+    if ((p_event->deadline != 0) && ((int32_t)(now - p_event->deadline) > 0))
+    {
+        p_stats->deadline_missed++;
+    }
+
+    p_queue->head = (p_queue->head + 1) % SCHED_MODEL_MAX;
+    p_queue->count--;
+    m_sched_now += rand_get() % SCHED_HANDLER_TICKS;
+}
+
+
+/**@brief Function for reserving an event with random attributes in the scheduler and its model. */
+static void sched_check_reserve(void)
+{
+    app_sched_event_attr_t attr;
+    sched_model_queue_t  * p_queue;
+    sched_model_event_t  * p_event;
+    void                 * p_data;
+    uint16_t               size = rand_get() % (SCHED_EVENT_SIZE + 1);
+    ret_code_t             err_code;
+
+    attr.priority = rand_get() % APP_SCHEDULER_PRIORITY_LEVELS;
+    attr.deadline = (APP_SCHEDULER_WITH_DEADLINE && (rand_get() & 1)) ?
+                    1 + (rand_get() % SCHED_DEADLINE_MAX) : 0;
+    p_queue = &m_sched_model[attr.priority];
+
+    err_code = app_sched_event_reserve_ext(size, sched_check_handler, &attr, &p_data);
+    if (err_code == NRF_ERROR_NO_MEM)
+    {
+        /* An empty queue always has space for an event of maximum size. */
+        BENCH_CHECK(p_queue->count > 0);
+        return;
+    }
+    APP_ERROR_CHECK(err_code);
+    BENCH_CHECK(p_queue->count < SCHED_MODEL_MAX);
+
+    p_event            = &p_queue->events[(p_queue->head + p_queue->count) % SCHED_MODEL_MAX];
+    p_event->p_data    = p_data;
+    p_event->id        = m_sched_id++;
+    p_event->size      = size;
+    p_event->timestamp = m_sched_now;
+    p_event->deadline  = (attr.deadline != 0) ? (m_sched_now + attr.deadline) : 0;
+    p_event->committed = false;
+    if ((attr.deadline != 0) && (p_event->deadline == 0))
+    {
+        p_event->deadline = 1;
+    }
+    for (uint32_t i = 0; i < size; i++)
+    {
+        p_event->p_data[i] = (uint8_t)(p_event->id + i);
+    }
+    p_queue->count++;
+}
+
+
+/**@brief Function for committing a random reserved event in the scheduler and its model.
+ *
+ * @param[in] all   Commit all reserved events.
+ */
+static void sched_check_commit(bool all)
+{
+    for (uint8_t priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+    {
+        sched_model_queue_t * p_queue = &m_sched_model[priority];
+
+        for (uint32_t i = 0; i < p_queue->count; i++)
+        {
+            sched_model_event_t * p_event = &p_queue->events[(p_queue->head + i) % SCHED_MODEL_MAX];
+
+            if (!p_event->committed && (all || ((rand_get() % 4) == 0)))
+            {
+                app_sched_event_commit(p_event->p_data);
+                p_event->committed = true;
+                if (!all)
+                {
+                    return;
+                }
+            }
+        }
+    }
+}
+
+
+#if APP_SCHEDULER_WEIGHTED_DISPATCH
+/**@brief Function for handling the events of the weighted dispatch check. */
+static void sched_weighted_handler(void * p_event_data, uint16_t event_size)
+{
+    BENCH_CHECK(m_sched_id < ARRAY_SIZE(m_sched_order));
+    m_sched_order[m_sched_id++] = *(uint8_t *)p_event_data;
+}
+
+
+/**@brief Function for checking that busy priority levels do not starve lower levels.
+ *
+ * Every level is filled with events for the same number of rounds of its share. In each round of
+ * 2^APP_SCHEDULER_PRIORITY_LEVELS - 1 events, each level must get exactly its share, so the lowest
+ * level runs once per round although the higher levels are never empty.
+ */
+static void scheduler_weighted_check(void)
+{
+    uint32_t round_size = (1 << APP_SCHEDULER_PRIORITY_LEVELS) - 1;
+
+    APP_SCHED_INIT(SCHED_EVENT_SIZE, SCHED_QUEUE_SIZE);
+    m_sched_id = 0;
+
+    for (uint8_t priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+    {
+        app_sched_event_attr_t attr = {.priority = priority};
+
+        for (uint32_t i = 0; i < (SCHED_WEIGHT_ROUNDS << (APP_SCHED_PRIORITY_LOWEST - priority)); i++)
+        {
+            APP_ERROR_CHECK(app_sched_event_put_ext(&priority, sizeof(priority),
+                                                    sched_weighted_handler, &attr));
+        }
+    }
+    app_sched_execute();
+
+    BENCH_CHECK(m_sched_id == SCHED_WEIGHT_ROUNDS * round_size);
+    for (uint32_t round = 0; round < SCHED_WEIGHT_ROUNDS; round++)
+    {
+        uint32_t counts[APP_SCHEDULER_PRIORITY_LEVELS] = {0};
+
+        for (uint32_t i = 0; i < round_size; i++)
+        {
+            counts[m_sched_order[(round * round_size) + i]]++;
+        }
+        for (uint8_t priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+        {
+            BENCH_CHECK(counts[priority] == (1u << (APP_SCHED_PRIORITY_LOWEST - priority)));
+        }
+    }
+}
+#endif // APP_SCHEDULER_WEIGHTED_DISPATCH
+
+
+/**@brief Function for checking the scheduler against a model.
+ *
+ * Events of random sizes, priorities and deadlines are reserved, committed in random order and
+ * executed. Every executed event must be the one selected by the model, which only executes
+ * committed events from the head of each priority level. The statistics of each level must match
+ * the ones counted by the model. The time starts shortly before wrapping around.
+ */
+static void scheduler_check(void)
+{
+    app_sched_event_attr_t attr = {.priority = APP_SCHEDULER_PRIORITY_LEVELS};
+    uint32_t               executed = 0;
+    uint32_t               missed   = 0;
+    void                 * p_data;
+
+    APP_SCHED_INIT(SCHED_EVENT_SIZE, SCHED_QUEUE_SIZE);
+    memset(m_sched_model, 0, sizeof(m_sched_model));
+    memset(m_sched_stats, 0, sizeof(m_sched_stats));
+    memset(m_sched_credits, 0, sizeof(m_sched_credits));
+    m_sched_now = SCHED_TIME_START;
+    m_sched_id  = 0;
+#if APP_SCHEDULER_WITH_DEADLINE || APP_SCHEDULER_WITH_PROFILER
+    app_sched_timestamp_func_set(sched_timestamp_get);
+#endif
+
+    BENCH_CHECK(app_sched_event_reserve(0, sched_check_handler, NULL) == NRF_ERROR_NULL);
+    BENCH_CHECK(app_sched_event_reserve(SCHED_EVENT_SIZE + 1, sched_check_handler, &p_data) ==
+                NRF_ERROR_INVALID_LENGTH);
+    BENCH_CHECK(app_sched_event_reserve_ext(0, sched_check_handler, &attr, &p_data) ==
+                NRF_ERROR_INVALID_PARAM);
+
+    for (uint32_t i = 0; i < SCHED_CHECK_OPS; i++)
+    {
+        switch (rand_get() % 8)
+        {
+            case 0:
+            case 1:
+            case 2:
+                sched_check_reserve();
+                break;
+            case 3:
+            case 4:
+                sched_check_commit(false);
+                break;
+            case 5:
+                m_sched_now += rand_get() % SCHED_HANDLER_TICKS;
+                break;
+            default:
+                app_sched_execute();
+                /* Only events held back by reserved ones are left. */
+                BENCH_CHECK(sched_model_next_get(m_sched_now) == APP_SCHEDULER_PRIORITY_LEVELS);
+                break;
+        }
+    }
+    sched_check_commit(true);
+    app_sched_execute();
+
+    for (uint8_t priority = 0; priority < APP_SCHEDULER_PRIORITY_LEVELS; priority++)
+    {
+        BENCH_CHECK(m_sched_model[priority].count == 0);
+        executed += m_sched_stats[priority].executed;
+        missed   += m_sched_stats[priority].deadline_missed;
+#if APP_SCHEDULER_WITH_PROFILER
+        app_sched_prio_stats_t stats;
+
+        app_sched_prio_stats_get(priority, &stats);
+        BENCH_CHECK(stats.executed == m_sched_stats[priority].executed);
+        BENCH_CHECK(stats.latency_max == m_sched_stats[priority].latency_max);
+        BENCH_CHECK(stats.latency_total == m_sched_stats[priority].latency_total);
+        BENCH_CHECK(stats.deadline_missed == m_sched_stats[priority].deadline_missed);
+#endif
+    }
+    BENCH_CHECK(executed > SCHED_CHECK_OPS / 8);
+    BENCH_CHECK(APP_SCHEDULER_WITH_DEADLINE ? (missed > 0) && (missed < executed) : (missed == 0));
+
+#if APP_SCHEDULER_WEIGHTED_DISPATCH
+    scheduler_weighted_check();
+#endif
+}
+
+
+/**@brief Function for printing the result of a benchmark which was timed in several parts. */
+static void benchmark_parts_print(char const * p_name, uint64_t elapsed, uint32_t ops)
+{
+    printf("%-32s %10.1f ns/op\n", p_name, (double)elapsed / (ops ? ops : 1));
+}
+
+
+/**@brief Function for giving random keys to the first items of the sorted list benchmark. */
+static void sortlist_keys_set(uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        m_sortlist_entries[i].key = rand_get();
+    }
+}
+
+
+/**@brief Function for benchmarking adding, removing and popping the items of a sorted list.
+ *
+ * Every kind of operation is timed separately, as the list and the pairing heap trade cheaper
+ * adds for dearer pops and removes of arbitrary items.
+ *
+ * @param[in] size  Number of items in the list.
+ */
+static void sortlist_size_benchmark(uint32_t size)
+{
+    nrf_sortlist_item_t * p_popped[SORTLIST_SIZE];
+    uint32_t              order[SORTLIST_SIZE];
+    uint64_t              add_ns    = 0;
+    uint64_t              remove_ns = 0;
+    uint64_t              pop_ns    = 0;
+    uint32_t              rounds    = SORTLIST_OPS / size;
+    char                  name[40];
+
+    for (uint32_t round = 0; round < rounds; round++)
+    {
+        uint64_t start;
+
+        sortlist_keys_set(size);
+        start = time_ns_get();
+        for (uint32_t i = 0; i < size; i++)
+        {
+            nrf_sortlist_add(&m_sortlist, &m_sortlist_entries[i].item);
+        }
+        add_ns += time_ns_get() - start;
+
+        /* Items are removed from arbitrary positions. */
+        for (uint32_t i = 0; i < size; i++)
+        {
+            uint32_t j = rand_get() % (i + 1);
+
+            order[i] = order[j];
+            order[j] = i;
+        }
+        start = time_ns_get();
+        for (uint32_t i = 0; i < size; i++)
+        {
+            p_popped[i] = (nrf_sortlist_remove(&m_sortlist, &m_sortlist_entries[order[i]].item)) ?
+                          &m_sortlist_entries[order[i]].item : NULL;
+        }
+        remove_ns += time_ns_get() - start;
+        for (uint32_t i = 0; i < size; i++)
+        {
+            BENCH_CHECK(p_popped[i] != NULL);
+        }
+        BENCH_CHECK(nrf_sortlist_pop(&m_sortlist) == NULL);
+
+        sortlist_keys_set(size);
+        for (uint32_t i = 0; i < size; i++)
+        {
+            nrf_sortlist_add(&m_sortlist, &m_sortlist_entries[i].item);
+        }
+        start = time_ns_get();
+        for (uint32_t i = 0; i < size; i++)
+        {
+            p_popped[i] = nrf_sortlist_pop(&m_sortlist);
+        }
+        pop_ns += time_ns_get() - start;
+
+        /* The items must come out in order. */
+        for (uint32_t i = 0, key = 0; i < size; i++)
+        {
+            sortlist_entry_t * p_entry = CONTAINER_OF(p_popped[i], sortlist_entry_t, item);
+
+            BENCH_CHECK((p_popped[i] != NULL) && (p_entry->key >= key));
+            key = p_entry->key;
+        }
+        BENCH_CHECK(nrf_sortlist_pop(&m_sortlist) == NULL);
+    }
+
+    (void)snprintf(name, sizeof(name), "nrf_sortlist %s add (%u)",
+                   NRF_SORTLIST_CONFIG_PAIRING_HEAP ? "heap" : "list", (unsigned)size);
+    benchmark_parts_print(name, add_ns, rounds * size);
+    (void)snprintf(name, sizeof(name), "nrf_sortlist %s remove (%u)",
+                   NRF_SORTLIST_CONFIG_PAIRING_HEAP ? "heap" : "list", (unsigned)size);
+    benchmark_parts_print(name, remove_ns, rounds * size);
+    (void)snprintf(name, sizeof(name), "nrf_sortlist %s pop (%u)",
+                   NRF_SORTLIST_CONFIG_PAIRING_HEAP ? "heap" : "list", (unsigned)size);
+    benchmark_parts_print(name, pop_ns, rounds * size);
+}
+
+
+static void sortlist_benchmark(void)
+{
+    sortlist_size_benchmark(8);
+    sortlist_size_benchmark(64);
+    sortlist_size_benchmark(SORTLIST_SIZE);
+}
+
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt)
+{
+    APP_ERROR_CHECK(p_evt->result);
+    m_fs_pending--;
+}
+
+
+static void fs_wait(void)
+{
+    while (m_fs_pending != 0)
+    {
+        (void)nrf_fstorage_is_busy(&m_bench_fs);
+    }
+}
+
+
+static void fstorage_benchmark(void)
+{
+    benchmark_t bench;
+    uint32_t    pages;
+
+    /* Use the beginning of the area, FDS takes pages from its end. */
+    m_bench_fs.start_addr = nrf_fstorage_ram_start_addr();
+    m_bench_fs.end_addr   = m_bench_fs.start_addr + FS_SIZE;
+    APP_ERROR_CHECK(nrf_fstorage_init(&m_bench_fs, &nrf_fstorage_ram, NULL));
+
+    pages = FS_SIZE / m_bench_fs.p_flash_info->erase_unit;
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < FS_ROUNDS; i++)
+    {
+        m_fs_pending++;
+        APP_ERROR_CHECK(nrf_fstorage_erase(&m_bench_fs, m_bench_fs.start_addr, pages, NULL));
+        fs_wait();
+
+        for (uint32_t offset = 0; offset < FS_SIZE; offset += DATA_SIZE)
+        {
+            m_fs_pending++;
+            APP_ERROR_CHECK(nrf_fstorage_write(&m_bench_fs, m_bench_fs.start_addr + offset,
+                                               m_data, DATA_SIZE, NULL));
+            fs_wait();
+        }
+    }
+    bench.ops   = FS_ROUNDS;
+    bench.bytes = (size_t)FS_ROUNDS * FS_SIZE;
+    benchmark_end(&bench, "nrf_fstorage erase+write (16 kB)");
+
+    for (uint32_t offset = 0; offset < FS_SIZE; offset += DATA_SIZE)
+    {
+        static uint8_t read_back[DATA_SIZE];
+
+        APP_ERROR_CHECK(nrf_fstorage_read(&m_bench_fs, m_bench_fs.start_addr + offset,
+                                          read_back, DATA_SIZE));
+        BENCH_CHECK(memcmp(read_back, m_data, DATA_SIZE) == 0);
+    }
+}
+
+
+static void fds_evt_handler(fds_evt_t const * p_evt)
+{
+    BENCH_CHECK(p_evt->result == m_fds_result);
+    m_fds_evt = *p_evt;
+    if (p_evt->id == FDS_EVT_INIT)
+    {
+        m_fds_initialized = true;
+    }
+    else
+    {
+        if (p_evt->id == FDS_EVT_GC)
+        {
+            m_fds_gc_events++;
+        }
+        m_fds_pending--;
+    }
+}
+
+
+static void fds_wait(void)
+{
+    while (m_fds_pending != 0)
+    {
+        /* Operations complete synchronously with the RAM backend. */
+    }
+}
+
+
+static void fds_benchmark(void)
+{
+    benchmark_t bench_write;
+    benchmark_t bench_find;
+    benchmark_t bench_gc;
+    uint64_t    write_ns = 0;
+    uint64_t    find_ns  = 0;
+    uint64_t    miss_ns  = 0;
+    uint64_t    iter_ns  = 0;
+    uint64_t    gc_ns    = 0;
+    uint32_t    writes   = 0;
+    uint32_t    finds    = 0;
+    uint32_t    record[FDS_RECORD_WORDS] = {0};
+
+    APP_ERROR_CHECK(fds_register(fds_evt_handler));
+    APP_ERROR_CHECK(fds_init());
+    if (!m_fds_initialized)
+    {
+        printf("FDS initialization did not complete\n");
+        return;
+    }
+
+#if (FDS_RECORD_INDEX_ENABLED)
+    printf("FDS record index: %u entries\n", FDS_RECORD_INDEX_SIZE);
+#else
+    printf("FDS record index: off, records are located by scanning flash\n");
+#endif
+
+    for (uint32_t round = 0; round < FDS_ROUNDS; round++)
+    {
+        fds_record_t const rec =
+        {
+            .file_id = FDS_FILE_ID,
+            .data    = { .p_data = record, .length_words = FDS_RECORD_WORDS },
+        };
+        fds_record_desc_t  desc;
+        fds_find_token_t   token;
+        fds_stat_t         stat;
+        uint16_t           key;
+        ret_code_t         err_code;
+
+        /* Fill the storage. */
+        benchmark_start(&bench_write);
+        for (key = 1; ; key++)
+        {
+            fds_record_t keyed = rec;
+
+            record[0]         = key;
+            keyed.key         = key;
+            m_fds_pending++;
+            err_code = fds_record_write(&desc, &keyed);
+            if (err_code == FDS_ERR_NO_SPACE_IN_FLASH)
+            {
+                m_fds_pending--;
+                break;
+            }
+            APP_ERROR_CHECK(err_code);
+            fds_wait();
+        }
+        write_ns += time_ns_get() - bench_write.start;
+        writes   += key - 1;
+
+        /* Look up every record by its key. */
+        benchmark_start(&bench_find);
+        for (uint16_t k = 1; k < key; k++)
+        {
+            fds_flash_record_t flash_rec;
+
+            memset(&token, 0, sizeof(token));
+            APP_ERROR_CHECK(fds_record_find(FDS_FILE_ID, k, &desc, &token));
+            APP_ERROR_CHECK(fds_record_open(&desc, &flash_rec));
+            BENCH_CHECK(flash_rec.p_header->length_words == FDS_RECORD_WORDS);
+            BENCH_CHECK(((uint32_t const *)flash_rec.p_data)[0] == k);
+            m_sink = ((uint32_t const *)flash_rec.p_data)[0];
+            APP_ERROR_CHECK(fds_record_close(&desc));
+        }
+        find_ns += time_ns_get() - bench_find.start;
+        finds   += key - 1;
+
+        /* Look up a key which was not written. Scanning flash visits every record to find out. */
+        benchmark_start(&bench_find);
+        for (uint32_t i = 0; i < FDS_MISS_LOOKUPS; i++)
+        {
+            memset(&token, 0, sizeof(token));
+            BENCH_CHECK(fds_record_find(FDS_FILE_ID, key, &desc, &token) == FDS_ERR_NOT_FOUND);
+        }
+        miss_ns += time_ns_get() - bench_find.start;
+
+        /* Visit every record, as an application does to list its data. */
+        benchmark_start(&bench_find);
+        memset(&token, 0, sizeof(token));
+        for (uint16_t k = 1; k < key; k++)
+        {
+            APP_ERROR_CHECK(fds_record_iterate(&desc, &token));
+        }
+        BENCH_CHECK(fds_record_iterate(&desc, &token) == FDS_ERR_NOT_FOUND);
+        memset(&token, 0, sizeof(token));
+        for (uint16_t k = 1; k < key; k++)
+        {
+            APP_ERROR_CHECK(fds_record_find_in_file(FDS_FILE_ID, &desc, &token));
+        }
+        BENCH_CHECK(fds_record_find_in_file(FDS_FILE_ID, &desc, &token) == FDS_ERR_NOT_FOUND);
+        iter_ns += time_ns_get() - bench_find.start;
+
+        /* Delete all records and reclaim the space. */
+        m_fds_pending++;
+        APP_ERROR_CHECK(fds_file_delete(FDS_FILE_ID));
+        fds_wait();
+
+        benchmark_start(&bench_gc);
+        m_fds_pending++;
+        APP_ERROR_CHECK(fds_gc());
+        fds_wait();
+        gc_ns += time_ns_get() - bench_gc.start;
+
+        APP_ERROR_CHECK(fds_stat(&stat));
+        BENCH_CHECK((stat.valid_records == 0) && (stat.dirty_records == 0));
+        BENCH_CHECK(stat.freeable_words == 0);
+    }
+
+    printf("%-32s %10.1f ns/op\n", "fds_record_write (16B)",  (double)write_ns / writes);
+    printf("%-32s %10.1f ns/op\n", "fds_record_find+open",    (double)find_ns / finds);
+    printf("%-32s %10.1f ns/op\n", "fds_record_find (missing)",
+           (double)miss_ns / (FDS_ROUNDS * FDS_MISS_LOOKUPS));
+    printf("%-32s %10.1f ns/op\n", "fds_record_iterate+find_in_file",
+           (double)iter_ns / (2 * finds));
+    printf("%-32s %10.1f ns/op\n", "fds_gc (all pages)",      (double)gc_ns / FDS_ROUNDS);
+}
+
+
+/**@brief Function for checking one kind of FDS search against iteration over all records.
+ *
+ * @param[in] p_file_id     File ID to search for, or NULL.
+ * @param[in] p_record_key  Record key to search for, or NULL.
+ * @param[in] p_descs       Descriptors of all records, in the order of fds_record_iterate().
+ * @param[in] count         Number of records.
+ */
+static void fds_find_compare(uint16_t          const * p_file_id,
+                             uint16_t          const * p_record_key,
+                             fds_record_desc_t const * p_descs,
+                             uint32_t                  count)
+{
+    fds_find_token_t token = {0};
+
+    for (uint32_t i = 0; i <= count; i++)
+    {
+        fds_record_desc_t  desc;
+        fds_flash_record_t flash_rec;
+        ret_code_t         err_code;
+
+        if (i < count)
+        {
+            fds_record_desc_t copy = p_descs[i];
+
+            APP_ERROR_CHECK(fds_record_open(&copy, &flash_rec));
+            APP_ERROR_CHECK(fds_record_close(&copy));
+            if (   ((p_file_id    != NULL) && (flash_rec.p_header->file_id    != *p_file_id))
+                || ((p_record_key != NULL) && (flash_rec.p_header->record_key != *p_record_key)))
+            {
+                continue;
+            }
+        }
+
+        if ((p_file_id != NULL) && (p_record_key != NULL))
+        {
+            err_code = fds_record_find(*p_file_id, *p_record_key, &desc, &token);
+        }
+        else if (p_file_id != NULL)
+        {
+            err_code = fds_record_find_in_file(*p_file_id, &desc, &token);
+        }
+        else
+        {
+            err_code = fds_record_find_by_key(*p_record_key, &desc, &token);
+        }
+
+        if (i == count)
+        {
+            BENCH_CHECK(err_code == FDS_ERR_NOT_FOUND);
+        }
+        else
+        {
+            APP_ERROR_CHECK(err_code);
+            BENCH_CHECK(desc.record_id == p_descs[i].record_id);
+        }
+    }
+}
+
+
+/**@brief Function for checking that every kind of FDS search finds the same records.
+ *
+ * Several records are written with each file ID and key, and some of them are deleted.
+ * Searches by file ID and record key, which use the record index if it is enabled, and searches
+ * by file ID or by key alone, which scan flash, must return the records in the order in which
+ * fds_record_iterate() returns them, before and after garbage collection moves them.
+ * Descriptors which were obtained before garbage collection must still open their records.
+ */
+static void fds_find_check(void)
+{
+    static fds_record_desc_t descs[FDS_RECORDS_MAX];
+    uint32_t                 record[FDS_RECORD_WORDS] = {0};
+    uint32_t                 count = 0;
+    fds_find_token_t         token = {0};
+    fds_record_desc_t        desc;
+    fds_flash_record_t       flash_rec;
+
+    if (!m_fds_initialized)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < 2 * FDS_FIND_KEYS * FDS_FIND_COPIES; i++)
+    {
+        fds_record_t const rec =
+        {
+            .file_id = FDS_FILE_ID + (i % 2),
+            .key     = 1 + ((i / 2) % FDS_FIND_KEYS),
+            .data    = { .p_data = record, .length_words = FDS_RECORD_WORDS },
+        };
+
+        record[0] = i;
+        m_fds_pending++;
+        APP_ERROR_CHECK(fds_record_write(&desc, &rec));
+        fds_wait();
+        if ((i % 5) == 0)
+        {
+            m_fds_pending++;
+            APP_ERROR_CHECK(fds_record_delete(&desc));
+            fds_wait();
+        }
+    }
+
+    while (fds_record_iterate(&descs[count], &token) == FDS_SUCCESS)
+    {
+        count++;
+    }
+    BENCH_CHECK(count == (2 * FDS_FIND_KEYS * FDS_FIND_COPIES * 4) / 5);
+
+    for (uint32_t gc = 0; gc < 2; gc++)
+    {
+        for (uint16_t file_id = FDS_FILE_ID; file_id <= FDS_FILE_ID + 2; file_id++)
+        {
+            fds_find_compare(&file_id, NULL, descs, count);
+            for (uint16_t key = 1; key <= FDS_FIND_KEYS + 1; key++)
+            {
+                fds_find_compare(&file_id, &key, descs, count);
+                fds_find_compare(NULL, &key, descs, count);
+            }
+        }
+
+        m_fds_pending++;
+        APP_ERROR_CHECK(fds_gc());
+        fds_wait();
+
+        /* The descriptors point to the old location of the records, which must be found again. */
+        for (uint32_t i = 0; i < count; i++)
+        {
+            desc = descs[i];
+            APP_ERROR_CHECK(fds_record_open(&desc, &flash_rec));
+            BENCH_CHECK(flash_rec.p_header->record_id == descs[i].record_id);
+            APP_ERROR_CHECK(fds_record_close(&desc));
+        }
+    }
+
+    for (uint16_t file_id = FDS_FILE_ID; file_id <= FDS_FILE_ID + 1; file_id++)
+    {
+        m_fds_pending++;
+        APP_ERROR_CHECK(fds_file_delete(file_id));
+        fds_wait();
+    }
+    m_fds_pending++;
+    APP_ERROR_CHECK(fds_gc());
+    fds_wait();
+}
+
+
+/**@brief Function for telling whether the FDS garbage collection checks delete a record.
+ *
+ * Every fourth record is deleted, and in the first half of the records another one in four,
+ * so that more space can be reclaimed from some pages than from others.
+ */
+static bool fds_gc_key_deleted(uint16_t key, uint16_t count)
+{
+    return ((key % 4) == 0) || (((key % 4) == 1) && (key < (count / 2)));
+}
+
+
+/**@brief Function for deleting the records of the FDS checks and reclaiming their space. */
+static void fds_clear(void)
+{
+    m_fds_pending++;
+    APP_ERROR_CHECK(fds_file_delete(FDS_FILE_ID));
+    fds_wait();
+    m_fds_pending++;
+    APP_ERROR_CHECK(fds_gc());
+    fds_wait();
+}
+
+
+/**@brief Function for writing records until there is no space left.
+ *
+ * @return Number of records written. Their keys start from 1.
+ */
+static uint16_t fds_fill(void)
+{
+    uint32_t record[FDS_RECORD_WORDS] = {0};
+    uint16_t count;
+
+    for (count = 0; ; count++)
+    {
+        fds_record_t const rec =
+        {
+            .file_id = FDS_FILE_ID,
+            .key     = count + 1,
+            .data    = { .p_data = record, .length_words = FDS_RECORD_WORDS },
+        };
+        ret_code_t err_code;
+
+        record[0] = count + 1;
+        record[1] = ~record[0];
+        m_fds_pending++;
+        err_code = fds_record_write(NULL, &rec);
+        if (err_code == FDS_ERR_NO_SPACE_IN_FLASH)
+        {
+            m_fds_pending--;
+            break;
+        }
+        APP_ERROR_CHECK(err_code);
+        fds_wait();
+    }
+
+    return count;
+}
+
+
+/**@brief Function for filling the FDS pages with records and deleting some of them.
+ *
+ * @return Number of records written. Their keys start from 1.
+ */
+static uint16_t fds_gc_setup(void)
+{
+    uint16_t count;
+
+    fds_clear();
+    count = fds_fill();
+
+    for (uint16_t key = 1; key <= count; key++)
+    {
+        if (fds_gc_key_deleted(key, count))
+        {
+            fds_record_desc_t desc;
+            fds_find_token_t  token = {0};
+
+            APP_ERROR_CHECK(fds_record_find(FDS_FILE_ID, key, &desc, &token));
+            m_fds_pending++;
+            APP_ERROR_CHECK(fds_record_delete(&desc));
+            fds_wait();
+        }
+    }
+
+    return count;
+}
+
+
+/**@brief Function for checking that exactly the records which were not deleted are found. */
+static void fds_gc_records_check(uint16_t count)
+{
+    for (uint16_t key = 1; key <= count + 1; key++)
+    {
+        fds_record_desc_t  desc;
+        fds_find_token_t   token = {0};
+        fds_flash_record_t flash_rec;
+        ret_code_t         err_code = fds_record_find(FDS_FILE_ID, key, &desc, &token);
+
+        if ((key > count) || fds_gc_key_deleted(key, count))
+        {
+            BENCH_CHECK(err_code == FDS_ERR_NOT_FOUND);
+            continue;
+        }
+
+        APP_ERROR_CHECK(err_code);
+        APP_ERROR_CHECK(fds_record_open(&desc, &flash_rec));
+        BENCH_CHECK(((uint32_t const *)flash_rec.p_data)[0] == key);
+        BENCH_CHECK(((uint32_t const *)flash_rec.p_data)[1] == (uint32_t)~key);
+        APP_ERROR_CHECK(fds_record_close(&desc));
+    }
+}
+
+
+/**@brief Function for opening the first and the last record which were not deleted. */
+static void fds_gc_records_open(uint16_t count, fds_record_desc_t * p_descs)
+{
+    uint16_t keys[2] = {2, count};
+
+    while (fds_gc_key_deleted(keys[1], count))
+    {
+        keys[1]--;
+    }
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(keys); i++)
+    {
+        fds_find_token_t   token = {0};
+        fds_flash_record_t flash_rec;
+
+        APP_ERROR_CHECK(fds_record_find(FDS_FILE_ID, keys[i], &p_descs[i], &token));
+        APP_ERROR_CHECK(fds_record_open(&p_descs[i], &flash_rec));
+    }
+}
+
+
+/**@brief Function for requesting garbage collection while garbage collection is running.
+ *
+ * Garbage collection of one page is started with flash operations deferred. It is started by
+ * fds_gc_incremental(), or, if @p is_auto is set, by a write which finds no space. After
+ * @p steps flash operations, fds_gc() is called, as an application does when it runs out
+ * of space. If @p open is set, records are opened when the first page has been picked, so that
+ * its copy in the swap page is discarded.
+ *
+ * @return Number of flash operations.
+ */
+static uint32_t fds_gc_overlap_run(uint32_t steps, bool is_auto, bool open)
+{
+    uint16_t const    count    = fds_gc_setup();
+    uint32_t const    rewrites = nrf_fstorage_ram_rewrites_get();
+    uint32_t const    events   = m_fds_gc_events;
+    uint32_t          ops      = 0;
+    uint32_t          record[FDS_RECORD_WORDS] = {0};
+    fds_record_desc_t descs[2];
+    fds_stat_t        stat;
+    uint16_t          freeable;
+
+    APP_ERROR_CHECK(fds_stat(&stat));
+    freeable = stat.freeable_words;
+    BENCH_CHECK(freeable != 0);
+
+    nrf_fstorage_ram_defer(true);
+    if (is_auto)
+    {
+        fds_record_t const rec =
+        {
+            .file_id = FDS_FILE_ID,
+            .key     = count + 1,
+            .data    = { .p_data = record, .length_words = FDS_RECORD_WORDS },
+        };
+
+        BENCH_CHECK(fds_record_write(NULL, &rec) == FDS_ERR_NO_SPACE_IN_FLASH);
+    }
+    else
+    {
+        m_fds_pending++;
+        APP_ERROR_CHECK(fds_gc_incremental(1));
+    }
+    if (open)
+    {
+        fds_gc_records_open(count, descs);
+    }
+
+    while ((ops < steps) && nrf_fstorage_ram_process())
+    {
+        ops++;
+    }
+    m_fds_pending++;
+    APP_ERROR_CHECK(fds_gc());
+    while (nrf_fstorage_ram_process())
+    {
+        ops++;
+    }
+    nrf_fstorage_ram_defer(false);
+
+    BENCH_CHECK(m_fds_pending == 0);
+    BENCH_CHECK(m_fds_gc_events == events + (is_auto ? 1 : 2));
+    BENCH_CHECK(nrf_fstorage_ram_rewrites_get() == rewrites);
+
+    APP_ERROR_CHECK(fds_stat(&stat));
+    if (open)
+    {
+        /* Neither page can be collected with open records. */
+        BENCH_CHECK(stat.freeable_words == freeable);
+        for (uint32_t i = 0; i < ARRAY_SIZE(descs); i++)
+        {
+            APP_ERROR_CHECK(fds_record_close(&descs[i]));
+        }
+        m_fds_pending++;
+        APP_ERROR_CHECK(fds_gc());
+        fds_wait();
+        APP_ERROR_CHECK(fds_stat(&stat));
+    }
+    BENCH_CHECK((stat.freeable_words == 0) && (stat.dirty_records == 0));
+    fds_gc_records_check(count);
+
+    return ops;
+}
+
+
+#if (FDS_GC_AUTO_ENABLED)
+/**@brief Function for checking that garbage collection is run automatically when it helps.
+ *
+ * While every record is open, no page can be collected, and writes which find no space must
+ * not start garbage collection, which would invalidate the cached locations of all records.
+ * Once the records are closed, a write which finds no space must start it, without an event.
+ */
+static void fds_gc_auto_check(void)
+{
+    static fds_record_desc_t descs[FDS_RECORDS_MAX];
+
+    uint16_t const     count  = fds_gc_setup();
+    uint32_t const     events = m_fds_gc_events;
+    uint32_t           record[FDS_RECORD_WORDS] = {0};
+    uint32_t           opened = 0;
+    fds_record_desc_t  desc;
+    fds_find_token_t   token;
+    fds_flash_record_t flash_rec;
+    fds_stat_t         stat;
+    uint16_t           run_count;
+    fds_record_t const rec =
+    {
+        .file_id = FDS_FILE_ID,
+        .key     = count + 1,
+        .data    = { .p_data = record, .length_words = FDS_RECORD_WORDS },
+    };
+
+    for (uint16_t key = 1; key <= count; key++)
+    {
+        if (!fds_gc_key_deleted(key, count))
+        {
+            memset(&token, 0, sizeof(token));
+            APP_ERROR_CHECK(fds_record_find(FDS_FILE_ID, key, &descs[opened], &token));
+            APP_ERROR_CHECK(fds_record_open(&descs[opened], &flash_rec));
+            opened++;
+        }
+    }
+    run_count = descs[0].gc_run_count;
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        BENCH_CHECK(fds_record_write(NULL, &rec) == FDS_ERR_NO_SPACE_IN_FLASH);
+    }
+    memset(&token, 0, sizeof(token));
+    APP_ERROR_CHECK(fds_record_find(FDS_FILE_ID, 2, &desc, &token));
+    BENCH_CHECK(desc.gc_run_count == run_count);
+    APP_ERROR_CHECK(fds_stat(&stat));
+    BENCH_CHECK(stat.dirty_records != 0);
+
+    for (uint32_t i = 0; i < opened; i++)
+    {
+        APP_ERROR_CHECK(fds_record_close(&descs[i]));
+    }
+
+    /* Garbage collection runs while the write returns, as flash operations are synchronous. */
+    BENCH_CHECK(fds_record_write(NULL, &rec) == FDS_ERR_NO_SPACE_IN_FLASH);
+    memset(&token, 0, sizeof(token));
+    APP_ERROR_CHECK(fds_record_find(FDS_FILE_ID, 2, &desc, &token));
+    BENCH_CHECK(desc.gc_run_count == (uint16_t)(run_count + 1));
+    BENCH_CHECK(m_fds_gc_events == events);
+
+    m_fds_pending++;
+    APP_ERROR_CHECK(fds_record_write(NULL, &rec));
+    fds_wait();
+    m_fds_pending++;
+    APP_ERROR_CHECK(fds_gc());
+    fds_wait();
+    APP_ERROR_CHECK(fds_stat(&stat));
+    BENCH_CHECK((stat.freeable_words == 0) && (stat.valid_records == opened + 1));
+}
+#endif
+
+
+/**@brief Function for checking FDS garbage collection.
+ *
+ * fds_gc_incremental() must collect the page from which the most space can be reclaimed.
+ * Garbage collection requested while garbage collection is running must neither repeat
+ * nor skip flash operations, which is checked with fds_gc() called after every flash operation
+ * of a garbage collection. The emulated flash counts writes which change nothing.
+ */
+static void fds_gc_check(void)
+{
+    uint32_t   ops;
+    uint16_t   count;
+    uint16_t   freeable;
+    fds_stat_t stat;
+
+    if (!m_fds_initialized)
+    {
+        return;
+    }
+
+    count = fds_gc_setup();
+    APP_ERROR_CHECK(fds_stat(&stat));
+    freeable = stat.freeable_words;
+
+    BENCH_CHECK(fds_gc_incremental(0) == FDS_ERR_INVALID_ARG);
+    m_fds_pending++;
+    APP_ERROR_CHECK(fds_gc_incremental(1));
+    fds_wait();
+    APP_ERROR_CHECK(fds_stat(&stat));
+    BENCH_CHECK((stat.freeable_words != 0) && (stat.freeable_words < freeable));
+    BENCH_CHECK(stat.freeable_words <= freeable - stat.freeable_words);
+    fds_gc_records_check(count);
+
+    m_fds_pending++;
+    APP_ERROR_CHECK(fds_gc_incremental(FDS_VIRTUAL_PAGES));
+    fds_wait();
+    APP_ERROR_CHECK(fds_stat(&stat));
+    BENCH_CHECK(stat.freeable_words == 0);
+    fds_gc_records_check(count);
+
+    for (uint32_t mode = 0; mode < 3; mode++)
+    {
+        bool const is_auto = (mode == 2);
+        bool const open    = (mode == 1);
+
+        if (is_auto && !FDS_GC_AUTO_ENABLED)
+        {
+            break;
+        }
+
+        ops = fds_gc_overlap_run(UINT32_MAX, is_auto, open);
+        for (uint32_t steps = 0; steps < ops; steps++)
+        {
+            BENCH_CHECK(fds_gc_overlap_run(steps, is_auto, open) == ops);
+        }
+    }
+
+#if (FDS_GC_AUTO_ENABLED)
+    fds_gc_auto_check();
+#endif
+
+    fds_clear();
+}
+
+
+/**@brief Function for writing a batch of records, with the flash failing after a number of
+ *        operations.
+ *
+ * The records which the FDS_EVT_WRITE_BATCH event reports as written must be found, and
+ * the others must not.
+ *
+ * @param[in] p_records Records to write.
+ * @param[in] steps     Number of flash operations which succeed.
+ *
+ * @return Number of records written.
+ */
+static uint16_t fds_batch_run(fds_record_t const * p_records, uint32_t steps)
+{
+    fds_record_desc_t descs[FDS_BATCH_SIZE];
+    uint16_t          committed;
+
+    nrf_fstorage_ram_defer(true);
+    m_fds_pending++;
+    APP_ERROR_CHECK(fds_record_write_batch(descs, p_records, FDS_BATCH_SIZE));
+    for (uint32_t i = 0; (i < steps) && nrf_fstorage_ram_process(); i++)
+    {
+    }
+    m_fds_result = FDS_ERR_OPERATION_TIMEOUT;
+    if (!nrf_fstorage_ram_interrupt(0, true))
+    {
+        /* The batch was written before the flash failed. */
+        BENCH_CHECK(m_fds_evt.result == FDS_SUCCESS);
+    }
+    m_fds_result = FDS_SUCCESS;
+    nrf_fstorage_ram_defer(false);
+
+    BENCH_CHECK(m_fds_pending == 0);
+    BENCH_CHECK((m_fds_evt.id == FDS_EVT_WRITE_BATCH) && (m_fds_evt.batch.count == FDS_BATCH_SIZE));
+    BENCH_CHECK(m_fds_evt.batch.first_record_id == descs[0].record_id);
+    committed = m_fds_evt.batch.committed;
+    BENCH_CHECK((committed == FDS_BATCH_SIZE) || (m_fds_evt.result != FDS_SUCCESS));
+
+    for (uint16_t i = 0; i < FDS_BATCH_SIZE; i++)
+    {
+        fds_flash_record_t flash_rec;
+        fds_find_token_t   token    = {0};
+        fds_record_desc_t  desc;
+        ret_code_t         err_code = fds_record_open(&descs[i], &flash_rec);
+
+        if (i >= committed)
+        {
+            BENCH_CHECK(err_code == FDS_ERR_NOT_FOUND);
+            BENCH_CHECK(fds_record_find(FDS_FILE_ID, i + 1, &desc, &token) == FDS_ERR_NOT_FOUND);
+            continue;
+        }
+
+        BENCH_CHECK(err_code == NRF_SUCCESS);
+        if (err_code != NRF_SUCCESS)
+        {
+            continue;
+        }
+        BENCH_CHECK(flash_rec.p_header->record_key == p_records[i].key);
+        BENCH_CHECK(flash_rec.p_header->length_words == p_records[i].data.length_words);
+        BENCH_CHECK(memcmp(flash_rec.p_data, p_records[i].data.p_data,
+                           p_records[i].data.length_words * sizeof(uint32_t)) == 0);
+        APP_ERROR_CHECK(fds_record_close(&descs[i]));
+        APP_ERROR_CHECK(fds_record_find(FDS_FILE_ID, i + 1, &desc, &token));
+        BENCH_CHECK(desc.record_id == descs[i].record_id);
+    }
+
+    fds_clear();
+
+    return committed;
+}
+
+
+/**@brief Function for checking batch writes which complete, fail partway, or find no space.
+ *
+ * A batch is written with the flash failing after each of its flash operations in turn, so
+ * that it fails before every record is committed and after the last one.
+ */
+static void fds_batch_check(void)
+{
+    static uint32_t data[FDS_BATCH_SIZE][FDS_RECORD_WORDS];
+    fds_record_t    records[FDS_BATCH_SIZE];
+    uint16_t        committed = 0;
+    uint32_t        steps;
+    fds_stat_t      stat;
+    uint16_t        valid;
+
+    if (!m_fds_initialized)
+    {
+        return;
+    }
+
+    /* Records of every length up to FDS_RECORD_WORDS, including empty ones. */
+    for (uint16_t i = 0; i < FDS_BATCH_SIZE; i++)
+    {
+        for (uint32_t j = 0; j < FDS_RECORD_WORDS; j++)
+        {
+            data[i][j] = (i << 16) | j;
+        }
+        records[i].file_id           = FDS_FILE_ID;
+        records[i].key               = i + 1;
+        records[i].data.p_data       = data[i];
+        records[i].data.length_words = i % (FDS_RECORD_WORDS + 1);
+    }
+
+    fds_clear();
+    for (steps = 0; committed < FDS_BATCH_SIZE; steps++)
+    {
+        uint16_t const prev = committed;
+
+        committed = fds_batch_run(records, steps);
+        BENCH_CHECK((committed == prev) || (committed == prev + 1));
+    }
+    BENCH_CHECK(fds_batch_run(records, steps) == FDS_BATCH_SIZE);
+
+    /* A batch which does not fit is not started. */
+    valid = fds_fill();
+    APP_ERROR_CHECK(fds_stat(&stat));
+    BENCH_CHECK(stat.valid_records == valid);
+    BENCH_CHECK(fds_record_write_batch(NULL, records, FDS_BATCH_SIZE) == FDS_ERR_NO_SPACE_IN_FLASH);
+    BENCH_CHECK(m_fds_pending == 0);
+    APP_ERROR_CHECK(fds_stat(&stat));
+    BENCH_CHECK((stat.valid_records == valid) && (stat.dirty_records == 0));
+    BENCH_CHECK(stat.words_reserved == 0);
+    fds_clear();
+}
+
+
+/**@brief Function for generating the timer trace.
+ *
+ * The trace mixes short timeouts, which are started and stopped often like protocol timers,
+ * with long ones like periodic housekeeping. Operations come in bursts, with longer gaps
+ * between them and idle periods in which all running timers expire.
+ */
+static void timer_trace_generate(void)
+{
+    m_rand = 1;
+
+    for (uint32_t i = 0; i < TIMER_TRACE_OPS; i++)
+    {
+        timer_op_t * p_op = &m_timer_trace[i];
+
+        p_op->timer   = rand_get() % TIMER_COUNT;
+        p_op->delay   = ((rand_get() % 4) != 0) ? (rand_get() % 200) : (rand_get() % 50000);
+        p_op->timeout = 0;
+        p_op->slack   = 0;
+
+        if ((i % TIMER_IDLE_OPS) == (TIMER_IDLE_OPS - 1))
+        {
+            p_op->delay += TIMER_IDLE_TICKS;
+        }
+
+        if ((rand_get() % 3) == 0)
+        {
+            /* Stop. */
+            continue;
+        }
+
+        if ((p_op->timer % TIMER_REPEAT_EVERY) == 0)
+        {
+            p_op->timeout = 1000 + (rand_get() % 30000);
+        }
+        else if ((rand_get() % 8) == 0)
+        {
+            p_op->timeout = 5 + (rand_get() % 16000000);
+        }
+        else if ((rand_get() % 5) == 0)
+        {
+            p_op->timeout = 5 + (rand_get() % 2000000);
+        }
+        else
+        {
+            p_op->timeout = 5 + (rand_get() % 3000);
+        }
+
+        if ((rand_get() % 2) == 0)
+        {
+            p_op->slack = rand_get() % (1 + (p_op->timeout / 4));
+            p_op->slack = MIN(p_op->slack, TIMER_TIMEOUT_MAX - p_op->timeout);
+        }
+    }
+}
+
+
+/**@brief Function for checking that a timer expires within its slack window. */
+static void timer_timeout_handler(void * p_context)
+{
+    timer_state_t * p_state = (timer_state_t *)p_context;
+    uint32_t        late    = app_timer_cnt_diff_compute(app_timer_cnt_get(), p_state->expected);
+
+    /* The counter wraps around, so a timer which expires early is late by nearly its range. An
+     * expiry may come up to DRV_RTC_MIN_TICK_HANDLED ticks early, when the compare value was too
+     * close to be configured. */
+    BENCH_CHECK(p_state->running);
+    BENCH_CHECK((late <= p_state->slack) || (late >= DRV_RTC_MAX_CNT + 1 - DRV_RTC_MIN_TICK_HANDLED));
+
+    m_timer_expirations++;
+    if (p_state->period != 0)
+    {
+        p_state->expected = (p_state->expected + p_state->period) & DRV_RTC_MAX_CNT;
+    }
+    else
+    {
+        p_state->running = false;
+    }
+}
+
+
+static void timer_benchmark(void)
+{
+    rtc_sim_stats_t stats;
+    uint64_t        start_ns = 0;
+    uint64_t        stop_ns  = 0;
+    uint32_t        starts   = 0;
+    uint32_t        stops    = 0;
+
+#if (APP_TIMER_CONFIG_USE_WHEEL)
+    printf("app_timer: timing wheel\n");
+#else
+    printf("app_timer: sorted list\n");
+#endif
+
+    timer_trace_generate();
+
+    APP_ERROR_CHECK(app_timer_init());
+    for (uint32_t i = 0; i < TIMER_COUNT; i++)
+    {
+        app_timer_id_t const id   = &m_timers[i];
+        app_timer_mode_t     mode = ((i % TIMER_REPEAT_EVERY) == 0) ? APP_TIMER_MODE_REPEATED
+                                                                     : APP_TIMER_MODE_SINGLE_SHOT;
+
+        APP_ERROR_CHECK(app_timer_create(&id, mode, timer_timeout_handler));
+    }
+
+    /* Replay the trace. Requests are handled in the interrupt which they trigger, so the time
+     * of a start or stop includes processing it. */
+    rtc_sim_stats_get(&stats);
+    for (uint32_t i = 0; i < TIMER_TRACE_OPS; i++)
+    {
+        timer_op_t const * p_op    = &m_timer_trace[i];
+        timer_state_t    * p_state = &m_timer_states[p_op->timer];
+        uint64_t           start;
+
+        rtc_sim_run(p_op->delay);
+
+        if (p_state->running || (p_op->timeout == 0))
+        {
+            p_state->running = false;
+
+            start = time_ns_get();
+            APP_ERROR_CHECK(app_timer_stop(&m_timers[p_op->timer]));
+            stop_ns += time_ns_get() - start;
+            stops++;
+        }
+
+        if (p_op->timeout != 0)
+        {
+            p_state->expected = (app_timer_cnt_get() + p_op->timeout) & DRV_RTC_MAX_CNT;
+            p_state->slack    = p_op->slack;
+            p_state->period   = ((p_op->timer % TIMER_REPEAT_EVERY) == 0) ? p_op->timeout : 0;
+            p_state->running  = true;
+
+            start = time_ns_get();
+            APP_ERROR_CHECK(app_timer_start_with_slack(&m_timers[p_op->timer],
+                                                       p_op->timeout, p_op->slack, p_state));
+            start_ns += time_ns_get() - start;
+            starts++;
+        }
+    }
+
+    /* Stop the repeated timers and let every single shot timer expire. */
+    for (uint32_t i = 0; i < TIMER_COUNT; i += TIMER_REPEAT_EVERY)
+    {
+        m_timer_states[i].running = false;
+        APP_ERROR_CHECK(app_timer_stop(&m_timers[i]));
+    }
+    rtc_sim_run(DRV_RTC_MAX_CNT + 1);
+    rtc_sim_stats_get(&stats);
+
+    for (uint32_t i = 0; i < TIMER_COUNT; i++)
+    {
+        BENCH_CHECK(!m_timer_states[i].running);
+    }
+    BENCH_CHECK((stats.evt_irqs != 0) && (m_timer_expirations != 0));
+
+    printf("%-32s %10.1f ns/op\n", "app_timer_start (trace)", (double)start_ns / starts);
+    printf("%-32s %10.1f ns/op\n", "app_timer_stop (trace)",  (double)stop_ns / stops);
+    printf("%-32s %10.1f ns/op\n", "RTC interrupt",
+           (double)stats.evt_ns / stats.evt_irqs);
+    printf("%-32s %10.3f ns/tick\n", "RTC interrupt time per tick",
+           (double)(stats.evt_ns + stats.sw_ns) / stats.ticks);
+    printf("%-32s %10.2f\n", "expirations per RTC interrupt",
+           (double)m_timer_expirations / stats.evt_irqs);
+}
+
+
+/**@brief Format strings of the log entries, by number of arguments. */
+static char const * const m_log_std_str[LOG_ARGS_MAX] =
+{
+    "%08X", "%08X %08X", "%08X %08X %08X", "%08X %08X %08X %08X", "%08X %08X %08X %08X %08X",
+    "%08X %08X %08X %08X %08X %08X"
+};
+
+static char const m_log_push_str[] = "%08X %s";     /**< Format string of the entries with a pushed string. */
+
+static uint32_t m_log_last_seq[LOG_THREADS + 1];    /**< Last sequence number received from each thread. */
+static uint32_t m_log_received;                     /**< Number of log entries received by the backend. */
+static uint32_t m_log_dropped;                      /**< Number of log entries reported as dropped. */
+static uint32_t m_log_saturated;                    /**< Number of entries with a saturated dropped count. */
+static uint32_t m_log_writers_done;                 /**< Number of logging threads which are done. */
+
+
+/**@brief Function for getting an argument of a log entry, or a byte of a hexdump.
+ *
+ * @param[in] id    Entry identifier, which holds the thread number and the sequence number.
+ * @param[in] idx   Index of the argument or byte.
+ */
+static uint32_t log_word_get(uint32_t id, uint32_t idx)
+{
+    uint32_t word = (id * 0x9E3779B1UL) ^ ((idx + 1) * 0xC2B2AE3DUL);
+
+    return word ^ (word >> 15);
+}
+
+
+/**@brief Function for getting the length of the hexdump with a given identifier. */
+static uint32_t log_hexdump_len_get(uint32_t id)
+{
+    return sizeof(id) + (id % (LOG_HEXDUMP_MAX - sizeof(id)));
+}
+
+
+/**@brief Function for getting a string address as stored in the header of a log entry. */
+static uint32_t log_str_addr_get(char const * p_str)
+{
+    return (uint32_t)(uintptr_t)p_str & STD_ADDR_MASK;
+}
+
+
+/**@brief Function for checking a log entry passed to the backend.
+ *
+ * Every argument and hexdump byte is derived from the entry identifier, so a torn entry is
+ * detected. Entries of each thread must come in order.
+ */
+static void log_backend_put(nrf_log_backend_t const * p_backend, nrf_log_entry_t * p_entry)
+{
+    nrf_log_header_t header;
+    uint32_t         id;
+
+    (void)p_backend;
+    nrf_memobj_read(p_entry, &header, HEADER_SIZE * sizeof(uint32_t), 0);
+
+    if (header.base.generic.type == HEADER_TYPE_STD)
+    {
+        uint32_t args[LOG_ARGS_MAX];
+        uint32_t nargs = header.base.std.nargs;
+
+        BENCH_CHECK((nargs >= 1) && (nargs <= LOG_ARGS_MAX));
+        nrf_memobj_read(p_entry, args, nargs * sizeof(uint32_t), HEADER_SIZE * sizeof(uint32_t));
+        id = args[0];
+
+        if (header.base.std.addr == log_str_addr_get(m_log_push_str))
+        {
+            char expected[sizeof(LOG_PUSH_FMT) + 8];
+
+            /* A string which did not fit is pushed as NULL. */
+            BENCH_CHECK(nargs == 2);
+            if (args[1] != 0)
+            {
+                (void)snprintf(expected, sizeof(expected), LOG_PUSH_FMT, (unsigned)id);
+                BENCH_CHECK(strcmp((char const *)(uintptr_t)args[1], expected) == 0);
+            }
+        }
+        else
+        {
+            BENCH_CHECK(header.base.std.addr == log_str_addr_get(m_log_std_str[nargs - 1]));
+            for (uint32_t i = 1; i < nargs; i++)
+            {
+                BENCH_CHECK(args[i] == log_word_get(id, i));
+            }
+        }
+    }
+    else
+    {
+        uint8_t  data[LOG_HEXDUMP_MAX];
+        uint32_t len = header.base.hexdump.len;
+
+        BENCH_CHECK(header.base.generic.type == HEADER_TYPE_HEXDUMP);
+        BENCH_CHECK((len >= sizeof(id)) && (len <= LOG_HEXDUMP_MAX));
+        nrf_memobj_read(p_entry, data, len, HEADER_SIZE * sizeof(uint32_t));
+        memcpy(&id, data, sizeof(id));
+        BENCH_CHECK(len == log_hexdump_len_get(id));
+        for (uint32_t i = sizeof(id); i < len; i++)
+        {
+            BENCH_CHECK(data[i] == (uint8_t)log_word_get(id, i));
+        }
+    }
+
+    BENCH_CHECK((id >> LOG_THREAD_POS) <= LOG_THREADS);
+    BENCH_CHECK((id & 0xFFFFFF) > m_log_last_seq[id >> LOG_THREAD_POS]);
+    m_log_last_seq[id >> LOG_THREAD_POS] = id & 0xFFFFFF;
+
+    m_log_received++;
+    m_log_dropped += header.dropped;
+    if (header.dropped == UINT16_MAX)
+    {
+        m_log_saturated++;
+    }
+}
+
+
+static void log_backend_panic_set(nrf_log_backend_t const * p_backend)
+{
+    (void)p_backend;
+}
+
+
+static void log_backend_flush(nrf_log_backend_t const * p_backend)
+{
+    (void)p_backend;
+}
+
+
+static nrf_log_backend_api_t const m_log_backend_api =
+{
+    .put       = log_backend_put,
+    .panic_set = log_backend_panic_set,
+    .flush     = log_backend_flush,
+};
+
+static nrf_log_backend_t m_log_backend =
+{
+    .p_api = &m_log_backend_api,
+};
+
+
+/**@brief Function for writing a log entry with 1 to 6 arguments. */
+static void log_std_write(uint32_t id, uint32_t nargs)
+{
+    uint32_t args[LOG_ARGS_MAX] = {id};
+
+    for (uint32_t i = 1; i < nargs; i++)
+    {
+        args[i] = log_word_get(id, i);
+    }
+
+    switch (nargs)
+    {
+        case 1:
+            nrf_log_frontend_std_1(NRF_LOG_SEVERITY_INFO, m_log_std_str[0], args[0]);
+            break;
+        case 2:
+            nrf_log_frontend_std_2(NRF_LOG_SEVERITY_INFO, m_log_std_str[1], args[0], args[1]);
+            break;
+        case 3:
+            nrf_log_frontend_std_3(NRF_LOG_SEVERITY_INFO, m_log_std_str[2],
+                                   args[0], args[1], args[2]);
+            break;
+        case 4:
+            nrf_log_frontend_std_4(NRF_LOG_SEVERITY_INFO, m_log_std_str[3],
+                                   args[0], args[1], args[2], args[3]);
+            break;
+        case 5:
+            nrf_log_frontend_std_5(NRF_LOG_SEVERITY_INFO, m_log_std_str[4],
+                                   args[0], args[1], args[2], args[3], args[4]);
+            break;
+        default:
+            nrf_log_frontend_std_6(NRF_LOG_SEVERITY_INFO, m_log_std_str[5],
+                                   args[0], args[1], args[2], args[3], args[4], args[5]);
+            break;
+    }
+}
+
+
+/**@brief Function for writing a mix of entries, hexdumps and pushed strings to the logger. */
+static void * log_writer_thread(void * p_arg)
+{
+    uint32_t thread = (uint32_t)(uintptr_t)p_arg;
+    uint32_t rand   = thread + 1;
+
+    for (uint32_t seq = 1; seq <= LOG_ENTRIES; seq++)
+    {
+        uint32_t id = (thread << LOG_THREAD_POS) | seq;
+
+        rand = (rand * 1103515245UL) + 12345UL;
+        switch ((rand >> 16) % 3)
+        {
+            case 0:
+                log_std_write(id, 1 + ((rand >> 20) % LOG_ARGS_MAX));
+                break;
+
+            case 1:
+            {
+                uint8_t data[LOG_HEXDUMP_MAX];
+
+                memcpy(data, &id, sizeof(id));
+                for (uint32_t i = sizeof(id); i < log_hexdump_len_get(id); i++)
+                {
+                    data[i] = (uint8_t)log_word_get(id, i);
+                }
+                nrf_log_frontend_hexdump(NRF_LOG_SEVERITY_INFO, data, log_hexdump_len_get(id));
+                break;
+            }
+
+            default:
+            {
+                char str[sizeof(LOG_PUSH_FMT) + 8];
+
+                (void)snprintf(str, sizeof(str), LOG_PUSH_FMT, (unsigned)id);
+                nrf_log_frontend_std_2(NRF_LOG_SEVERITY_INFO, m_log_push_str, id, nrf_log_push(str));
+                break;
+            }
+        }
+
+        if (((rand >> 24) & 0x03) == 0)
+        {
+            (void)sched_yield();
+        }
+    }
+
+    (void)__atomic_add_fetch(&m_log_writers_done, 1, __ATOMIC_SEQ_CST);
+    return NULL;
+}
+
+
+/**@brief Function for getting the timestamp of log entries, used if the logger stores them. */
+static uint32_t log_timestamp_get(void)
+{
+    return (uint32_t)(time_ns_get() / 1000);
+}
+
+
+/**@brief Function for checking that no log entry is lost or torn when several threads log.
+ *
+ * The logging threads and the thread which processes the entries run concurrently, like
+ * interrupts of different priorities and the idle loop. Entries which do not fit are dropped,
+ * so every entry must be either received whole or counted as dropped. The dropped count is
+ * reported with the next entry, so one more entry is written at the end.
+ */
+static void log_stress_check(void)
+{
+    benchmark_t bench;
+    pthread_t   writers[LOG_THREADS];
+
+    APP_ERROR_CHECK(NRF_LOG_INIT(log_timestamp_get));
+    BENCH_CHECK(nrf_log_backend_add(&m_log_backend, NRF_LOG_SEVERITY_DEBUG) >= 0);
+    nrf_log_backend_enable(&m_log_backend);
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < LOG_THREADS; i++)
+    {
+        BENCH_CHECK(pthread_create(&writers[i], NULL, log_writer_thread, (void *)(uintptr_t)i) == 0);
+    }
+    while (__atomic_load_n(&m_log_writers_done, __ATOMIC_SEQ_CST) < LOG_THREADS)
+    {
+        if (!NRF_LOG_PROCESS())
+        {
+            (void)sched_yield();
+        }
+    }
+    for (uint32_t i = 0; i < LOG_THREADS; i++)
+    {
+        BENCH_CHECK(pthread_join(writers[i], NULL) == 0);
+    }
+    while (NRF_LOG_PROCESS())
+    {
+    }
+    bench.ops = LOG_THREADS * LOG_ENTRIES;
+    benchmark_end(&bench, "nrf_log " STRINGIFY(LOG_THREADS) " threads");
+
+    log_std_write((LOG_THREADS << LOG_THREAD_POS) | 1, 1);
+    while (NRF_LOG_PROCESS())
+    {
+    }
+    BENCH_CHECK(m_log_last_seq[LOG_THREADS] == 1);
+    BENCH_CHECK(m_log_received + m_log_dropped <= LOG_THREADS * LOG_ENTRIES + 1);
+    BENCH_CHECK((m_log_received + m_log_dropped == LOG_THREADS * LOG_ENTRIES + 1) ||
+                (m_log_saturated != 0));
+
+    printf("%-32s %10.1f %%\n", "nrf_log entries dropped",
+           100.0 * m_log_dropped / (LOG_THREADS * LOG_ENTRIES));
+}
+
+
+/**@brief Binary output of the serial backend, which is built a second time with
+ *        NRF_LOG_BACKEND_SERIAL_BINARY enabled.
+ */
+void nrf_log_backend_serial_bin_put(nrf_log_backend_t const * p_backend,
+                                    nrf_log_entry_t         * p_msg,
+                                    uint8_t                 * p_buffer,
+                                    uint32_t                  length,
+                                    nrf_fprintf_fwrite        tx_func);
+
+NRF_MEMOBJ_POOL_DEF(m_log_serial_pool, LOG_SERIAL_CHUNK_SIZE, LOG_SERIAL_CHUNKS);
+
+/**@brief Format strings of the serial backend check and the kinds of their arguments: 'i' signed,
+ *        'u' unsigned, 'c' character, 's' string and 'w' field width.
+ */
+static log_serial_fmt_t const m_log_serial_fmts[] =
+{
+    {"no arguments",                    ""},
+    {"%d %i %u",                        "iiu"},
+    {"%5d|%-5d|%05d|%+d|%+5d",          "iiiii"},
+    {"%x %X %08x %p",                   "uuuu"},
+    {"%.3d %5.3d %08.3u %-+4d|",        "iiui"},
+    {"%c%c%c",                          "ccc"},
+    {"%s and %s",                       "ss"},
+    {"%10s|%-10s|%05s",                 "sss"},
+    {"%*d|%-*u|100%%",                  "wiwu"},
+    {"%lu %ld %hx %lX",                 "uiuu"},
+    {"%s: %d %s",                       "sis"},
+};
+
+/**@brief Strings passed as arguments, with SLIP framing bytes among them. */
+static char const * const m_log_serial_strs[] =
+{
+    "", "abc", "\xC0\xDB\xDC\xDD", "a string longer than its field width", "%d not a format"
+};
+
+static char     m_log_serial_text[LOG_SERIAL_OUT_MAX];  /**< Text output of an entry. */
+static uint32_t m_log_serial_text_len;                  /**< Length of the text output. */
+static uint8_t  m_log_serial_bin[LOG_SERIAL_OUT_MAX];   /**< Binary output of an entry. */
+static uint32_t m_log_serial_bin_len;                   /**< Length of the binary output. */
+
+
+/**@brief Function for storing the text output of the serial backend. */
+static void log_serial_text_write(void const * p_user_ctx, char const * p_str, size_t length)
+{
+    (void)p_user_ctx;
+    BENCH_CHECK(m_log_serial_text_len + length <= sizeof(m_log_serial_text));
+    memcpy(&m_log_serial_text[m_log_serial_text_len], p_str, length);
+    m_log_serial_text_len += length;
+}
+
+
+/**@brief Function for storing the binary output of the serial backend. */
+static void log_serial_bin_write(void const * p_user_ctx, char const * p_str, size_t length)
+{
+    (void)p_user_ctx;
+    BENCH_CHECK(m_log_serial_bin_len + length <= sizeof(m_log_serial_bin));
+    memcpy(&m_log_serial_bin[m_log_serial_bin_len], p_str, length);
+    m_log_serial_bin_len += length;
+}
+
+
+/**@brief Function for adding bytes to the decoded text. */
+static void log_bin_out_add(log_bin_out_t * p_out, char const * p_str, uint32_t len)
+{
+    BENCH_CHECK(p_out->len + len <= sizeof(p_out->text));
+    memcpy(&p_out->text[p_out->len], p_str, len);
+    p_out->len += len;
+}
+
+
+/**@brief Function for adding formatted text to the decoded text. */
+static void log_bin_out_printf(log_bin_out_t * p_out, char const * p_fmt, ...)
+{
+    va_list args;
+    int     len;
+
+    va_start(args, p_fmt);
+    len = vsnprintf(&p_out->text[p_out->len], sizeof(p_out->text) - p_out->len, p_fmt, args);
+    va_end(args);
+    BENCH_CHECK((len >= 0) && (p_out->len + len < sizeof(p_out->text)));
+    p_out->len += len;
+}
+
+
+/**@brief Function for reading a byte of a frame. */
+static uint8_t log_bin_byte_get(log_bin_reader_t * p_reader)
+{
+    if (p_reader->idx >= p_reader->len)
+    {
+        p_reader->error = true;
+        return 0;
+    }
+    return p_reader->p_data[p_reader->idx++];
+}
+
+
+/**@brief Function for reading a variable length integer of a frame. */
+static uint32_t log_bin_varint_get(log_bin_reader_t * p_reader)
+{
+    uint32_t value = 0;
+
+    for (uint32_t shift = 0; !p_reader->error; shift += 7)
+    {
+        uint8_t byte = log_bin_byte_get(p_reader);
+
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            break;
+        }
+        if (shift + 7 > 28)
+        {
+            p_reader->error = true;
+        }
+    }
+    return value;
+}
+
+
+/**@brief Function for reading a null terminated string of a frame. */
+static char const * log_bin_string_get(log_bin_reader_t * p_reader)
+{
+    char const * p_str = (char const *)&p_reader->p_data[p_reader->idx];
+
+    if (memchr(p_str, '\0', p_reader->len - p_reader->idx) == NULL)
+    {
+        p_reader->error = true;
+        return "";
+    }
+    p_reader->idx += strlen(p_str) + 1;
+    return p_str;
+}
+
+
+/**@brief Function for splitting a conversion specification the same way nrf_fprintf does.
+ *
+ * @param[in]  p_fmt    Format string after the '%' character.
+ * @param[out] p_spec   Conversion specification.
+ *
+ * @return Format string after the conversion specification.
+ */
+static char const * log_bin_spec_get(char const * p_fmt, log_bin_spec_t * p_spec)
+{
+    uint32_t len = 0;
+
+    memset(p_spec, 0, sizeof(log_bin_spec_t));
+    while ((*p_fmt == '-') || (*p_fmt == '0') || (*p_fmt == '+'))
+    {
+        BENCH_CHECK(len < sizeof(p_spec->flags) - 1);
+        p_spec->flags[len++] = *p_fmt++;
+    }
+    len = 0;
+    if (*p_fmt == '*')
+    {
+        p_spec->width_arg = true;
+        p_fmt++;
+    }
+    else
+    {
+        while (isdigit((int)*p_fmt))
+        {
+            BENCH_CHECK(len < sizeof(p_spec->width) - 1);
+            p_spec->width[len++] = *p_fmt++;
+        }
+    }
+    len = 0;
+    if (*p_fmt == '.')
+    {
+        p_fmt++;
+        while (isdigit((int)*p_fmt))
+        {
+            BENCH_CHECK(len < sizeof(p_spec->precision) - 1);
+            p_spec->precision[len++] = *p_fmt++;
+        }
+    }
+    while ((*p_fmt == 'l') || (*p_fmt == 'h'))
+    {
+        p_fmt++;
+    }
+    p_spec->conversion = *p_fmt;
+    return (*p_fmt != '\0') ? (p_fmt + 1) : p_fmt;
+}
+
+
+/**@brief Function for getting how each argument of an entry is encoded, from its format string. */
+static void log_bin_kinds_get(char const * p_fmt, uint8_t * p_kinds, uint32_t nargs)
+{
+    uint32_t count = 0;
+
+    while (*p_fmt != '\0')
+    {
+        log_bin_spec_t spec;
+        uint8_t        kind;
+
+        if (*p_fmt++ != '%')
+        {
+            continue;
+        }
+        p_fmt = log_bin_spec_get(p_fmt, &spec);
+        if (spec.width_arg && (count < nargs))
+        {
+            p_kinds[count++] = LOG_BIN_ARG_UINT;
+        }
+        if ((spec.conversion != '\0') && (strchr("cuxXp", spec.conversion) != NULL))
+        {
+            kind = LOG_BIN_ARG_UINT;
+        }
+        else if ((spec.conversion != '\0') && (strchr("di", spec.conversion) != NULL))
+        {
+            kind = LOG_BIN_ARG_INT;
+        }
+        else if (spec.conversion == 's')
+        {
+            kind = LOG_BIN_ARG_STR;
+        }
+        else
+        {
+            continue;
+        }
+        if (count < nargs)
+        {
+            p_kinds[count++] = kind;
+        }
+    }
+    while (count < nargs)
+    {
+        p_kinds[count++] = LOG_BIN_ARG_UINT;
+    }
+}
+
+
+/**@brief Function for printing a standard entry with the decoded arguments.
+ *
+ * Every conversion which nrf_fprintf supports is printed with the C library, except for strings,
+ * which nrf_fprintf pads with spaces also when the '0' flag is given.
+ */
+static void log_bin_format_render(log_bin_out_t  * p_out,
+                                  char const     * p_fmt,
+                                  log_bin_arg_t const * p_args,
+                                  uint32_t         nargs)
+{
+    uint32_t arg = 0;
+
+    while (*p_fmt != '\0')
+    {
+        log_bin_spec_t spec;
+        char           conv[32];
+        char const   * p_str;
+        int64_t        value;
+        uint32_t       width;
+        uint32_t       len;
+
+        if (*p_fmt != '%')
+        {
+            log_bin_out_add(p_out, p_fmt++, 1);
+            continue;
+        }
+        p_fmt = log_bin_spec_get(p_fmt + 1, &spec);
+        if (spec.width_arg)
+        {
+            (void)snprintf(spec.width, sizeof(spec.width), "%u",
+                           (unsigned)((arg < nargs) ? p_args[arg++].value : 0));
+        }
+        (void)snprintf(conv, sizeof(conv), "%%%s%s%s%s", spec.flags, spec.width,
+                       (spec.precision[0] != '\0') ? "." : "", spec.precision);
+        p_str = "";
+        value = 0;
+        if ((spec.conversion != '%') && (spec.conversion != '\0') &&
+            (strchr("diuxXcps", spec.conversion) != NULL) && (arg < nargs))
+        {
+            p_str = p_args[arg].p_str;
+            value = p_args[arg].value;
+            arg++;
+        }
+
+        switch (spec.conversion)
+        {
+            case '%':
+                log_bin_out_add(p_out, "%", 1);
+                break;
+            case 'd':
+            case 'i':
+                strcat(conv, "lld");
+                log_bin_out_printf(p_out, conv, (long long)value);
+                break;
+            case 'u':
+                strcat(conv, "u");
+                log_bin_out_printf(p_out, conv, (unsigned)(value & 0xFFFFFFFF));
+                break;
+            case 'x':
+            case 'X':
+                /* nrf_fprintf always prints upper case hexadecimal digits. */
+                strcat(conv, "X");
+                log_bin_out_printf(p_out, conv, (unsigned)(value & 0xFFFFFFFF));
+                break;
+            case 'c':
+            {
+                char c = (char)(value & 0xFF);
+
+                log_bin_out_add(p_out, &c, 1);
+                break;
+            }
+            case 'p':
+                log_bin_out_printf(p_out, "0x%08X", (unsigned)(value & 0xFFFFFFFF));
+                break;
+            case 's':
+                width = (uint32_t)atoi(spec.width);
+                len   = strlen(p_str);
+                if (strchr(spec.flags, '-') != NULL)
+                {
+                    log_bin_out_add(p_out, p_str, len);
+                }
+                for (; width > len; width--)
+                {
+                    log_bin_out_add(p_out, " ", 1);
+                }
+                if (strchr(spec.flags, '-') == NULL)
+                {
+                    log_bin_out_add(p_out, p_str, len);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+
+/**@brief Function for decoding a binary log frame to text, a port of frame_decode() of
+ *        tools/nrf_log_bin_decode.py.
+ *
+ * Format strings are read through their addresses and module names are taken from the logger,
+ * instead of from the ELF file.
+ *
+ * @param[in]  p_frame  Frame without SLIP encoding.
+ * @param[in]  len      Length of the frame.
+ * @param[in]  freq     Timestamp frequency, 0 if timestamps are not printed as time.
+ * @param[in]  raw      True if timestamps are printed as raw ticks.
+ * @param[out] p_out    Decoded text.
+ *
+ * @retval true  The frame was decoded.
+ * @retval false The frame is corrupted.
+ */
+static bool log_bin_frame_decode(uint8_t const * p_frame,
+                                 uint32_t        len,
+                                 uint32_t        freq,
+                                 bool            raw,
+                                 log_bin_out_t * p_out)
+{
+    log_bin_reader_t reader = {.p_data = p_frame, .len = len};
+    char             prefix[128] = "";
+    uint8_t          first       = log_bin_byte_get(&reader);
+    uint32_t         severity    = (first >> 1) & 0x7;
+    uint32_t         nargs       = (first >> 4) & 0x7;
+    uint32_t         module_id   = log_bin_varint_get(&reader);
+    uint32_t         timestamp   = log_bin_varint_get(&reader);
+
+    p_out->len = 0;
+    if (first & 0x80)
+    {
+        log_bin_out_printf(p_out, "Logs dropped (%u)\n", (unsigned)log_bin_varint_get(&reader));
+    }
+
+    if (severity != NRF_LOG_SEVERITY_INFO_RAW)
+    {
+        static char const * const severity_names[] = {NULL, "error", "warning", "info", "debug"};
+        char     time[32]   = "";
+        char     module[32];
+        uint32_t div        = 1;
+
+        /* The frequency is reduced the same way as by the formatter. */
+        while (freq > 1000000)
+        {
+            freq /= 2;
+            div  *= 2;
+        }
+        if (freq != 0)
+        {
+            uint32_t ticks   = timestamp / div;
+            uint32_t seconds = ticks / freq;
+            uint32_t us      = (uint32_t)(((uint64_t)(ticks % freq) * 1000000) / freq);
+
+            (void)snprintf(time, sizeof(time), "[%02u:%02u:%02u.%03u,%03u] ",
+                           (unsigned)(seconds / 3600), (unsigned)((seconds / 60) % 60),
+                           (unsigned)(seconds % 60), (unsigned)(us / 1000), (unsigned)(us % 1000));
+        }
+        else if (raw)
+        {
+            (void)snprintf(time, sizeof(time), "[%08u] ", (unsigned)timestamp);
+        }
+        if (module_id < nrf_log_module_cnt_get())
+        {
+            (void)snprintf(module, sizeof(module), "%s", nrf_log_module_name_get(module_id, false));
+        }
+        else
+        {
+            (void)snprintf(module, sizeof(module), "<module %u>", (unsigned)module_id);
+        }
+        (void)snprintf(prefix, sizeof(prefix), "%s<%s> %s: ", time,
+                       ((severity > 0) && (severity < ARRAY_SIZE(severity_names))) ?
+                       severity_names[severity] : "?", module);
+    }
+
+    if ((first & 0x01) == LOG_BIN_TYPE_STD)
+    {
+        char const  * p_fmt = (char const *)(uintptr_t)log_bin_varint_get(&reader);
+        uint8_t       kinds[LOG_ARGS_MAX];
+        log_bin_arg_t args[LOG_ARGS_MAX];
+
+        if (reader.error || (nargs > LOG_ARGS_MAX))
+        {
+            return false;
+        }
+        log_bin_kinds_get(p_fmt, kinds, nargs);
+        for (uint32_t i = 0; i < nargs; i++)
+        {
+            args[i].p_str = "";
+            if (kinds[i] == LOG_BIN_ARG_STR)
+            {
+                args[i].p_str = log_bin_string_get(&reader);
+                args[i].value = 0;
+            }
+            else if (kinds[i] == LOG_BIN_ARG_INT)
+            {
+                uint32_t value = log_bin_varint_get(&reader);
+
+                args[i].value = (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+            }
+            else
+            {
+                args[i].value = log_bin_varint_get(&reader);
+            }
+        }
+        log_bin_out_add(p_out, prefix, strlen(prefix));
+        log_bin_format_render(p_out, p_fmt, args, nargs);
+        if (severity != NRF_LOG_SEVERITY_INFO_RAW)
+        {
+            log_bin_out_add(p_out, "\n", 1);
+        }
+    }
+    else
+    {
+        uint32_t        data_len = log_bin_varint_get(&reader);
+        uint8_t const * p_data   = &p_frame[reader.idx];
+
+        if (reader.error || (data_len > len - reader.idx))
+        {
+            return false;
+        }
+        reader.idx += data_len;
+        for (uint32_t i = 0; i < MAX(data_len, 1); i += LOG_BIN_HEXDUMP_LINE)
+        {
+            log_bin_out_add(p_out, prefix, strlen(prefix));
+            for (uint32_t j = i; j < i + LOG_BIN_HEXDUMP_LINE; j++)
+            {
+                if (j < data_len)
+                {
+                    log_bin_out_printf(p_out, " %02X", p_data[j]);
+                }
+                else
+                {
+                    log_bin_out_add(p_out, "   ", 3);
+                }
+            }
+            log_bin_out_add(p_out, "|", 1);
+            for (uint32_t j = i; j < i + LOG_BIN_HEXDUMP_LINE; j++)
+            {
+                char c = (j >= data_len) ? ' ' :
+                         ((p_data[j] >= 0x20) && (p_data[j] < 0x7F)) ? (char)p_data[j] : '.';
+
+                log_bin_out_add(p_out, &c, 1);
+            }
+            log_bin_out_add(p_out, "\n", 1);
+        }
+    }
+
+    return !reader.error && (reader.idx == len);
+}
+
+
+/**@brief Function for splitting the binary output of an entry into frames, a port of
+ *        frames_get() of tools/nrf_log_bin_decode.py.
+ *
+ * @param[in]  p_stream Binary output.
+ * @param[in]  len      Length of the output.
+ * @param[out] p_frame  Last frame, without SLIP encoding.
+ * @param[out] p_len    Length of the last frame.
+ *
+ * @return Number of frames.
+ */
+static uint32_t log_bin_frames_get(uint8_t const * p_stream,
+                                   uint32_t        len,
+                                   uint8_t       * p_frame,
+                                   uint32_t      * p_len)
+{
+    uint32_t frames  = 0;
+    uint32_t idx     = 0;
+    bool     escaped = false;
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        uint8_t byte = p_stream[i];
+
+        if (byte == LOG_BIN_FRAME_END)
+        {
+            if (idx != 0)
+            {
+                frames++;
+                *p_len = idx;
+            }
+            idx     = 0;
+            escaped = false;
+        }
+        else if (escaped)
+        {
+            p_frame[idx++] = (byte == LOG_BIN_FRAME_ESC_END) ? LOG_BIN_FRAME_END : LOG_BIN_FRAME_ESC;
+            escaped        = false;
+        }
+        else if (byte == LOG_BIN_FRAME_ESC)
+        {
+            escaped = true;
+        }
+        else
+        {
+            p_frame[idx++] = byte;
+        }
+    }
+    /* Bytes after the last frame end are not a frame. */
+    BENCH_CHECK(idx == 0);
+    return frames;
+}
+
+
+/**@brief Function for building a random log entry for the serial backend check.
+ *
+ * @return Log entry, with a reference held by the caller.
+ */
+static nrf_memobj_t * log_serial_entry_get(void)
+{
+    nrf_log_header_t header = {0};
+    uint32_t         words[LOG_ARGS_MAX];
+    uint8_t          data[LOG_SERIAL_HEXDUMP_MAX];
+    uint32_t         len;
+    nrf_memobj_t   * p_entry;
+
+    header.module_id = rand_get() % nrf_log_module_cnt_get();
+    header.timestamp = (rand_get() << 8) ^ rand_get();
+    header.dropped   = ((rand_get() % 8) == 0) ? (uint16_t)(1 + rand_get()) : 0;
+
+    if ((rand_get() % 4) == 0)
+    {
+        len = rand_get() % (LOG_SERIAL_HEXDUMP_MAX + 1);
+        for (uint32_t i = 0; i < len; i++)
+        {
+            /* Framing bytes and printable characters are more frequent than others. */
+            uint32_t r = rand_get();
+
+            data[i] = ((r & 3) == 0) ? ((r & 4) ? LOG_BIN_FRAME_END : LOG_BIN_FRAME_ESC) :
+                      ((r & 3) == 1) ? (uint8_t)(r >> 8) : (uint8_t)(0x20 + ((r >> 8) % 0x5F));
+        }
+        header.base.hexdump.type     = HEADER_TYPE_HEXDUMP;
+        header.base.hexdump.severity = 1 + (rand_get() % NRF_LOG_SEVERITY_INFO_RAW);
+        header.base.hexdump.len      = len;
+    }
+    else
+    {
+        log_serial_fmt_t const * p_fmt = &m_log_serial_fmts[rand_get() % ARRAY_SIZE(m_log_serial_fmts)];
+        uint32_t                 nargs = strlen(p_fmt->p_args);
+
+        for (uint32_t i = 0; i < nargs; i++)
+        {
+            uint32_t r = rand_get();
+
+            switch (p_fmt->p_args[i])
+            {
+                case 'i':
+                    words[i] = (r & 1) ? ((r >> 1) % 200) - 100 : (r << 8) ^ rand_get();
+                    break;
+                case 'c':
+                    words[i] = (r & 1) ? LOG_BIN_FRAME_END : 0x20 + ((r >> 1) % 0x5F);
+                    break;
+                case 's':
+                    words[i] = (uint32_t)(uintptr_t)m_log_serial_strs[r % ARRAY_SIZE(m_log_serial_strs)];
+                    break;
+                case 'w':
+                    words[i] = r % 12;
+                    break;
+                default:
+                    words[i] = (r & 1) ? (r >> 1) % 1000 : (r << 8) ^ rand_get();
+                    break;
+            }
+        }
+        header.base.std.type     = HEADER_TYPE_STD;
+        header.base.std.severity = 1 + (rand_get() % NRF_LOG_SEVERITY_INFO_RAW);
+        header.base.std.nargs    = nargs;
+        header.base.std.addr     = (uint32_t)(uintptr_t)p_fmt->p_fmt;
+        BENCH_CHECK(header.base.std.addr == (uintptr_t)p_fmt->p_fmt);
+        len = nargs * sizeof(uint32_t);
+        memcpy(data, words, len);
+    }
+
+    p_entry = nrf_memobj_alloc(&m_log_serial_pool, (HEADER_SIZE * sizeof(uint32_t)) + len);
+    BENCH_CHECK(p_entry != NULL);
+    nrf_memobj_get(p_entry);
+    nrf_memobj_write(p_entry, &header, HEADER_SIZE * sizeof(uint32_t), 0);
+    nrf_memobj_write(p_entry, data, len, HEADER_SIZE * sizeof(uint32_t));
+    return p_entry;
+}
+
+
+/**@brief Function for checking the binary output of the serial backend against its text output.
+ *
+ * Every entry is passed to the serial backend built with text output and to the one built with
+ * binary output. The binary frame is decoded like on the host, and the text must be the same as
+ * the text output, where lines end with "\r\n" instead of "\n".
+ *
+ * @param[in] freq  Timestamp frequency set in the formatter.
+ */
+static void log_serial_run(uint32_t freq)
+{
+    static log_bin_out_t decoded;
+    static char          text[LOG_SERIAL_OUT_MAX];
+    uint8_t              frame[LOG_SERIAL_OUT_MAX];
+    uint8_t              buffer[LOG_SERIAL_BUF_SIZE];
+    uint64_t             text_bytes = 0;
+    uint64_t             bin_bytes  = 0;
+
+    nrf_log_str_formatter_timestamp_freq_set(freq);
+    for (uint32_t i = 0; i < LOG_SERIAL_ENTRIES; i++)
+    {
+        nrf_memobj_t * p_entry = log_serial_entry_get();
+        uint32_t       frame_len = 0;
+        uint32_t       text_len = 0;
+
+        m_log_serial_text_len = 0;
+        m_log_serial_bin_len  = 0;
+        nrf_log_backend_serial_put(NULL, p_entry, buffer, sizeof(buffer), log_serial_text_write);
+        nrf_log_backend_serial_bin_put(NULL, p_entry, buffer, sizeof(buffer), log_serial_bin_write);
+        nrf_memobj_put(p_entry);
+
+        BENCH_CHECK(log_bin_frames_get(m_log_serial_bin, m_log_serial_bin_len,
+                                       frame, &frame_len) == 1);
+        BENCH_CHECK(log_bin_frame_decode(frame, frame_len,
+                                         (NRF_LOG_USES_TIMESTAMP &&
+                                          NRF_LOG_STR_FORMATTER_TIMESTAMP_FORMAT_ENABLED) ? freq : 0,
+                                         NRF_LOG_USES_TIMESTAMP &&
+                                         !NRF_LOG_STR_FORMATTER_TIMESTAMP_FORMAT_ENABLED,
+                                         &decoded));
+
+        for (uint32_t j = 0; j < m_log_serial_text_len; j++)
+        {
+            if ((m_log_serial_text[j] != '\r') || (j + 1 == m_log_serial_text_len) ||
+                (m_log_serial_text[j + 1] != '\n'))
+            {
+                text[text_len++] = m_log_serial_text[j];
+            }
+        }
+        BENCH_CHECK((decoded.len == text_len) && (memcmp(decoded.text, text, text_len) == 0));
+
+        text_bytes += m_log_serial_text_len;
+        bin_bytes  += m_log_serial_bin_len;
+    }
+    BENCH_CHECK(nrf_balloc_utilization_get(m_log_serial_pool.p_chunk_pool) == 0);
+
+    printf("%-32s %10.1f %% (%u Hz)\n", "nrf_log binary/text size",
+           (100.0 * bin_bytes) / text_bytes, (unsigned)freq);
+}
+
+
+/**@brief Function for checking the binary output of the serial backend with timestamp frequencies
+ *        below and above 1 MHz.
+ */
+static void log_serial_check(void)
+{
+    APP_ERROR_CHECK(nrf_memobj_pool_init(&m_log_serial_pool));
+
+    /* The formatter halves frequencies higher than 1 MHz. */
+    log_serial_run(32768);
+    log_serial_run(16000000);
+    nrf_log_str_formatter_timestamp_freq_set(NRF_LOG_TIMESTAMP_DEFAULT_FREQUENCY);
+}
+
+
+#if NRF_LOG_BACKEND_FLASH_ENABLED
+NRF_LOG_BACKEND_FLASHLOG_DEF(m_log_flashlog);
+NRF_LOG_BACKEND_CRASHLOG_DEF(m_log_crashlog);
+NRF_MEMOBJ_POOL_DEF(m_log_flash_pool, LOG_FLASH_CHUNK_SIZE, LOG_FLASH_CHUNKS);
+
+static uint32_t m_log_flash_id;                         /**< Identifier of the last entry written. */
+static uint32_t m_log_flash_ids[LOG_FLASH_READ_MAX];    /**< Identifiers of the entries read back. */
+static uint32_t m_log_flash_tokens[LOG_FLASH_READ_MAX]; /**< Tokens returned after each entry read back. */
+
+
+/**@brief Function for getting the timestamp of the flash log entry with a given identifier.
+ *
+ * Timestamps grow by uneven steps, so they are not stored as the same delta.
+ */
+static uint32_t log_flash_timestamp_get(uint32_t id)
+{
+    return NRF_LOG_USES_TIMESTAMP ? ((id * 4) + (id % 3)) : 0;
+}
+
+
+/**@brief Function for building the flash log entry with a given identifier.
+ *
+ * The first argument, or the first bytes of a hexdump, hold the identifier. Some arguments
+ * change by small steps between entries and others are random.
+ *
+ * @param[in]  id       Entry identifier.
+ * @param[out] p_header Entry header.
+ * @param[out] p_data   Arguments or hexdump data.
+ *
+ * @return Length of the arguments or hexdump data in bytes.
+ */
+static uint32_t log_flash_entry_get(uint32_t id, nrf_log_header_t * p_header, uint8_t * p_data)
+{
+    memset(p_header, 0, sizeof(nrf_log_header_t));
+    p_header->module_id = id % 4;
+    p_header->timestamp = log_flash_timestamp_get(id);
+
+    if ((id % 5) == 0)
+    {
+        uint32_t len = sizeof(id) + (id % (LOG_FLASH_HEXDUMP_MAX - sizeof(id) + 1));
+
+        p_header->base.hexdump.type     = HEADER_TYPE_HEXDUMP;
+        p_header->base.hexdump.severity = NRF_LOG_SEVERITY_INFO;
+        p_header->base.hexdump.len      = len;
+        memcpy(p_data, &id, sizeof(id));
+        for (uint32_t i = sizeof(id); i < len; i++)
+        {
+            p_data[i] = (uint8_t)log_word_get(id, i);
+        }
+        return len;
+    }
+    else
+    {
+        uint32_t args[LOG_ARGS_MAX] = {id};
+        uint32_t nargs              = 1 + (id % LOG_ARGS_MAX);
+
+        p_header->base.std.type     = HEADER_TYPE_STD;
+        p_header->base.std.severity = NRF_LOG_SEVERITY_INFO;
+        p_header->base.std.nargs    = nargs;
+        p_header->base.std.addr     = log_str_addr_get(m_log_std_str[nargs - 1]);
+        for (uint32_t i = 1; i < nargs; i++)
+        {
+            args[i] = (i & 1) ? (id * i) : log_word_get(id, i);
+        }
+        memcpy(p_data, args, nargs * sizeof(uint32_t));
+        return nargs * sizeof(uint32_t);
+    }
+}
+
+
+/**@brief Function for passing the entry with a given identifier to the flashlog and crashlog
+ *        backends, like the logger frontend does.
+ */
+static void log_flash_put(uint32_t id)
+{
+    nrf_log_header_t header;
+    uint8_t          data[LOG_ARGS_MAX * sizeof(uint32_t)];
+    uint32_t         len     = log_flash_entry_get(id, &header, data);
+    nrf_memobj_t   * p_entry = nrf_memobj_alloc(&m_log_flash_pool, (HEADER_SIZE * sizeof(uint32_t)) + len);
+
+    BENCH_CHECK(p_entry != NULL);
+    nrf_memobj_get(p_entry);
+    nrf_memobj_write(p_entry, &header, HEADER_SIZE * sizeof(uint32_t), 0);
+    nrf_memobj_write(p_entry, data, len, HEADER_SIZE * sizeof(uint32_t));
+    nrf_log_backend_put(&m_log_flashlog.backend, p_entry);
+    nrf_log_backend_put(&m_log_crashlog.backend, p_entry);
+    nrf_memobj_put(p_entry);
+}
+
+
+/**@brief Function for writing entries to the flash log.
+ *
+ * Flash operations complete only after each burst of entries, so the entries of a burst are
+ * queued while an operation is in progress.
+ *
+ * @param[in] count Number of entries.
+ * @param[in] burst Number of entries in a burst, at most the size of the queue.
+ */
+static void log_flash_write(uint32_t count, uint32_t burst)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        log_flash_put(++m_log_flash_id);
+        if (((i + 1) % burst == 0) || (i + 1 == count))
+        {
+            while (nrf_fstorage_ram_process())
+            {
+            }
+        }
+    }
+}
+
+
+/**@brief Function for checking an entry read back from the flash log.
+ *
+ * @return Identifier of the entry, or LOG_FLASH_MARKER for the marker which starts a crash log.
+ */
+static uint32_t log_flash_entry_check(nrf_log_header_t const * p_header, uint8_t const * p_data)
+{
+    nrf_log_header_t header;
+    uint8_t          data[LOG_ARGS_MAX * sizeof(uint32_t)];
+    uint32_t         len;
+    uint32_t         id;
+
+    if ((p_header->base.generic.type == HEADER_TYPE_STD) && (p_header->base.std.nargs == 0))
+    {
+        return LOG_FLASH_MARKER;
+    }
+
+    memcpy(&id, p_data, sizeof(id));
+    BENCH_CHECK((id != LOG_FLASH_MARKER) && (id <= m_log_flash_id));
+    len = log_flash_entry_get(id, &header, data);
+    BENCH_CHECK(p_header->base.raw == header.base.raw);
+    BENCH_CHECK(p_header->module_id == header.module_id);
+    BENCH_CHECK(p_header->timestamp == header.timestamp);
+    BENCH_CHECK(memcmp(p_data, data, len) == 0);
+
+    return id;
+}
+
+
+/**@brief Function for reading back the whole flash log.
+ *
+ * Every entry is checked. Then reading is restarted from the tokens of random entries, which
+ * makes the backend rebuild its decoder state, and must return the same entries again.
+ *
+ * @return Number of entries read.
+ */
+static uint32_t log_flash_read(void)
+{
+    nrf_log_header_t * p_header;
+    uint8_t          * p_data;
+    uint32_t           token = 0;
+    uint32_t           count = 0;
+    ret_code_t         err_code;
+
+    while ((err_code = nrf_log_backend_flash_next_entry_get(&token, &p_header, &p_data)) == NRF_SUCCESS)
+    {
+        BENCH_CHECK(count < LOG_FLASH_READ_MAX);
+        m_log_flash_ids[count]    = log_flash_entry_check(p_header, p_data);
+        m_log_flash_tokens[count] = token;
+        count++;
+    }
+    BENCH_CHECK(err_code == NRF_ERROR_NOT_FOUND);
+
+    for (uint32_t i = 0; (i < LOG_FLASH_RESYNCS) && (count > 1); i++)
+    {
+        uint32_t j = rand_get() % (count - 1);
+
+        token = m_log_flash_tokens[j];
+        BENCH_CHECK(nrf_log_backend_flash_next_entry_get(&token, &p_header, &p_data) == NRF_SUCCESS);
+        BENCH_CHECK(log_flash_entry_check(p_header, p_data) == m_log_flash_ids[j + 1]);
+        BENCH_CHECK(token == m_log_flash_tokens[j + 1]);
+    }
+
+    return count;
+}
+
+
+/**@brief Function for checking that the flash log holds consecutive entries, up to the last one
+ *        written.
+ */
+static void log_flash_consecutive_check(uint32_t count)
+{
+    BENCH_CHECK((count > 0) && (m_log_flash_ids[count - 1] == m_log_flash_id));
+    for (uint32_t i = 1; i < count; i++)
+    {
+        BENCH_CHECK(m_log_flash_ids[i] == m_log_flash_ids[i - 1] + 1);
+    }
+}
+
+
+/**@brief Function for checking that a reader which stays at an entry while the ring wraps over
+ *        its segment recovers.
+ *
+ * The reader is left at a random entry, and the whole log is written again, so the segment of
+ * the entry is erased and reused. Reading from the token then must give the same result as for
+ * a reader which did not read before: the entry which follows the token if the token is at the
+ * end of an entry of the new segment, or an error otherwise.
+ *
+ * @param[in] count Number of entries in the flash log.
+ */
+static void log_flash_stale_token_check(uint32_t count)
+{
+    nrf_log_header_t * p_header;
+    uint8_t          * p_data;
+    uint32_t           j     = rand_get() % (count - 1);
+    uint32_t           token = m_log_flash_tokens[j];
+    uint32_t           stale;
+    uint32_t           id;
+    ret_code_t         err_code;
+
+    APP_ERROR_CHECK(nrf_log_backend_flash_next_entry_get(&token, &p_header, &p_data));
+    id = log_flash_entry_check(p_header, p_data);
+    BENCH_CHECK(id == m_log_flash_ids[j + 1]);
+
+    stale = token;
+    log_flash_write(count, NRF_LOG_BACKEND_FLASHLOG_QUEUE_SIZE);
+
+    err_code = nrf_log_backend_flash_next_entry_get(&token, &p_header, &p_data);
+    if (err_code == NRF_SUCCESS)
+    {
+        id = log_flash_entry_check(p_header, p_data);
+    }
+
+    count = log_flash_read();
+    log_flash_consecutive_check(count);
+    for (j = 0; (j < count) && (m_log_flash_tokens[j] != stale); j++)
+    {
+    }
+    if (j + 1 < count)
+    {
+        BENCH_CHECK((err_code == NRF_SUCCESS) && (id == m_log_flash_ids[j + 1]));
+    }
+    else
+    {
+        BENCH_CHECK((err_code == NRF_ERROR_INVALID_PARAM) || (err_code == NRF_ERROR_NOT_FOUND));
+    }
+}
+
+
+/**@brief Function for checking that the ring of segments wraps, keeping the newest entries, and
+ *        that readers which hold tokens of erased segments recover.
+ */
+static void log_flash_wrap_check(void)
+{
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < LOG_FLASH_ROUNDS; i++)
+    {
+        log_flash_write(LOG_FLASH_ENTRIES / LOG_FLASH_ROUNDS, NRF_LOG_BACKEND_FLASHLOG_QUEUE_SIZE);
+        count = log_flash_read();
+        log_flash_consecutive_check(count);
+    }
+
+    /* The oldest entries were overwritten. */
+    BENCH_CHECK(m_log_flash_ids[0] > 1);
+
+    printf("%-32s %10.1f\n", "flash log entries per page", (double)count / NRF_LOG_BACKEND_PAGES);
+
+    for (uint32_t i = 0; i < LOG_FLASH_STALE_READERS; i++)
+    {
+        log_flash_stale_token_check(count);
+        count = log_flash_read();
+    }
+}
+
+
+/**@brief Function for checking that seeking returns the first entry which is not older than
+ *        the timestamp, comparing it with a linear scan.
+ */
+static void log_flash_seek_check(void)
+{
+    benchmark_t bench;
+    uint32_t    count = log_flash_read();
+    uint32_t    last  = log_flash_timestamp_get(m_log_flash_ids[count - 1]);
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < LOG_FLASH_SEEKS; i++)
+    {
+        nrf_log_header_t * p_header;
+        uint8_t          * p_data;
+        uint32_t           token;
+        uint32_t           timestamp = rand_get() % (last + 2);
+        uint32_t           j         = 0;
+        ret_code_t         err_code;
+
+        APP_ERROR_CHECK(nrf_log_backend_flash_seek(&token, timestamp));
+        err_code = nrf_log_backend_flash_next_entry_get(&token, &p_header, &p_data);
+
+        while ((j < count) && (log_flash_timestamp_get(m_log_flash_ids[j]) < timestamp))
+        {
+            j++;
+        }
+        if (j < count)
+        {
+            BENCH_CHECK(err_code == NRF_SUCCESS);
+            BENCH_CHECK(log_flash_entry_check(p_header, p_data) == m_log_flash_ids[j]);
+        }
+        else
+        {
+            BENCH_CHECK(err_code == NRF_ERROR_NOT_FOUND);
+        }
+    }
+    bench.ops = LOG_FLASH_SEEKS;
+    benchmark_end(&bench, "nrf_log_backend_flash_seek");
+}
+
+
+/**@brief Function for reading back the flash log after a flash operation was interrupted.
+ *
+ * Entries which were found before must be kept, unless the ring overwrote them. Entries
+ * written after the given one must all be found.
+ *
+ * @param[in] written Identifier of the last entry which might have been lost.
+ */
+static void log_flash_cut_verify(uint32_t written)
+{
+    static uint32_t prev_ids[LOG_FLASH_READ_MAX];
+    static uint32_t prev_count;
+    uint32_t        count = log_flash_read();
+    uint32_t        j;
+
+    for (j = 1; j < count; j++)
+    {
+        BENCH_CHECK(m_log_flash_ids[j] > m_log_flash_ids[j - 1]);
+    }
+
+    j = 0;
+    for (uint32_t k = 0; k < prev_count; k++)
+    {
+        while ((j < count) && (m_log_flash_ids[j] < prev_ids[k]))
+        {
+            j++;
+        }
+        BENCH_CHECK((prev_ids[k] < m_log_flash_ids[0]) ||
+                    ((j < count) && (m_log_flash_ids[j] == prev_ids[k])));
+    }
+
+    BENCH_CHECK(count > m_log_flash_id - written);
+    for (j = count - (m_log_flash_id - written); j < count; j++)
+    {
+        BENCH_CHECK(m_log_flash_ids[j] == m_log_flash_id - (count - 1 - j));
+    }
+
+    memcpy(prev_ids, m_log_flash_ids, count * sizeof(uint32_t));
+    prev_count = count;
+}
+
+
+/**@brief Function for checking that a flash operation which fails, or which is cut short by a
+ *        reset, loses no entry which was written before, and leaves no damaged entry.
+ *
+ * A failed operation is repeated, so no entry is lost. After a reset, the entries which were
+ * queued or in the record being written may be lost. In both cases, the entries written
+ * afterwards must all be found.
+ *
+ * First, a random flash operation of a burst of entries is interrupted after a random number of
+ * bytes. Then operations on segments are interrupted: after a reset which tore a record, the
+ * backend closes the segment, and erases and opens the next one.
+ */
+static void log_flash_cut_check(void)
+{
+    static uint32_t const lens[] = {0, 4, 8, 12, 2048};
+
+    log_flash_cut_verify(m_log_flash_id);
+
+    for (uint32_t i = 0; i < LOG_FLASH_CUTS; i++)
+    {
+        uint32_t steps   = rand_get() % 6;
+        uint32_t len     = lens[rand_get() % ARRAY_SIZE(lens)];
+        bool     reset   = (rand_get() & 1) != 0;
+        uint32_t written = m_log_flash_id;
+
+        /* One entry less than the queue holds, so that the entry written after the cut fits. */
+        for (uint32_t j = 0; j < NRF_LOG_BACKEND_FLASHLOG_QUEUE_SIZE - 1; j++)
+        {
+            log_flash_put(++m_log_flash_id);
+        }
+        for (uint32_t j = 0; (j < steps) && nrf_fstorage_ram_process(); j++)
+        {
+        }
+        if (nrf_fstorage_ram_interrupt(len, !reset) && reset)
+        {
+            APP_ERROR_CHECK(nrf_log_backend_flash_init(&nrf_fstorage_ram));
+            written = m_log_flash_id;
+        }
+        log_flash_write(NRF_LOG_BACKEND_FLASHLOG_QUEUE_SIZE, 1);
+        log_flash_cut_verify(written);
+    }
+
+    for (uint32_t op = 0; op < 3; op++)
+    {
+        for (uint32_t i = 0; i < 2 * ARRAY_SIZE(lens); i++)
+        {
+            bool     reset = (i & 1) != 0;
+            uint32_t written;
+
+            log_flash_put(++m_log_flash_id);
+            (void)nrf_fstorage_ram_interrupt(sizeof(uint32_t), false);
+            APP_ERROR_CHECK(nrf_log_backend_flash_init(&nrf_fstorage_ram));
+            written = m_log_flash_id;
+
+            log_flash_put(++m_log_flash_id);
+            for (uint32_t j = 0; (j < op) && nrf_fstorage_ram_process(); j++)
+            {
+            }
+            if (nrf_fstorage_ram_interrupt(lens[i / 2], !reset) && reset)
+            {
+                APP_ERROR_CHECK(nrf_log_backend_flash_init(&nrf_fstorage_ram));
+                written = m_log_flash_id;
+            }
+            log_flash_write(NRF_LOG_BACKEND_FLASHLOG_QUEUE_SIZE, 1);
+            log_flash_cut_verify(written);
+        }
+    }
+}
+
+
+/**@brief Function for checking that entries are written in panic mode, after the crash log
+ *        marker, and that the ring overwrites the crash log like other entries.
+ *
+ * The flash operation in progress is cut short by the crash, so the entries in the record being
+ * written are lost. The crashlog backend holds the most recent entries, which are written after
+ * the marker.
+ */
+static void log_flash_crash_check(void)
+{
+    uint32_t count;
+    uint32_t marker;
+    uint32_t crash_id;
+
+    for (uint32_t i = 0; i < NRF_LOG_BACKEND_FLASHLOG_QUEUE_SIZE; i++)
+    {
+        log_flash_put(++m_log_flash_id);
+    }
+    (void)nrf_fstorage_ram_interrupt(0, false);
+    nrf_fstorage_ram_defer(false);
+
+    nrf_log_backend_panic_set(&m_log_flashlog.backend);
+    nrf_log_backend_panic_set(&m_log_crashlog.backend);
+    log_flash_put(++m_log_flash_id);
+    crash_id = m_log_flash_id;
+
+    count = log_flash_read();
+    for (marker = 0; (marker < count) && (m_log_flash_ids[marker] != LOG_FLASH_MARKER); marker++)
+    {
+    }
+    BENCH_CHECK(marker + NRF_LOG_BACKEND_CRASHLOG_FIFO_SIZE + 2 == count);
+    for (uint32_t i = marker + 1; i < count; i++)
+    {
+        BENCH_CHECK(m_log_flash_ids[i] == crash_id + i + 1 - count);
+    }
+
+    /* The device resets after the crash, and goes on logging until the ring wraps. */
+    nrf_fstorage_ram_defer(true);
+    APP_ERROR_CHECK(nrf_log_backend_flash_init(&nrf_fstorage_ram));
+    log_flash_write(LOG_FLASH_ENTRIES, NRF_LOG_BACKEND_FLASHLOG_QUEUE_SIZE);
+    count = log_flash_read();
+    log_flash_consecutive_check(count);
+    BENCH_CHECK(m_log_flash_ids[0] > crash_id);
+}
+
+
+/**@brief Function for checking the flash log backend on flash emulated in RAM. */
+static void log_flash_check(void)
+{
+    APP_ERROR_CHECK(nrf_memobj_pool_init(&m_log_flash_pool));
+    APP_ERROR_CHECK(nrf_log_backend_flash_init(&nrf_fstorage_ram));
+    APP_ERROR_CHECK(nrf_log_backend_flash_erase());
+    BENCH_CHECK(log_flash_read() == 0);
+
+    nrf_fstorage_ram_defer(true);
+    log_flash_wrap_check();
+    log_flash_seek_check();
+    log_flash_cut_check();
+    log_flash_crash_check();
+    nrf_fstorage_ram_defer(false);
+}
+#endif // NRF_LOG_BACKEND_FLASH_ENABLED
+
+
+/**@brief Function for filling a random token which collides with other tokens often. */
+static void coap_token_get(uint8_t * p_token, uint8_t * p_token_len)
+{
+    uint32_t r = rand_get();
+
+    *p_token_len = r % (COAP_TOKEN_LEN_MAX + 1);
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        p_token[i] = (r >> (8 + i)) & 0x01;
+    }
+}
+
+
+/**@brief Function for adding an item to the CoAP queue and to the model. */
+static void coap_queue_model_add(uint32_t * p_count)
+{
+    coap_queue_item_t   item;
+    coap_queue_item_t * p_item = NULL;
+    uint32_t            err_code;
+
+    memset(&item, 0xAA, sizeof(item));
+    item.mid      = rand_get() % COAP_MID_RANGE;
+    item.timeout  = rand_get() % (COAP_TIMEOUT_MAX + 1);
+    item.p_buffer = m_data;
+    coap_token_get(item.token, &item.token_len);
+
+    err_code = coap_queue_add(&item);
+    if (*p_count == COAP_MESSAGE_QUEUE_SIZE)
+    {
+        BENCH_CHECK(err_code == (NRF_ERROR_NO_MEM | IOT_COAP_ERR_BASE));
+        return;
+    }
+    APP_ERROR_CHECK(err_code);
+    BENCH_CHECK(item.handle < COAP_MESSAGE_QUEUE_SIZE);
+
+    coap_queue_model_t * p_model = &m_coap_queue_model[item.handle];
+
+    BENCH_CHECK(!p_model->queued);
+    while (coap_queue_item_next_get(&p_item, p_item) == NRF_SUCCESS)
+    {
+        if (p_item->handle == item.handle)
+        {
+            break;
+        }
+    }
+    BENCH_CHECK((p_item != NULL) && (p_item->mid == item.mid));
+
+    p_model->p_item    = p_item;
+    p_model->ticks     = item.timeout;
+    p_model->mid       = item.mid;
+    p_model->token_len = item.token_len;
+    p_model->queued    = true;
+    memcpy(p_model->token, item.token, sizeof(item.token));
+    (*p_count)++;
+}
+
+
+/**@brief Function for removing an item from the CoAP queue and from the model. */
+static void coap_queue_model_remove(coap_queue_model_t * p_model, uint32_t * p_count)
+{
+    APP_ERROR_CHECK(coap_queue_remove(p_model->p_item));
+    p_model->queued = false;
+    (*p_count)--;
+}
+
+
+/**@brief Function for ticking the CoAP queue and handling the items which expire.
+ *
+ * Each expired item is either removed or given a new timeout, as the CoAP module does on
+ * a retransmission.
+ */
+static void coap_queue_model_tick(uint32_t * p_count)
+{
+    coap_queue_item_t * p_item;
+    bool                expired[COAP_MESSAGE_QUEUE_SIZE] = {false};
+
+    coap_queue_tick();
+    for (uint32_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
+    {
+        if (m_coap_queue_model[i].queued)
+        {
+            if (m_coap_queue_model[i].ticks == 0)
+            {
+                expired[i] = true;
+            }
+            else
+            {
+                m_coap_queue_model[i].ticks--;
+            }
+        }
+    }
+
+    while (coap_queue_item_expired_get(&p_item) == NRF_SUCCESS)
+    {
+        coap_queue_model_t * p_model = &m_coap_queue_model[p_item->handle];
+
+        BENCH_CHECK(expired[p_item->handle] && (p_model->p_item == p_item));
+        expired[p_item->handle] = false;
+
+        if ((rand_get() & 0x01) == 0)
+        {
+            p_model->ticks = rand_get() % (COAP_TIMEOUT_MAX + 1);
+            APP_ERROR_CHECK(coap_queue_item_timeout_set(p_item, (uint16_t)p_model->ticks));
+        }
+        else
+        {
+            coap_queue_model_remove(p_model, p_count);
+        }
+    }
+    BENCH_CHECK(p_item == NULL);
+
+    for (uint32_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
+    {
+        BENCH_CHECK(!expired[i]);
+    }
+}
+
+
+/**@brief Function for checking the CoAP transaction queue against a model.
+ *
+ * Random adds, removals, lookups and ticks are applied to the queue and to a model of it.
+ * Message IDs and tokens are drawn from small ranges, so that lookups find items and items
+ * share message IDs and tokens. The lookup time is measured with the queue full.
+ */
+static void coap_queue_check(void)
+{
+    benchmark_t bench;
+    uint32_t    count = 0;
+
+    APP_ERROR_CHECK(coap_queue_init());
+
+    for (uint32_t i = 0; i < COAP_QUEUE_OPS; i++)
+    {
+        uint32_t            op = rand_get() % 10;
+        coap_queue_item_t * p_item;
+
+        if (op < 4)
+        {
+            coap_queue_model_add(&count);
+        }
+        else if (op < 6)
+        {
+            coap_queue_model_t * p_model = &m_coap_queue_model[rand_get() % COAP_MESSAGE_QUEUE_SIZE];
+
+            if (p_model->queued)
+            {
+                coap_queue_model_remove(p_model, &count);
+            }
+            else if (p_model->p_item != NULL)
+            {
+                /* The slot is free, the item is no longer in the queue. */
+                BENCH_CHECK(coap_queue_remove(p_model->p_item) ==
+                            (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE));
+                BENCH_CHECK(coap_queue_item_timeout_set(p_model->p_item, 1) ==
+                            (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE));
+            }
+        }
+        else if (op < 7)
+        {
+            uint16_t mid   = rand_get() % COAP_MID_RANGE;
+            bool     found = false;
+
+            for (uint32_t j = 0; j < COAP_MESSAGE_QUEUE_SIZE; j++)
+            {
+                found |= m_coap_queue_model[j].queued && (m_coap_queue_model[j].mid == mid);
+            }
+            if (coap_queue_item_by_mid_get(&p_item, mid) == NRF_SUCCESS)
+            {
+                BENCH_CHECK(found && (p_item->mid == mid));
+                BENCH_CHECK(m_coap_queue_model[p_item->handle].queued);
+            }
+            else
+            {
+                BENCH_CHECK(!found);
+            }
+        }
+        else if (op < 8)
+        {
+            uint8_t token[8];
+            uint8_t token_len;
+            bool    found = false;
+
+            coap_token_get(token, &token_len);
+            for (uint32_t j = 0; j < COAP_MESSAGE_QUEUE_SIZE; j++)
+            {
+                coap_queue_model_t const * p_model = &m_coap_queue_model[j];
+
+                found |= p_model->queued && (token_len != 0) &&
+                         (p_model->token_len == token_len) &&
+                         (memcmp(p_model->token, token, token_len) == 0);
+            }
+            if (coap_queue_item_by_token_get(&p_item, token, token_len) == NRF_SUCCESS)
+            {
+                BENCH_CHECK(found && (p_item->token_len == token_len));
+                BENCH_CHECK(memcmp(p_item->token, token, token_len) == 0);
+                BENCH_CHECK(m_coap_queue_model[p_item->handle].queued);
+            }
+            else
+            {
+                BENCH_CHECK(!found);
+            }
+        }
+        else
+        {
+            coap_queue_model_tick(&count);
+        }
+    }
+
+    /* Fill the queue with unique message IDs and tokens, and time the lookups. */
+    APP_ERROR_CHECK(coap_queue_init());
+    for (uint32_t i = 0; i < COAP_MESSAGE_QUEUE_SIZE; i++)
+    {
+        coap_queue_item_t item = {0};
+
+        item.mid       = i * 3;
+        item.token_len = sizeof(i);
+        item.timeout   = i % 50;
+        item.p_buffer  = m_data;
+        memcpy(item.token, &i, sizeof(i));
+        APP_ERROR_CHECK(coap_queue_add(&item));
+    }
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS; i++)
+    {
+        coap_queue_item_t * p_item;
+        uint32_t            key = (i * 7) % COAP_MESSAGE_QUEUE_SIZE;
+
+        APP_ERROR_CHECK(coap_queue_item_by_mid_get(&p_item, key * 3));
+        BENCH_CHECK(p_item->mid == key * 3);
+        APP_ERROR_CHECK(coap_queue_item_by_token_get(&p_item, (uint8_t *)&key, sizeof(key)));
+        BENCH_CHECK(p_item->mid == key * 3);
+    }
+    bench.ops = ITEM_ROUNDS * 2;
+    benchmark_end(&bench, "coap_queue lookup (" STRINGIFY(COAP_MESSAGE_QUEUE_SIZE) " items)");
+}
+
+
+/**@brief Function for resolving a CoAP resource path.
+ *
+ * The path segments are packed without separators or terminators, as they are in a received
+ * message, so only the segment lengths tell where the names end.
+ *
+ * @param[in] p_path    Path with the segments separated by '/', or an empty string for the root.
+ *
+ * @return The resource, or NULL if the path was not resolved.
+ */
+static coap_resource_t * coap_path_resolve(char const * p_path)
+{
+    uint8_t           segments[(COAP_RESOURCE_MAX_NAME_LEN + 1) * COAP_RESOURCE_MAX_DEPTH];
+    uint8_t         * p_segments[COAP_RESOURCE_MAX_DEPTH];
+    uint16_t          lengths[COAP_RESOURCE_MAX_DEPTH];
+    uint8_t           count = 0;
+    uint32_t          pos   = 0;
+    coap_resource_t * p_resource;
+    uint32_t          err_code;
+
+    while (*p_path != '\0')
+    {
+        BENCH_CHECK(count < COAP_RESOURCE_MAX_DEPTH);
+        p_segments[count] = &segments[pos];
+        lengths[count]    = 0;
+        while ((*p_path != '\0') && (*p_path != '/'))
+        {
+            segments[pos++] = (uint8_t)*p_path++;
+            lengths[count]++;
+        }
+        if (*p_path == '/')
+        {
+            p_path++;
+        }
+        count++;
+    }
+
+    err_code = coap_resource_get(&p_resource, p_segments, lengths, count);
+    if (err_code != NRF_SUCCESS)
+    {
+        BENCH_CHECK(err_code == (NRF_ERROR_NOT_FOUND | IOT_COAP_ERR_BASE));
+        BENCH_CHECK(p_resource == NULL);
+    }
+    return p_resource;
+}
+
+
+/**@brief Function for generating the links of a resource subtree as the original CoAP resource
+ *        code did, as a reference.
+ *
+ * Each resource is linked after its children, and generation stops at the first link which
+ * does not fit.
+ */
+static uint32_t well_known_reference_path(coap_resource_t const * p_resource,
+                                          char                  * p_path,
+                                          uint16_t                path_len,
+                                          uint8_t               * p_string,
+                                          uint16_t              * p_pos,
+                                          uint16_t              * p_length)
+{
+    if (p_resource != &m_coap_resources[0])
+    {
+        p_path[path_len++] = '/';
+        memcpy(&p_path[path_len], p_resource->name, strlen(p_resource->name));
+        path_len += strlen(p_resource->name);
+    }
+
+    for (coap_resource_t const * p_child = p_resource->p_front;
+         p_child != NULL;
+         p_child = p_child->p_sibling)
+    {
+        uint32_t err_code = well_known_reference_path(p_child, p_path, path_len,
+                                                      p_string, p_pos, p_length);
+        if (err_code != NRF_SUCCESS)
+        {
+            return err_code;
+        }
+    }
+
+    if (p_resource != &m_coap_resources[0])
+    {
+        p_path[path_len++] = '>';
+        if ((p_resource->permission & COAP_PERM_OBSERVE) != 0)
+        {
+            memcpy(&p_path[path_len], ";obs", 4);
+            path_len += 4;
+        }
+        p_path[path_len++] = ',';
+
+        if (path_len > *p_length)
+        {
+            return (NRF_ERROR_DATA_SIZE | IOT_COAP_ERR_BASE);
+        }
+        *p_length -= path_len;
+        memcpy(&p_string[*p_pos], p_path, path_len);
+        *p_pos += path_len;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for generating .well-known/core as the original CoAP resource code did. */
+static uint32_t well_known_reference(uint8_t * p_string, uint16_t * p_length)
+{
+    char     path[(COAP_RESOURCE_MAX_NAME_LEN + 1) * COAP_RESOURCE_MAX_DEPTH + 6] = "<";
+    uint16_t pos = 0;
+    uint32_t err_code;
+
+    memset(p_string, 0, *p_length);
+    err_code = well_known_reference_path(&m_coap_resources[0], path, 1, p_string, &pos, p_length);
+    if (pos > 0)
+    {
+        p_string[pos - 1] = '\0';
+    }
+
+    return err_code;
+}
+
+
+/**@brief Function for checking .well-known/core against the reference for every buffer size. */
+static void well_known_check(void)
+{
+    static uint8_t string[COAP_WELL_KNOWN_SIZE];
+    static uint8_t expected[COAP_WELL_KNOWN_SIZE];
+
+    for (uint16_t size = 10; size <= COAP_WELL_KNOWN_SIZE; size++)
+    {
+        uint16_t length          = size;
+        uint16_t expected_length = size;
+
+        memset(string, 0x55, sizeof(string));
+        BENCH_CHECK(coap_resource_well_known_generate(string, &length) ==
+                    well_known_reference(expected, &expected_length));
+        BENCH_CHECK(length == expected_length);
+        BENCH_CHECK(memcmp(string, expected, size) == 0);
+    }
+}
+
+
+/**@brief Function for checking the CoAP resource path resolution and .well-known/core.
+ *
+ * Paths are resolved in a tree with names which are prefixes of each other. The generated
+ * .well-known/core is compared with the output of the original generator for every buffer
+ * size, also after the buffer was modified by the caller or the tree changed.
+ */
+static void coap_resource_check(void)
+{
+    benchmark_t bench;
+    uint8_t     string[COAP_WELL_KNOWN_SIZE];
+    uint16_t    length = sizeof(string);
+    uint16_t    remain;
+
+    APP_ERROR_CHECK(coap_resource_init());
+    for (uint32_t i = 0; i < COAP_RESOURCES; i++)
+    {
+        APP_ERROR_CHECK(coap_resource_create(&m_coap_resources[i], m_coap_resource_names[i]));
+    }
+    m_coap_resources[2].permission = COAP_PERM_OBSERVE;
+    m_coap_resources[5].permission = COAP_PERM_OBSERVE;
+
+    /* The last resource is added to the tree later. */
+    for (uint32_t i = 1; i < COAP_RESOURCES - 1; i++)
+    {
+        APP_ERROR_CHECK(coap_resource_child_add(&m_coap_resources[m_coap_resource_parents[i]],
+                                                &m_coap_resources[i]));
+    }
+
+    BENCH_CHECK(coap_path_resolve("") == &m_coap_resources[0]);
+    BENCH_CHECK(coap_path_resolve("light") == &m_coap_resources[2]);
+    BENCH_CHECK(coap_path_resolve("lights") == &m_coap_resources[1]);
+    BENCH_CHECK(coap_path_resolve("lightsx") == &m_coap_resources[7]);
+    BENCH_CHECK(coap_path_resolve("ligh") == NULL);
+    BENCH_CHECK(coap_path_resolve("light/led2/sub") == &m_coap_resources[6]);
+    BENCH_CHECK(coap_path_resolve("light/led3") == NULL);
+    BENCH_CHECK(coap_path_resolve("lights/led1") == NULL);
+    BENCH_CHECK(coap_path_resolve("light/led2/sub/x") == NULL);
+    BENCH_CHECK(coap_path_resolve("a") == NULL);
+
+    well_known_check();
+
+    /* The string is generated again into a buffer which the caller has modified. */
+    APP_ERROR_CHECK(coap_resource_well_known_generate(string, &length));
+    remain    = length;
+    string[0] = 'Z';
+    length    = sizeof(string);
+    APP_ERROR_CHECK(coap_resource_well_known_generate(string, &length));
+    BENCH_CHECK((string[0] == '<') && (length == remain));
+
+    /* Adding a resource changes the string. */
+    APP_ERROR_CHECK(coap_resource_child_add(&m_coap_resources[0],
+                                            &m_coap_resources[COAP_RESOURCES - 1]));
+    BENCH_CHECK(coap_path_resolve("a") == &m_coap_resources[COAP_RESOURCES - 1]);
+    length = sizeof(string);
+    APP_ERROR_CHECK(coap_resource_well_known_generate(string, &length));
+    BENCH_CHECK(string[0] == '<');
+    well_known_check();
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS; i++)
+    {
+        m_sink = (uint32_t)(uintptr_t)coap_path_resolve("light/led2/sub");
+    }
+    bench.ops = ITEM_ROUNDS;
+    benchmark_end(&bench, "coap_resource_get (3 levels)");
+}
+
+
+/* CoAP transport which keeps the datagrams sent, for checking them. */
+uint32_t coap_transport_init(const coap_transport_init_t * p_param)
+{
+    BENCH_CHECK(p_param->p_port_table[0].port_number == COAP_PORT);
+    return NRF_SUCCESS;
+}
+
+
+uint32_t coap_transport_write(const coap_port_t   * p_port,
+                              const coap_remote_t * p_remote,
+                              const uint8_t       * p_data,
+                              uint16_t              datalen)
+{
+    coap_datagram_t * p_sent = &m_coap_sent[m_coap_sent_count];
+
+    BENCH_CHECK(p_port->port_number == COAP_PORT);
+    BENCH_CHECK(m_coap_sent_count < ARRAY_SIZE(m_coap_sent));
+    BENCH_CHECK(datalen <= sizeof(p_sent->data));
+    if ((m_coap_fail_port != 0) && (p_remote->port_number == m_coap_fail_port))
+    {
+        return NRF_ERROR_BUSY;
+    }
+    memcpy(p_sent->data, p_data, datalen);
+    p_sent->len    = datalen;
+    p_sent->remote = *p_remote;
+    m_coap_sent_count++;
+    m_coap_writes++;
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief Function for sending a datagram encoded into the transport buffer.
+ *
+ * The buffer is filled with a pattern first, so that bytes not written by the encoder and
+ * writes past the given length are detected.
+ */
+uint32_t coap_transport_encode_write(const coap_port_t       * p_port,
+                                     const coap_remote_t     * p_remote,
+                                     uint16_t                  datalen,
+                                     coap_transport_encode_t   encode,
+                                     void                    * p_context)
+{
+    coap_datagram_t * p_sent = &m_coap_sent[m_coap_sent_count];
+    uint16_t          length = datalen;
+    uint32_t          err_code;
+
+    BENCH_CHECK(p_port->port_number == COAP_PORT);
+    BENCH_CHECK(m_coap_sent_count < ARRAY_SIZE(m_coap_sent));
+    BENCH_CHECK(datalen < sizeof(p_sent->data));
+    if ((m_coap_fail_port != 0) && (p_remote->port_number == m_coap_fail_port))
+    {
+        return NRF_ERROR_BUSY;
+    }
+    memset(p_sent->data, 0xAA, sizeof(p_sent->data));
+
+    err_code = encode(p_context, p_sent->data, &length);
+    if (err_code == NRF_SUCCESS)
+    {
+        BENCH_CHECK(length == datalen);
+        BENCH_CHECK(p_sent->data[datalen] == 0xAA);
+        p_sent->len    = length;
+        p_sent->remote = *p_remote;
+        m_coap_sent_count++;
+        m_coap_direct_writes++;
+    }
+
+    return err_code;
+}
+
+
+void coap_transport_process(void)
+{
+}
+
+
+static void coap_response_handler(uint32_t status, void * p_arg, coap_message_t * p_message)
+{
+    BENCH_CHECK(status == m_coap_status);
+    BENCH_CHECK(p_arg == &m_coap_responses);
+    m_coap_responses++;
+}
+
+
+/**@brief Function for passing an empty ACK to CoAP, as if it was received. */
+static void coap_ack_receive(uint16_t mid, coap_remote_t const * p_remote)
+{
+    uint8_t const ack[] =
+    {
+        (COAP_VERSION << 6) | (COAP_TYPE_ACK << 4), 0, (uint8_t)(mid >> 8), (uint8_t)mid
+    };
+
+    APP_ERROR_CHECK(coap_transport_read(&m_coap_port, p_remote, NULL, NRF_SUCCESS,
+                                        ack, sizeof(ack)));
+}
+
+
+/**@brief Function for creating a random CoAP message.
+ *
+ * The options cover short, one byte extended and two byte extended deltas and lengths, and
+ * repeated options.
+ */
+static coap_message_t * coap_message_random_new(void)
+{
+    coap_message_conf_t  conf = {0};
+    coap_message_t     * p_message;
+    coap_remote_t        remote;
+    uint16_t             option = 0;
+    uint32_t             options = rand_get() % (COAP_MAX_NUMBER_OF_OPTIONS + 1);
+    uint32_t             payload_len = rand_get() % (COAP_PAYLOAD_MAX + 1);
+
+    static coap_msg_code_t const codes[] =
+    {
+        COAP_CODE_GET, COAP_CODE_POST, COAP_CODE_205_CONTENT, COAP_CODE_404_NOT_FOUND
+    };
+
+    conf.type      = ((rand_get() & 0x01) == 0) ? COAP_TYPE_CON : COAP_TYPE_NON;
+    conf.code      = codes[rand_get() % ARRAY_SIZE(codes)];
+    conf.id        = 1 + (rand_get() % 0xFFFF);
+    conf.token_len = rand_get() % (sizeof(conf.token) + 1);
+    conf.port      = m_coap_port;
+    for (uint32_t i = 0; i < conf.token_len; i++)
+    {
+        conf.token[i] = (uint8_t)rand_get();
+    }
+    if ((rand_get() & 0x01) == 0)
+    {
+        conf.response_callback = coap_response_handler;
+    }
+    APP_ERROR_CHECK(coap_message_new(&p_message, &conf));
+    p_message->p_arg = &m_coap_responses;
+
+    memset(&remote, 0, sizeof(remote));
+    remote.addr[15]    = (uint8_t)rand_get();
+    remote.port_number = COAP_PORT;
+    APP_ERROR_CHECK(coap_message_remote_addr_set(p_message, &remote));
+
+    for (uint32_t i = 0; i < options; i++)
+    {
+        switch (rand_get() % 4)
+        {
+            case 0:
+                break;
+            case 1:
+                option += 1 + (rand_get() % 12);
+                break;
+            case 2:
+                option += 13 + (rand_get() % 256);
+                break;
+            default:
+                option += 269 + (rand_get() % 1000);
+                break;
+        }
+
+        if ((rand_get() & 0x01) == 0)
+        {
+            APP_ERROR_CHECK(coap_message_opt_uint_add(p_message, option,
+                                                      rand_get() >> (rand_get() % 24)));
+        }
+        else
+        {
+            uint16_t length = rand_get() % (COAP_OPT_LEN_MAX + 1);
+
+            APP_ERROR_CHECK(coap_message_opt_str_add(p_message, option,
+                                                     &m_data[rand_get() % 256], length));
+        }
+    }
+
+    if (payload_len != 0)
+    {
+        APP_ERROR_CHECK(coap_message_payload_set(p_message, &m_data[rand_get() % 256],
+                                                 payload_len));
+    }
+
+    return p_message;
+}
+
+
+/**@brief Function for checking that CoAP messages are sent as coap_message_encode encodes them.
+ *
+ * Messages which are not kept for retransmission are encoded straight into the transport
+ * buffer, the others into a retained buffer which is sent with coap_transport_write. Both must
+ * give the same bytes as coap_message_encode. Retained messages are completed by an ACK or a
+ * response, so that their buffers are freed.
+ */
+static void coap_send_check(void)
+{
+    benchmark_t           bench;
+    coap_transport_init_t transport = {.p_port_table = &m_coap_port};
+    uint32_t              responses = 0;
+
+    for (uint32_t i = 0; i < sizeof(m_data); i++)
+    {
+        m_data[i] = (uint8_t)rand_get();
+    }
+
+    APP_ERROR_CHECK(nrf_mem_init());
+    APP_ERROR_CHECK(coap_init(rand_get(), &transport));
+
+    for (uint32_t i = 0; i < COAP_SEND_MESSAGES; i++)
+    {
+        coap_message_t * p_message = coap_message_random_new();
+        uint8_t          expected[COAP_SENT_MAX];
+        uint16_t         expected_len = sizeof(expected);
+        uint32_t         writes       = m_coap_writes;
+        uint32_t         direct       = m_coap_direct_writes;
+        uint32_t         handle;
+        bool             retained     = (p_message->header.type == COAP_TYPE_CON) ||
+                                        ((p_message->header.code < COAP_CODE_205_CONTENT) &&
+                                         (p_message->response_callback != NULL));
+
+        memset(expected, 0, sizeof(expected));
+        APP_ERROR_CHECK(coap_message_encode(p_message, expected, &expected_len));
+
+        m_coap_sent_count = 0;
+        APP_ERROR_CHECK(coap_message_send(&handle, p_message));
+        BENCH_CHECK(m_coap_sent_count == 1);
+        BENCH_CHECK(m_coap_sent[0].len == expected_len);
+        BENCH_CHECK(memcmp(m_coap_sent[0].data, expected, expected_len) == 0);
+
+        if (retained)
+        {
+            coap_queue_item_t * p_item;
+            uint8_t             reply[4 + 8];
+            uint16_t            reply_len = 4;
+
+            BENCH_CHECK((m_coap_writes == writes + 1) && (m_coap_direct_writes == direct));
+            BENCH_CHECK(handle < COAP_MESSAGE_QUEUE_SIZE);
+
+            if (p_message->header.type == COAP_TYPE_CON)
+            {
+                responses    += (p_message->response_callback != NULL) ? 1 : 0;
+                m_coap_status = NRF_SUCCESS;
+                coap_ack_receive(p_message->header.id, &p_message->remote);
+            }
+            else if (p_message->header.token_len != 0)
+            {
+                /* NON response carrying the token. */
+                reply[0] = (COAP_VERSION << 6) | (COAP_TYPE_NON << 4) | p_message->header.token_len;
+                reply[1] = COAP_CODE_205_CONTENT;
+                reply[2] = (uint8_t)(p_message->header.id >> 8);
+                reply[3] = (uint8_t)p_message->header.id;
+                memcpy(&reply[4], p_message->token, p_message->header.token_len);
+                reply_len += p_message->header.token_len;
+
+                responses++;
+                m_coap_status = NRF_SUCCESS;
+                APP_ERROR_CHECK(coap_transport_read(&m_coap_port, &p_message->remote, NULL,
+                                                    NRF_SUCCESS, reply, reply_len));
+            }
+            else
+            {
+                /* A response cannot be matched without a token, the transaction times out. */
+                m_coap_status = COAP_TRANSMISSION_TIMEOUT;
+                for (uint32_t tick = 0; tick <= COAP_MAX_TRANSMISSION_SPAN; tick++)
+                {
+                    APP_ERROR_CHECK(coap_time_tick());
+                }
+                responses++;
+            }
+            BENCH_CHECK(coap_queue_item_next_get(&p_item, NULL) != NRF_SUCCESS);
+            BENCH_CHECK(m_coap_responses == responses);
+        }
+        else
+        {
+            BENCH_CHECK((m_coap_writes == writes) && (m_coap_direct_writes == direct + 1));
+            BENCH_CHECK(handle == COAP_MESSAGE_QUEUE_SIZE);
+        }
+
+        APP_ERROR_CHECK(coap_message_delete(p_message));
+    }
+    BENCH_CHECK((m_coap_writes != 0) && (m_coap_direct_writes != 0));
+    mem_free_check();
+
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < ITEM_ROUNDS / 10; i++)
+    {
+        coap_message_conf_t conf = {0};
+        coap_message_t    * p_message;
+        uint32_t            handle;
+
+        conf.type      = COAP_TYPE_NON;
+        conf.code      = COAP_CODE_205_CONTENT;
+        conf.id        = 1 + (i % 0xFFFF);
+        conf.token_len = 4;
+        conf.port      = m_coap_port;
+        memcpy(conf.token, &i, sizeof(i));
+        APP_ERROR_CHECK(coap_message_new(&p_message, &conf));
+        APP_ERROR_CHECK(coap_message_opt_uint_add(p_message, COAP_OPT_CONTENT_FORMAT,
+                                                  COAP_CT_APP_JSON));
+        APP_ERROR_CHECK(coap_message_payload_set(p_message, m_data, COAP_PAYLOAD_MAX));
+        m_coap_sent_count = 0;
+        APP_ERROR_CHECK(coap_message_send(&handle, p_message));
+        APP_ERROR_CHECK(coap_message_delete(p_message));
+    }
+    bench.ops = ITEM_ROUNDS / 10;
+    benchmark_end(&bench, "coap_message new+send+delete");
+}
+
+
+/**@brief Function for creating a notification of the observed CoAP resource.
+ *
+ * @param[in] type  Message type.
+ * @param[in] body  True to add options and a payload, false for a notification without them.
+ */
+static coap_message_t * coap_notification_new(coap_msg_type_t type, bool body)
+{
+    coap_message_conf_t conf = {0};
+    coap_message_t    * p_message;
+
+    conf.type = type;
+    conf.code = COAP_CODE_205_CONTENT;
+    conf.port = m_coap_port;
+    APP_ERROR_CHECK(coap_message_new(&p_message, &conf));
+
+    if (body)
+    {
+        APP_ERROR_CHECK(coap_message_opt_uint_add(p_message, COAP_OPT_OBSERVE, 1234));
+        APP_ERROR_CHECK(coap_message_opt_uint_add(p_message, COAP_OPT_CONTENT_FORMAT,
+                                                  COAP_CT_APP_JSON));
+        APP_ERROR_CHECK(coap_message_opt_uint_add(p_message, COAP_OPT_MAX_AGE, 60));
+        APP_ERROR_CHECK(coap_message_payload_set(p_message, m_data, COAP_PAYLOAD_MAX));
+    }
+
+    return p_message;
+}
+
+
+/**@brief Function for checking that notify-all sends what separate sends would.
+ *
+ * The notifications of each observer are compared with the same message sent to the observer
+ * with coap_message_send. Only the message IDs may differ. Observers of another resource or
+ * with another content type are not notified. A CON notification which does not fit in the
+ * message queue is sent but not tracked, and notify-all returns an error. A notification which
+ * fails does not keep the following observers from being notified, and the first error is
+ * returned.
+ */
+static void coap_notify_check(void)
+{
+    static coap_datagram_t notified[COAP_OBSERVE_MAX_NUM_OBSERVERS];
+
+    benchmark_t      bench;
+    coap_message_t * p_message;
+    uint32_t         handles[COAP_OBSERVE_MAX_NUM_OBSERVERS];
+    uint32_t         notified_count;
+
+    APP_ERROR_CHECK(coap_resource_create(&m_coap_observed[0], "led"));
+    APP_ERROR_CHECK(coap_resource_create(&m_coap_observed[1], "temp"));
+
+    for (uint32_t i = 0; i < COAP_OBSERVE_MAX_NUM_OBSERVERS; i++)
+    {
+        coap_observer_t observer;
+
+        memset(&observer, 0, sizeof(observer));
+        observer.remote.addr[15]        = (uint8_t)(i + 1);
+        observer.remote.port_number     = (uint16_t)(COAP_PORT + i);
+        observer.token_len              = (uint8_t)(1 + ((i * 3) % sizeof(observer.token)));
+        observer.ct                     = (i == 1) ? COAP_CT_PLAIN_TEXT : COAP_CT_APP_JSON;
+        observer.p_resource_of_interest = &m_coap_observed[(i == 2) ? 1 : 0];
+        for (uint32_t j = 0; j < observer.token_len; j++)
+        {
+            observer.token[j] = (uint8_t)((i << 4) | j);
+        }
+        APP_ERROR_CHECK(coap_observe_server_register(&handles[i], &observer));
+    }
+
+    for (uint32_t round = 0; round < 4; round++)
+    {
+        coap_msg_type_t   type       = ((round & 0x01) == 0) ? COAP_TYPE_NON : COAP_TYPE_CON;
+        bool              body       = (round & 0x02) == 0;
+        coap_observer_t * p_observer = NULL;
+        uint32_t          count      = 0;
+        uint32_t          queued     = 2;
+        uint32_t          err_code;
+
+        if ((type == COAP_TYPE_CON) && (COAP_MESSAGE_QUEUE_SIZE < queued))
+        {
+            queued = COAP_MESSAGE_QUEUE_SIZE;
+        }
+
+        m_coap_sent_count = 0;
+        p_message = coap_notification_new(type, body);
+        err_code  = coap_observe_server_notify_all(p_message, &m_coap_observed[0],
+                                                   COAP_CT_APP_JSON);
+        BENCH_CHECK(err_code == ((queued == 2) ? NRF_SUCCESS :
+                                                 (NRF_ERROR_NO_MEM | IOT_COAP_ERR_BASE)));
+        APP_ERROR_CHECK(coap_message_delete(p_message));
+        notified_count = m_coap_sent_count;
+        memcpy(notified, m_coap_sent, sizeof(notified));
+
+        while (coap_observe_server_next_get(&p_observer, p_observer, &m_coap_observed[0]) ==
+               NRF_SUCCESS)
+        {
+            coap_datagram_t const * p_notified = &notified[count];
+            uint32_t                handle;
+
+            if (p_observer->ct != COAP_CT_APP_JSON)
+            {
+                continue;
+            }
+            BENCH_CHECK(count < notified_count);
+
+            /* Complete the notification first, the queue may only have room for one. */
+            if ((type == COAP_TYPE_CON) && (count < queued))
+            {
+                coap_ack_receive(uint16_big_decode(&p_notified->data[2]), &p_notified->remote);
+            }
+
+            p_message = coap_notification_new(type, body);
+            memcpy(p_message->token, p_observer->token, p_observer->token_len);
+            p_message->header.token_len = p_observer->token_len;
+            APP_ERROR_CHECK(coap_message_remote_addr_set(p_message, &p_observer->remote));
+
+            m_coap_sent_count = 0;
+            APP_ERROR_CHECK(coap_message_send(&handle, p_message));
+            APP_ERROR_CHECK(coap_message_delete(p_message));
+            BENCH_CHECK(m_coap_sent_count == 1);
+
+            /* Bytes 2 and 3 are the message ID. */
+            BENCH_CHECK(memcmp(&p_notified->remote, &p_observer->remote, sizeof(coap_remote_t)) == 0);
+            BENCH_CHECK(p_notified->len == m_coap_sent[0].len);
+            BENCH_CHECK(memcmp(p_notified->data, m_coap_sent[0].data, 2) == 0);
+            BENCH_CHECK(memcmp(&p_notified->data[4], &m_coap_sent[0].data[4],
+                               p_notified->len - 4) == 0);
+            BENCH_CHECK((count == 0) ||
+                        (memcmp(&p_notified->data[2], &notified[count - 1].data[2], 2) != 0));
+
+            if (type == COAP_TYPE_CON)
+            {
+                coap_ack_receive(uint16_big_decode(&m_coap_sent[0].data[2]), &p_observer->remote);
+            }
+            count++;
+        }
+        BENCH_CHECK((count == 2) && (notified_count == count));
+
+        /* The transport fails for the first observer, the second one is still notified. */
+        m_coap_fail_port  = notified[0].remote.port_number;
+        m_coap_sent_count = 0;
+        p_message = coap_notification_new(type, body);
+        err_code  = coap_observe_server_notify_all(p_message, &m_coap_observed[0],
+                                                   COAP_CT_APP_JSON);
+        APP_ERROR_CHECK(coap_message_delete(p_message));
+        m_coap_fail_port = 0;
+        BENCH_CHECK(err_code == NRF_ERROR_BUSY);
+        BENCH_CHECK((m_coap_sent_count == 1) &&
+                    (memcmp(&m_coap_sent[0].remote, &notified[1].remote, sizeof(coap_remote_t)) == 0));
+        if (type == COAP_TYPE_CON)
+        {
+            coap_ack_receive(uint16_big_decode(&m_coap_sent[0].data[2]), &m_coap_sent[0].remote);
+        }
+    }
+
+    p_message = coap_notification_new(COAP_TYPE_NON, true);
+    benchmark_start(&bench);
+    for (uint32_t i = 0; i < COAP_NOTIFY_ROUNDS; i++)
+    {
+        m_coap_sent_count = 0;
+        APP_ERROR_CHECK(coap_observe_server_notify_all(p_message, &m_coap_observed[0],
+                                                       COAP_CT_APP_JSON));
+    }
+    bench.ops = COAP_NOTIFY_ROUNDS * 2;
+    benchmark_end(&bench, "coap_observe notify_all (per obs)");
+    APP_ERROR_CHECK(coap_message_delete(p_message));
+
+    for (uint32_t i = 0; i < COAP_OBSERVE_MAX_NUM_OBSERVERS; i++)
+    {
+        APP_ERROR_CHECK(coap_observe_server_unregister(handles[i]));
+    }
+    mem_free_check();
+}
+
+
+int main(void)
+{
+    printf("Library benchmark (host)\n");
+
+    crc_benchmark();
+    queue_benchmark();
+    atfifo_benchmark();
+    atfifo_thread_check();
+#if NRF_ATFIFO_CONFIG_STATS_ENABLED
+    atfifo_stats_check();
+#endif
+    balloc_benchmark();
+    balloc_context_check();
+    mem_manager_benchmark();
+    memobj_benchmark();
+    ringbuf_benchmark();
+    scheduler_benchmark();
+    scheduler_check();
+    sortlist_benchmark();
+    fstorage_benchmark();
+    fds_benchmark();
+    fds_find_check();
+    fds_gc_check();
+    fds_batch_check();
+    timer_benchmark();
+    log_stress_check();
+    log_serial_check();
+#if NRF_LOG_BACKEND_FLASH_ENABLED
+    log_flash_check();
+#endif
+    coap_queue_check();
+    coap_resource_check();
+    coap_send_check();
+    coap_notify_check();
+
+    return 0;
+}
+
+/** @} */
@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2018, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "rtc_sim.h"
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include "sdk_common.h"
+
+
+static drv_rtc_handler_t m_handler;         /**< Interrupt handler of the driver user. */
+static drv_rtc_t const * mp_instance;       /**< Instance passed to the interrupt handler. */
+
+static bool     m_running;                  /**< The counter is running. */
+static uint32_t m_counter;                  /**< Counter value. */
+static uint32_t m_cc;                       /**< Value of compare channel 0. */
+static bool     m_cc_evt_enabled;           /**< Compare event is routed. */
+static bool     m_cc_int_enabled;           /**< Compare event raises an interrupt. */
+static bool     m_cc_evt;                   /**< Compare event has occurred. */
+static bool     m_ovf_evt_enabled;          /**< Overflow event is routed. */
+static bool     m_ovf_int_enabled;          /**< Overflow event raises an interrupt. */
+static bool     m_ovf_evt;                  /**< Overflow event has occurred. */
+
+static bool     m_irq_pending;              /**< The interrupt is pending. */
+static bool     m_irq_evt;                  /**< The pending interrupt was raised by an RTC event. */
+static bool     m_in_irq;                   /**< The interrupt handler is running. */
+
+static rtc_sim_stats_t m_stats;
+
+
+static uint64_t time_ns_get(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+
+/* Run the interrupt handler for as long as the interrupt is pending. */
+static void irq_run(void)
+{
+    if (m_in_irq || (__get_PRIMASK() != 0))
+    {
+        return;
+    }
+
+    while (m_irq_pending)
+    {
+        bool     evt = m_irq_evt;
+        uint64_t start;
+        uint64_t elapsed;
+
+        m_irq_pending = false;
+        m_irq_evt     = false;
+
+        m_in_irq = true;
+        start    = time_ns_get();
+        m_handler(mp_instance);
+        elapsed  = time_ns_get() - start;
+        m_in_irq = false;
+
+        if (evt)
+        {
+            m_stats.evt_irqs++;
+            m_stats.evt_ns += elapsed;
+        }
+        else
+        {
+            m_stats.sw_irqs++;
+            m_stats.sw_ns += elapsed;
+        }
+
+        /* An event which was not cleared keeps the interrupt line asserted. */
+        if ((m_cc_evt && m_cc_int_enabled) || (m_ovf_evt && m_ovf_int_enabled))
+        {
+            m_irq_pending = true;
+            m_irq_evt     = true;
+        }
+    }
+}
+
+
+/* Raise the interrupt for an RTC event. */
+static void evt_irq_set(bool int_enabled)
+{
+    if (int_enabled)
+    {
+        m_irq_pending = true;
+        m_irq_evt     = true;
+    }
+}
+
+
+ret_code_t drv_rtc_init(drv_rtc_t const * const  p_instance,
+                        drv_rtc_config_t const * p_config,
+                        drv_rtc_handler_t        handler)
+{
+    ASSERT(p_instance);
+    ASSERT(p_config);
+    ASSERT(handler);
+
+    if (m_handler != NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    m_handler   = handler;
+    mp_instance = p_instance;
+    return NRF_SUCCESS;
+}
+
+
+void drv_rtc_start(drv_rtc_t const * const p_instance)
+{
+    m_running = true;
+}
+
+
+void drv_rtc_stop(drv_rtc_t const * const p_instance)
+{
+    m_running = false;
+}
+
+
+ret_code_t drv_rtc_windowed_compare_set(drv_rtc_t const * const p_instance,
+                                        uint32_t                cc,
+                                        uint32_t                abs_value,
+                                        uint16_t                safe_window)
+{
+    int32_t diff;
+
+    ASSERT(cc == 0);
+
+    m_cc_int_enabled = false;
+    m_cc_evt         = false;
+    m_cc             = abs_value & RTC_COUNTER_COUNTER_Msk;
+    m_cc_evt_enabled = true;
+
+    /* Same check as in the driver: a value up to 2 ticks ahead of the counter might not raise
+     * the event, and a value less than the safe window behind it has already passed. */
+    diff = (int32_t)((m_cc - m_counter) & RTC_COUNTER_COUNTER_Msk);
+    diff = (diff & 0x800000) ? (int32_t)((uint32_t)diff | 0xFF000000) : diff;
+    if ((diff > -(int32_t)safe_window) && (diff <= 2))
+    {
+        return NRF_ERROR_TIMEOUT;
+    }
+
+    m_cc_int_enabled = true;
+    return NRF_SUCCESS;
+}
+
+
+void drv_rtc_overflow_enable(drv_rtc_t const * const p_instance, bool irq_enable)
+{
+    m_ovf_evt_enabled = true;
+    m_ovf_int_enabled = irq_enable;
+}
+
+
+bool drv_rtc_overflow_pending(drv_rtc_t const * const p_instance)
+{
+    bool pending = m_ovf_evt;
+
+    m_ovf_evt = false;
+    return pending;
+}
+
+
+bool drv_rtc_compare_pending(drv_rtc_t const * const p_instance, uint32_t cc)
+{
+    bool pending = m_cc_evt;
+
+    ASSERT(cc == 0);
+
+    m_cc_evt = false;
+    return pending;
+}
+
+
+uint32_t drv_rtc_counter_get(drv_rtc_t const * const p_instance)
+{
+    return m_counter;
+}
+
+
+void drv_rtc_irq_trigger(drv_rtc_t const * const p_instance)
+{
+    m_irq_pending = true;
+    irq_run();
+}
+
+
+void rtc_sim_run(uint32_t ticks)
+{
+    irq_run();
+
+    while ((ticks > 0) && m_running)
+    {
+        uint32_t step     = ticks;
+        uint32_t to_ovf   = (RTC_COUNTER_COUNTER_Msk + 1) - m_counter;
+        uint32_t to_cc    = (m_cc - m_counter) & RTC_COUNTER_COUNTER_Msk;
+
+        /* The compare event occurs when the counter changes to the compare value. */
+        if ((to_cc == 0) || !m_cc_evt_enabled)
+        {
+            to_cc = RTC_COUNTER_COUNTER_Msk + 1;
+        }
+        step = MIN(step, MIN(to_ovf, to_cc));
+
+        m_counter      = (m_counter + step) & RTC_COUNTER_COUNTER_Msk;
+        m_stats.ticks += step;
+        ticks         -= step;
+
+        if (m_cc_evt_enabled && (m_counter == m_cc))
+        {
+            m_cc_evt = true;
+            evt_irq_set(m_cc_int_enabled);
+        }
+        if (m_ovf_evt_enabled && (m_counter == 0))
+        {
+            m_ovf_evt = true;
+            evt_irq_set(m_ovf_int_enabled);
+        }
+        irq_run();
+    }
+}
+
+
+void rtc_sim_stats_get(rtc_sim_stats_t * p_stats)
+{
+    *p_stats = m_stats;
+    memset(&m_stats, 0, sizeof(m_stats));
+}
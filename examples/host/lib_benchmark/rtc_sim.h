@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2018, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * @file
+ *
+ * @defgroup rtc_sim Simulated RTC driver
+ * @ingroup lib_benchmark_example
+ * @{
+ *
+ * @brief Stand-in for the RTC driver of app_timer V2 (@c drv_rtc.h) on a PC host.
+ *
+ * @details The RTC peripheral is simulated: the 24-bit counter, compare channel 0 and the
+ *          overflow event. Time only passes in @ref rtc_sim_run, which stops at every RTC event
+ *          and runs the interrupt handler if the event interrupt is enabled. An interrupt
+ *          triggered by software runs at once, unless the handler is already running or
+ *          interrupts are masked. It is then kept pending until the handler returns or until
+ *          the next call to @ref rtc_sim_run. The time spent in the handler is measured.
+ *
+ *          The header defines the include guard of @c drv_rtc.h, so it must be included before
+ *          it, for example with the @c -include compiler option.
+ */
+
+#ifndef RTC_SIM_H__
+#define RTC_SIM_H__
+
+/* Replaces drv_rtc.h, which needs the peripheral registers. */
+#define DRV_RTC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#ifndef RTC_COUNTER_COUNTER_Msk
+#define RTC_COUNTER_COUNTER_Msk     (0xFFFFFFUL)    /**< The counter is 24 bits wide. */
+#endif
+
+#ifndef NRFX_SUCCESS
+#define NRFX_SUCCESS                NRF_SUCCESS     /**< As in nrfx_glue.h, included by drv_rtc.h. */
+#endif
+
+/** @brief Maximum RTC counter value. */
+#define DRV_RTC_MAX_CNT             RTC_COUNTER_COUNTER_Msk
+
+/** @brief Minimum delta value between set value and counter value, as in @c drv_rtc.h. */
+#define DRV_RTC_MIN_TICK_HANDLED    3
+
+
+/** @brief RTC driver instance structure. */
+typedef struct
+{
+    uint8_t instance_id;    /**< Instance index. */
+} drv_rtc_t;
+
+/** @brief Macro for creating RTC driver instance. Only one instance is simulated. */
+#define DRV_RTC_INSTANCE(id)    \
+{                               \
+    .instance_id = 0,           \
+}
+
+/** @brief RTC driver instance configuration structure. */
+typedef struct
+{
+    uint16_t prescaler;          /**< Prescaler, ignored. */
+    uint8_t  interrupt_priority; /**< Interrupt priority, ignored. */
+} drv_rtc_config_t;
+
+/** @brief RTC driver instance handler type. */
+typedef void (*drv_rtc_handler_t)(drv_rtc_t const * const  p_instance);
+
+
+/**@brief Statistics of the simulated RTC interrupt. */
+typedef struct
+{
+    uint32_t evt_irqs;      /**< Number of interrupts raised by an RTC event. */
+    uint32_t sw_irqs;       /**< Number of interrupts triggered by software. */
+    uint64_t evt_ns;        /**< Time spent in the handler in interrupts raised by an RTC event. */
+    uint64_t sw_ns;         /**< Time spent in the handler in interrupts triggered by software. */
+    uint64_t ticks;         /**< Number of ticks counted by the RTC. */
+} rtc_sim_stats_t;
+
+
+/* Functions of drv_rtc.h used by app_timer V2, see there. */
+ret_code_t drv_rtc_init(drv_rtc_t const * const  p_instance,
+                        drv_rtc_config_t const * p_config,
+                        drv_rtc_handler_t        handler);
+void       drv_rtc_start(drv_rtc_t const * const p_instance);
+void       drv_rtc_stop(drv_rtc_t const * const p_instance);
+ret_code_t drv_rtc_windowed_compare_set(drv_rtc_t const * const p_instance,
+                                        uint32_t                cc,
+                                        uint32_t                abs_value,
+                                        uint16_t                safe_window);
+void       drv_rtc_overflow_enable(drv_rtc_t const * const p_instance, bool irq_enable);
+bool       drv_rtc_overflow_pending(drv_rtc_t const * const p_instance);
+bool       drv_rtc_compare_pending(drv_rtc_t const * const p_instance, uint32_t cc);
+uint32_t   drv_rtc_counter_get(drv_rtc_t const * const p_instance);
+void       drv_rtc_irq_trigger(drv_rtc_t const * const p_instance);
+
+
+/**@brief Function for letting time pass.
+ *
+ * The counter advances only while the RTC is started. Interrupts raised by RTC events are
+ * handled at the tick at which the event occurs. A pending interrupt is handled first.
+ *
+ * @param[in] ticks Number of ticks to pass.
+ */
+void rtc_sim_run(uint32_t ticks);
+
+
+/**@brief Function for getting and clearing the interrupt statistics.
+ *
+ * @param[out] p_stats  Statistics gathered since the previous call.
+ */
+void rtc_sim_stats_get(rtc_sim_stats_t * p_stats);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RTC_SIM_H__
+/** @} */